@@ -0,0 +1,159 @@
+/**
+ * CPU feature detection for selecting transpose kernels at run time.
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @date 2026-10-17
+ */
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+#include "cpu-features.h"
+
+// not defined by older compilers' cpuid.h
+#ifndef bit_AVX512VBMI
+#define bit_AVX512VBMI  (1U << 1)
+#endif
+#ifndef bit_AVX512BF16
+#define bit_AVX512BF16  (1U << 5)
+#endif
+
+// XCR0 bits that the OS sets when it saves the corresponding register state
+#define XCR0_SSE        (1U << 1)
+#define XCR0_AVX        (1U << 2)
+#define XCR0_OPMASK     (1U << 5)
+#define XCR0_ZMM_HI256  (1U << 6)
+#define XCR0_HI16_ZMM   (1U << 7)
+
+#if defined(__x86_64__) || defined(__i386__)
+static uint32_t xgetbv0(void)
+{
+    uint32_t eax, edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return eax;
+}
+#endif
+
+void cpu_features_detect(struct cpu_features *f)
+{
+    memset(f, 0, sizeof(*f));
+#if defined(__x86_64__) || defined(__i386__)
+    unsigned int eax, ebx, ecx, edx;
+    uint32_t xcr0;
+    int os_avx, os_avx512;
+
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        return;
+    }
+    // without OSXSAVE we cannot ask whether the OS preserves ymm/zmm state
+    if (!(ecx & bit_OSXSAVE)) {
+        return;
+    }
+    xcr0 = xgetbv0();
+    os_avx = (xcr0 & (XCR0_SSE | XCR0_AVX)) == (XCR0_SSE | XCR0_AVX);
+    os_avx512 = os_avx &&
+        (xcr0 & (XCR0_OPMASK | XCR0_ZMM_HI256 | XCR0_HI16_ZMM)) ==
+        (XCR0_OPMASK | XCR0_ZMM_HI256 | XCR0_HI16_ZMM);
+    if (!os_avx) {
+        return;
+    }
+    f->fma = !!(ecx & bit_FMA);
+    f->f16c = !!(ecx & bit_F16C);
+
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+        return;
+    }
+    f->avx2 = !!(ebx & bit_AVX2);
+    if (os_avx512) {
+        f->avx512f = !!(ebx & bit_AVX512F);
+        f->avx512dq = !!(ebx & bit_AVX512DQ);
+        f->avx512bw = !!(ebx & bit_AVX512BW);
+        f->avx512vl = !!(ebx & bit_AVX512VL);
+        f->avx512vbmi = !!(ecx & bit_AVX512VBMI);
+        if (__get_cpuid_count(7, 1, &eax, &ebx, &ecx, &edx)) {
+            f->avx512bf16 = !!(eax & bit_AVX512BF16);
+        }
+    }
+#endif
+}
+
+enum cpu_isa cpu_isa_detect(void)
+{
+    struct cpu_features f;
+    cpu_features_detect(&f);
+    // these match the CPU_TARGET_* attributes the kernels are compiled with
+    if (f.avx512f && f.avx512dq && f.avx512bw && f.avx512vl) {
+        return CPU_ISA_AVX512;
+    }
+    if (f.avx2 && f.fma) {
+        return CPU_ISA_AVX2;
+    }
+    return CPU_ISA_SCALAR;
+}
+
+static const char *isa_names[] = {
+    [CPU_ISA_SCALAR] = "scalar",
+    [CPU_ISA_AVX2] = "avx2",
+    [CPU_ISA_AVX512] = "avx512",
+};
+
+const char *cpu_isa_name(enum cpu_isa isa)
+{
+    return isa_names[isa];
+}
+
+int cpu_isa_from_name(const char *name, enum cpu_isa *isa)
+{
+    size_t i;
+    for (i = 0; i < sizeof(isa_names) / sizeof(isa_names[0]); i++) {
+        if (!strcmp(name, isa_names[i])) {
+            *isa = (enum cpu_isa)i;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+/*
+ * Walk the deterministic cache parameters leaf (4 on Intel, 0x8000001d on AMD)
+ * and return the size of the highest-level data or unified cache, or 0.
+ */
+static size_t cpuid_cache_walk(unsigned int leaf)
+{
+    unsigned int eax, ebx, ecx, edx, i, type, level, best_level = 0;
+    size_t size, best_size = 0;
+    for (i = 0; __get_cpuid_count(leaf, i, &eax, &ebx, &ecx, &edx); i++) {
+        type = eax & 0x1f;
+        if (!type) {
+            break;
+        }
+        level = (eax >> 5) & 0x7;
+        // 1 = data, 3 = unified; skip instruction caches
+        if (type == 2 || level < best_level) {
+            continue;
+        }
+        // ways * partitions * line size * sets
+        size = (size_t)((ebx >> 22) + 1) * (((ebx >> 12) & 0x3ff) + 1) *
+               ((ebx & 0xfff) + 1) * ((size_t)ecx + 1);
+        best_level = level;
+        best_size = size;
+    }
+    return best_size;
+}
+#endif
+
+size_t cpu_llc_size(void)
+{
+    size_t size = 0;
+#if defined(__x86_64__) || defined(__i386__)
+    size = cpuid_cache_walk(4);
+    if (!size && __get_cpuid_max(0x80000000, NULL) >= 0x8000001d) {
+        size = cpuid_cache_walk(0x8000001d);
+    }
+#endif
+    return size;
+}
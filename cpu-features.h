@@ -0,0 +1,65 @@
+/**
+ * CPU feature detection for selecting transpose kernels at run time.
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef CPU_FEATURES_H
+#define CPU_FEATURES_H
+
+#include <stdlib.h>
+
+/*
+ * Function-level target attributes let one translation unit contain kernels
+ * for several ISAs without compiling the whole file for the newest one.  When
+ * the file is compiled with matching -march flags anyway, they are no-ops.
+ */
+#if defined(__GNUC__) && !defined(__INTEL_COMPILER)
+#define CPU_TARGET_AVX512 \
+    __attribute__((target("avx512f,avx512dq,avx512bw,avx512vl")))
+#define CPU_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define CPU_TARGET_AVX512_BF16 \
+    __attribute__((target("avx512f,avx512dq,avx512bw,avx512vl,avx512bf16")))
+#else
+#define CPU_TARGET_AVX512
+#define CPU_TARGET_AVX2
+// without target attributes, bf16 kernels need the file compiled for them
+#if defined(__AVX512BF16__)
+#define CPU_TARGET_AVX512_BF16
+#endif
+#endif
+
+struct cpu_features {
+    int avx2;
+    int fma;
+    int f16c;
+    int avx512f;
+    int avx512dq;
+    int avx512bw;
+    int avx512vl;
+    int avx512vbmi;
+    int avx512bf16;
+};
+
+// ordered from least to most capable
+enum cpu_isa {
+    CPU_ISA_SCALAR = 0,
+    CPU_ISA_AVX2,
+    CPU_ISA_AVX512,
+};
+
+void cpu_features_detect(struct cpu_features *f);
+
+enum cpu_isa cpu_isa_detect(void);
+
+const char *cpu_isa_name(enum cpu_isa isa);
+
+int cpu_isa_from_name(const char *name, enum cpu_isa *isa);
+
+/*
+ * Size in bytes of the last-level cache (shared by all cores on the package on
+ * most CPUs), or 0 if it cannot be determined.
+ */
+size_t cpu_llc_size(void);
+
+#endif /* CPU_FEATURES_H */
@@ -17,8 +17,25 @@
 
 #include "ptime.h"
 
-#if defined(USE_FFTWF_NAIVE) || defined(USE_FFTWF_BLOCKED)
+#if defined(USE_FFTWF_AVX_INTR_8X8) || \
+    defined(USE_FFTWF_THREADS_AVX_INTR_8X8_ROW) || \
+    defined(USE_FFTWF_THREADS_AVX_INTR_8X8_COL)
+#define _USE_FFTWF_AVX 1
+#endif
+
+#if defined(USE_FFTWF_NAIVE) || defined(USE_FFTWF_BLOCKED) || \
+    defined(_USE_FFTWF_AVX) || defined(USE_FFTWF_DISPATCH) || \
+    defined(USE_FFTWF_CYCLES) || defined(USE_FFTWF_THREADS_CYCLES)
 #include "transpose-fftwf.h"
+#if defined(USE_FFTWF_THREADS_CYCLES)
+#include "transpose-fftwf-threads.h"
+#endif
+#if defined(_USE_FFTWF_AVX)
+#include "transpose-fftwf-avx.h"
+#endif
+#if defined(USE_FFTWF_DISPATCH)
+#include "transpose-fftwf-dispatch.h"
+#endif
 #include "util-fftwf.h"
 typedef fftwf_complex       FFTW_COMPLEX_T;
 typedef fftwf_plan          FFTW_PLAN_T;
@@ -28,8 +45,31 @@ typedef fftwf_plan          FFTW_PLAN_T;
 #define FFTW_PLAN_DESTROY   fftwf_destroy_plan
 #define FFTW_EXECUTE        fftwf_execute
 #define FILL_RAND           fill_rand_fftwf_complex
+typedef float               FFTW_REAL_T;
+typedef fftwf_iodim         FFTW_IODIM_T;
+#define FFTW_PLAN_GURU_SPLIT fftwf_plan_guru_split_dft
+#define SPLIT_TRANSPOSE(fn) transpose_flt_cmplx_split_##fn
+#define PERM_TRANSPOSE(fn)  transpose_flt_cmplx_##fn##_perm
+#define PERM_TABLES_TRANSPOSE(fn) transpose_flt_cmplx_##fn##_perm_tables
+#if defined(USE_FFTW_SPLIT)
+#error "USE_FFTW_SPLIT needs a double-precision (USE_FFTW_*) transpose"
+#endif
+#if defined(USE_FFTW_PERM)
+#error "USE_FFTW_PERM needs a double-precision (USE_FFTW_*) transpose"
+#endif
 #else
 #include "transpose-fftw.h"
+#if defined(USE_FFTW_THREADS_CYCLES)
+#include "transpose-fftw-threads.h"
+#endif
+#if defined(USE_FFTW_AVX_INTR_4X4) || \
+    defined(USE_FFTW_THREADS_AVX_INTR_4X4_ROW) || \
+    defined(USE_FFTW_THREADS_AVX_INTR_4X4_COL)
+#include "transpose-fftw-avx.h"
+#endif
+#if defined(USE_FFTW_DISPATCH)
+#include "transpose-fftw-dispatch.h"
+#endif
 #include "util-fftw.h"
 typedef fftw_complex        FFTW_COMPLEX_T;
 typedef fftw_plan           FFTW_PLAN_T;
@@ -39,12 +79,107 @@ typedef fftw_plan           FFTW_PLAN_T;
 #define FFTW_PLAN_DESTROY   fftw_destroy_plan
 #define FFTW_EXECUTE        fftw_execute
 #define FILL_RAND           fill_rand_fftw_complex
+typedef double              FFTW_REAL_T;
+typedef fftw_iodim          FFTW_IODIM_T;
+#define FFTW_PLAN_GURU_SPLIT fftw_plan_guru_split_dft
+#define SPLIT_TRANSPOSE(fn) transpose_dbl_cmplx_split_##fn
+#define PERM_TRANSPOSE(fn)  transpose_dbl_cmplx_##fn##_perm
+#define PERM_TABLES_TRANSPOSE(fn) transpose_dbl_cmplx_##fn##_perm_tables
+#if defined(USE_FFTWF_SPLIT)
+#error "USE_FFTWF_SPLIT needs a single-precision (USE_FFTWF_*) transpose"
+#endif
+#if defined(USE_FFTWF_PERM)
+#error "USE_FFTWF_PERM needs a single-precision (USE_FFTWF_*) transpose"
+#endif
 #endif
 
 #if defined(USE_FFTWF_BLOCKED) || defined(USE_FFTW_BLOCKED)
 #define _USE_TRANSP_BLOCKED 1
 #endif
 
+#if defined(USE_FFTWF_THREADS_AVX_INTR_8X8_ROW) || \
+    defined(USE_FFTWF_THREADS_AVX_INTR_8X8_COL) || \
+    defined(USE_FFTW_THREADS_AVX_INTR_4X4_ROW) || \
+    defined(USE_FFTW_THREADS_AVX_INTR_4X4_COL) || \
+    defined(USE_FFTWF_THREADS_CYCLES) || \
+    defined(USE_FFTW_THREADS_CYCLES)
+#define _USE_TRANSP_THREADS 1
+#endif
+
+// USE_FFTWF_IQ16 / USE_FFTWF_IQ12: the input arrives as COLS x ROWS raw I/Q
+// samples, which are converted and corner turned into the input of FFT 1 in
+// one pass by the ingest variant of the selected transpose
+#if defined(USE_FFTWF_IQ16) || defined(USE_FFTWF_IQ12)
+#define _USE_FFT_IQ 1
+#include "transpose.h"
+#include "util.h"
+#if defined(_USE_FFTWF_AVX)
+#include "transpose-avx.h"
+#include "transpose-threads-avx.h"
+#endif
+#if defined(USE_FFTWF_IQ16)
+typedef transpose_iq16_t    IQ_T;
+#define IQ_FILL_RAND        fill_rand_iq16
+#define IQ_SCALE            TRANSPOSE_IQ16_FULL_SCALE
+#define IQ_INGEST(fn)       transpose_iq16_flt_cmplx_##fn
+#else
+typedef transpose_iq12_t    IQ_T;
+#define IQ_FILL_RAND        fill_rand_iq12
+#define IQ_SCALE            TRANSPOSE_IQ12_FULL_SCALE
+#define IQ_INGEST(fn)       transpose_iq12_flt_cmplx_##fn
+#endif
+#endif
+
+// in-place transposes let both FFT stages run in place on a single buffer
+#if defined(USE_FFTWF_CYCLES) || defined(USE_FFTWF_THREADS_CYCLES) || \
+    defined(USE_FFTW_CYCLES) || defined(USE_FFTW_THREADS_CYCLES)
+#define _USE_TRANSP_INPLACE 1
+#endif
+
+#if defined(_USE_FFT_IQ) && defined(_USE_TRANSP_INPLACE)
+#error "The I/Q ingest needs an out-of-place transpose"
+#endif
+
+// USE_FFTWF_SPLIT / USE_FFTW_SPLIT: the transpose also splits the output of
+// FFT 1 into real and imaginary planes, and FFT 2 runs on those planes through
+// FFTW's split-array guru interface
+#if defined(USE_FFTWF_SPLIT) || defined(USE_FFTW_SPLIT)
+#define _USE_FFT_SPLIT 1
+#include "transpose.h"
+#if defined(_USE_FFTWF_AVX) || defined(USE_FFTW_AVX_INTR_4X4) || \
+    defined(USE_FFTW_THREADS_AVX_INTR_4X4_ROW) || \
+    defined(USE_FFTW_THREADS_AVX_INTR_4X4_COL)
+#include "transpose-avx.h"
+#include "transpose-threads-avx.h"
+#endif
+#endif
+
+#if defined(_USE_FFT_SPLIT) && \
+    (defined(_USE_TRANSP_INPLACE) || defined(_USE_FFT_IQ))
+#error "The split mode needs an out-of-place transpose and no I/Q ingest"
+#endif
+
+// USE_FFTWF_PERM / USE_FFTW_PERM: the transpose also permutes the input of
+// FFT 2, e.g., an fftshift of the frequency bins of FFT 1 (-P) or bit-reversed
+// input order for a decimation-in-time FFT 2 (-Q)
+#if defined(USE_FFTWF_PERM) || defined(USE_FFTW_PERM)
+#define _USE_FFT_PERM 1
+#include "transpose.h"
+#include "util.h"
+#if defined(USE_FFTWF_AVX_INTR_8X8) || defined(USE_FFTW_AVX_INTR_4X4)
+#include "transpose-avx.h"
+// the AVX transposes take perm as gather tables, built once in main
+#define _USE_FFT_PERM_TABLES 1
+static size_t *perm_src, *perm_dst;
+#endif
+static struct transpose_perm perm;
+#endif
+
+#if defined(_USE_FFT_PERM) && \
+    (defined(_USE_TRANSP_INPLACE) || defined(_USE_FFT_SPLIT))
+#error "The permuting mode needs an out-of-place, interleaved transpose"
+#endif
+
 static size_t nrows = 0;
 static size_t ncols = 0;
 static struct timespec t1;
@@ -55,9 +190,34 @@ static size_t nblkrows = 0;
 static size_t nblkcols = 0;
 #endif
 
+#if defined(_USE_TRANSP_THREADS)
+static size_t nthreads = 1;
+#endif
+
 #define PRINT_ELAPSED_TIME(prefix, t1, t2) \
     printf("%s (ms): %f\n", prefix, ptime_elapsed_ns(t1, t2) / 1000000.0);
 
+#if defined(_USE_TRANSP_INPLACE)
+static void plans_alloc_inplace(FFTW_COMPLEX_T *A, FFTW_PLAN_T **p,
+                                size_t r, size_t c)
+{
+    size_t i;
+    *p = ASSERT_FFTW_MALLOC(r * sizeof(**p));
+    for (i = 0; i < r; i++) {
+        (*p)[i] = FFTW_PLAN_1D(c, &A[i * c], &A[i * c],
+                               FFTW_FORWARD, FFTW_ESTIMATE);
+    }
+}
+
+static void plans_free(FFTW_PLAN_T *p, size_t r)
+{
+    size_t i;
+    for (i = 0; i < r; i++) {
+        FFTW_PLAN_DESTROY(p[i]);
+    }
+    FFTW_FREE(p);
+}
+#else
 static void data_alloc(FFTW_COMPLEX_T **A, FFTW_COMPLEX_T **B, FFTW_PLAN_T **p,
                        size_t r, size_t c)
 {
@@ -82,7 +242,89 @@ static void data_free(FFTW_COMPLEX_T *A, FFTW_COMPLEX_T *B, FFTW_PLAN_T *p,
     FFTW_FREE(B);
     FFTW_FREE(A);
 }
+#endif
+
+#if defined(_USE_FFT_IQ)
+// convert and transpose the COLS x ROWS samples in iq into the input of FFT 1
+static void iq_ingest(const IQ_T *iq, FFTW_COMPLEX_T *fft1_in)
+{
+    ptime_gettime_monotonic(&t1);
+#if defined(USE_FFTWF_NAIVE)
+    IQ_INGEST(naive)(iq, fft1_in, ncols, nrows, IQ_SCALE);
+#elif defined(USE_FFTWF_BLOCKED)
+    IQ_INGEST(blocked)(iq, fft1_in, ncols, nrows, IQ_SCALE, nblkcols,
+                       nblkrows);
+#elif defined(USE_FFTWF_AVX_INTR_8X8)
+    IQ_INGEST(avx_intr_8x8)(iq, fft1_in, ncols, nrows, IQ_SCALE);
+#elif defined(USE_FFTWF_THREADS_AVX_INTR_8X8_ROW)
+    IQ_INGEST(threads_avx_intr_8x8_row)(iq, fft1_in, ncols, nrows, IQ_SCALE,
+                                        nthreads);
+#elif defined(USE_FFTWF_THREADS_AVX_INTR_8X8_COL)
+    IQ_INGEST(threads_avx_intr_8x8_col)(iq, fft1_in, ncols, nrows, IQ_SCALE,
+                                        nthreads);
+#else
+    #error "No matching I/Q ingest implementation found!"
+#endif
+    ptime_gettime_monotonic(&t2);
+    PRINT_ELAPSED_TIME("ingest", &t1, &t2);
+}
+#endif
+
+#if defined(_USE_FFT_SPLIT)
+static void fft_tr_fft_1d_split(const FFTW_PLAN_T *p1, FFTW_PLAN_T p2,
+                                const FFTW_COMPLEX_T *fft1_out,
+                                FFTW_REAL_T *fft2_in_re,
+                                FFTW_REAL_T *fft2_in_im)
+{
+    size_t i;
+
+    // Perform first set of 1D FFTs
+    ptime_gettime_monotonic(&t1);
+    for (i = 0; i < nrows; i++) {
+        FFTW_EXECUTE(p1[i]);
+    }
+    ptime_gettime_monotonic(&t2);
+    PRINT_ELAPSED_TIME("fft-1d-1", &t1, &t2);
+
+    // Matrix transpose into split real and imaginary planes
+    ptime_gettime_monotonic(&t1);
+#if defined(USE_FFTWF_NAIVE) || defined(USE_FFTW_NAIVE)
+    SPLIT_TRANSPOSE(naive)(fft1_out, fft2_in_re, fft2_in_im, nrows, ncols);
+#elif defined(USE_FFTWF_AVX_INTR_8X8)
+    SPLIT_TRANSPOSE(avx_intr_16x16)(fft1_out, fft2_in_re, fft2_in_im,
+                                    nrows, ncols);
+#elif defined(USE_FFTWF_THREADS_AVX_INTR_8X8_ROW)
+    SPLIT_TRANSPOSE(threads_avx_intr_16x16_row)(fft1_out, fft2_in_re,
+                                                fft2_in_im, nrows, ncols,
+                                                nthreads);
+#elif defined(USE_FFTWF_THREADS_AVX_INTR_8X8_COL)
+    SPLIT_TRANSPOSE(threads_avx_intr_16x16_col)(fft1_out, fft2_in_re,
+                                                fft2_in_im, nrows, ncols,
+                                                nthreads);
+#elif defined(USE_FFTW_AVX_INTR_4X4)
+    SPLIT_TRANSPOSE(avx_intr_8x8)(fft1_out, fft2_in_re, fft2_in_im,
+                                  nrows, ncols);
+#elif defined(USE_FFTW_THREADS_AVX_INTR_4X4_ROW)
+    SPLIT_TRANSPOSE(threads_avx_intr_8x8_row)(fft1_out, fft2_in_re,
+                                              fft2_in_im, nrows, ncols,
+                                              nthreads);
+#elif defined(USE_FFTW_THREADS_AVX_INTR_4X4_COL)
+    SPLIT_TRANSPOSE(threads_avx_intr_8x8_col)(fft1_out, fft2_in_re,
+                                              fft2_in_im, nrows, ncols,
+                                              nthreads);
+#else
+    #error "No matching split transpose implementation found!"
+#endif
+    ptime_gettime_monotonic(&t2);
+    PRINT_ELAPSED_TIME("transpose", &t1, &t2);
 
+    // Perform second set of 1D FFTs, all with one split-array plan
+    ptime_gettime_monotonic(&t1);
+    FFTW_EXECUTE(p2);
+    ptime_gettime_monotonic(&t2);
+    PRINT_ELAPSED_TIME("fft-1d-2", &t1, &t2);
+}
+#else
 static void fft_tr_fft_1d(const FFTW_PLAN_T *p1, const FFTW_PLAN_T *p2,
                           FFTW_COMPLEX_T *fft1_out, FFTW_COMPLEX_T *fft2_in)
 {
@@ -98,16 +340,61 @@ static void fft_tr_fft_1d(const FFTW_PLAN_T *p1, const FFTW_PLAN_T *p2,
 
     // Matrix transpose
     ptime_gettime_monotonic(&t1);
-#if defined(USE_FFTWF_NAIVE)
+#if defined(_USE_FFT_PERM)
+#if defined(USE_FFTWF_NAIVE) || defined(USE_FFTW_NAIVE)
+    PERM_TRANSPOSE(naive)(fft1_out, fft2_in, nrows, ncols, &perm);
+#elif defined(USE_FFTWF_BLOCKED) || defined(USE_FFTW_BLOCKED)
+    PERM_TRANSPOSE(blocked)(fft1_out, fft2_in, nrows, ncols, &perm, nblkrows,
+                            nblkcols);
+#elif defined(USE_FFTWF_AVX_INTR_8X8)
+    PERM_TABLES_TRANSPOSE(avx_intr_8x8)(fft1_out, fft2_in, nrows, ncols,
+                                        perm_src, perm_dst);
+#elif defined(USE_FFTW_AVX_INTR_4X4)
+    PERM_TABLES_TRANSPOSE(avx_intr_4x4)(fft1_out, fft2_in, nrows, ncols,
+                                        perm_src, perm_dst);
+#else
+    #error "No matching permuting transpose implementation found!"
+#endif
+#elif defined(USE_FFTWF_NAIVE)
     transpose_fftwf_complex_naive(fft1_out, fft2_in, nrows, ncols);
 #elif defined(USE_FFTWF_BLOCKED)
     transpose_fftwf_complex_blocked(fft1_out, fft2_in, nrows, ncols, nblkrows,
                                     nblkcols);
+#elif defined(USE_FFTWF_AVX_INTR_8X8)
+    transpose_fftwf_complex_avx_intr_8x8(fft1_out, fft2_in, nrows, ncols);
+#elif defined(USE_FFTWF_THREADS_AVX_INTR_8X8_ROW)
+    transpose_fftwf_complex_threads_avx_intr_8x8_row(fft1_out, fft2_in,
+                                                     nrows, ncols, nthreads);
+#elif defined(USE_FFTWF_THREADS_AVX_INTR_8X8_COL)
+    transpose_fftwf_complex_threads_avx_intr_8x8_col(fft1_out, fft2_in,
+                                                     nrows, ncols, nthreads);
+#elif defined(USE_FFTWF_DISPATCH)
+    transpose_fftwf_complex_dispatch(fft1_out, fft2_in, nrows, ncols);
+#elif defined(USE_FFTWF_CYCLES)
+    transpose_fftwf_complex_cycles_inplace(fft1_out, nrows, ncols);
+#elif defined(USE_FFTWF_THREADS_CYCLES)
+    transpose_fftwf_complex_threads_cycles_inplace(fft1_out, nrows, ncols,
+                                                   nthreads);
 #elif defined(USE_FFTW_NAIVE)
     transpose_fftw_complex_naive(fft1_out, fft2_in, nrows, ncols);
 #elif defined(USE_FFTW_BLOCKED)
     transpose_fftw_complex_blocked(fft1_out, fft2_in, nrows, ncols, nblkrows,
                                    nblkcols);
+#elif defined(USE_FFTW_AVX_INTR_4X4)
+    transpose_fftw_complex_avx_intr_4x4(fft1_out, fft2_in, nrows, ncols);
+#elif defined(USE_FFTW_THREADS_AVX_INTR_4X4_ROW)
+    transpose_fftw_complex_threads_avx_intr_4x4_row(fft1_out, fft2_in,
+                                                    nrows, ncols, nthreads);
+#elif defined(USE_FFTW_THREADS_AVX_INTR_4X4_COL)
+    transpose_fftw_complex_threads_avx_intr_4x4_col(fft1_out, fft2_in,
+                                                    nrows, ncols, nthreads);
+#elif defined(USE_FFTW_DISPATCH)
+    transpose_fftw_complex_dispatch(fft1_out, fft2_in, nrows, ncols);
+#elif defined(USE_FFTW_CYCLES)
+    transpose_fftw_complex_cycles_inplace(fft1_out, nrows, ncols);
+#elif defined(USE_FFTW_THREADS_CYCLES)
+    transpose_fftw_complex_threads_cycles_inplace(fft1_out, nrows, ncols,
+                                                  nthreads);
 #else
     #error "No matching transpose implementation found!"
 #endif
@@ -122,21 +409,106 @@ static void fft_tr_fft_1d(const FFTW_PLAN_T *p1, const FFTW_PLAN_T *p2,
     ptime_gettime_monotonic(&t2);
     PRINT_ELAPSED_TIME("fft-1d-2", &t1, &t2);
 }
+#endif
+
+#if defined(_USE_TRANSP_INPLACE)
+static void fft_ct_1d(void)
+{
+    FFTW_COMPLEX_T *mat;
+    FFTW_PLAN_T *p_fft1, *p_fft2;
+
+    // FFT 1, the transpose and FFT 2 all work in place on the same matrix
+    mat = ASSERT_FFTW_MALLOC(nrows * ncols * sizeof(*mat));
+    plans_alloc_inplace(mat, &p_fft1, nrows, ncols);
+    plans_alloc_inplace(mat, &p_fft2, ncols, nrows);
+
+    // Populate input with random data
+    ptime_gettime_monotonic(&t1);
+    FILL_RAND(mat, nrows * ncols);
+    ptime_gettime_monotonic(&t2);
+    PRINT_ELAPSED_TIME("fill", &t1, &t2);
+
+    // Execute FFT 1 -> Transpose -> FFT2
+    fft_tr_fft_1d(p_fft1, p_fft2, mat, mat);
 
+    // Cleanup
+    plans_free(p_fft2, ncols);
+    plans_free(p_fft1, nrows);
+    FFTW_FREE(mat);
+}
+#elif defined(_USE_FFT_SPLIT)
+static void fft_ct_1d(void)
+{
+    FFTW_COMPLEX_T *mat_fft1_in, *mat_fft1_out;
+    FFTW_REAL_T *fft2_in_re, *fft2_in_im, *fft2_out_re, *fft2_out_im;
+    FFTW_PLAN_T *p_fft1, p_fft2;
+    FFTW_IODIM_T dim, howmany;
+
+    // Setup FFT 1 (before transpose)
+    data_alloc(&mat_fft1_in, &mat_fft1_out, &p_fft1, nrows, ncols);
+
+    // Setup FFT 2 (after transpose): the ncols rows of length nrows in the
+    // split planes, transformed by a single plan
+    fft2_in_re = ASSERT_FFTW_MALLOC(ncols * nrows * sizeof(*fft2_in_re));
+    fft2_in_im = ASSERT_FFTW_MALLOC(ncols * nrows * sizeof(*fft2_in_im));
+    fft2_out_re = ASSERT_FFTW_MALLOC(ncols * nrows * sizeof(*fft2_out_re));
+    fft2_out_im = ASSERT_FFTW_MALLOC(ncols * nrows * sizeof(*fft2_out_im));
+    dim.n = nrows;
+    dim.is = 1;
+    dim.os = 1;
+    howmany.n = ncols;
+    howmany.is = nrows;
+    howmany.os = nrows;
+    p_fft2 = FFTW_PLAN_GURU_SPLIT(1, &dim, 1, &howmany,
+                                  fft2_in_re, fft2_in_im,
+                                  fft2_out_re, fft2_out_im, FFTW_ESTIMATE);
+
+    // Populate input with random data
+    ptime_gettime_monotonic(&t1);
+    FILL_RAND(mat_fft1_in, nrows * ncols);
+    ptime_gettime_monotonic(&t2);
+    PRINT_ELAPSED_TIME("fill", &t1, &t2);
+
+    // Execute FFT 1 -> Transpose -> FFT2
+    fft_tr_fft_1d_split(p_fft1, p_fft2, mat_fft1_out, fft2_in_re, fft2_in_im);
+
+    // Cleanup
+    FFTW_PLAN_DESTROY(p_fft2);
+    FFTW_FREE(fft2_out_im);
+    FFTW_FREE(fft2_out_re);
+    FFTW_FREE(fft2_in_im);
+    FFTW_FREE(fft2_in_re);
+    data_free(mat_fft1_in, mat_fft1_out, p_fft1, nrows);
+}
+#else
 static void fft_ct_1d(void)
 {
     FFTW_COMPLEX_T *mat_fft1_in, *mat_fft1_out, *mat_fft2_in, *mat_fft2_out;
     FFTW_PLAN_T *p_fft1, *p_fft2;
+#if defined(_USE_FFT_IQ)
+    IQ_T *iq;
+#endif
 
     // Setup FFT 1 (before transpose) and FFT 2 (after transpose)
     data_alloc(&mat_fft1_in, &mat_fft1_out, &p_fft1, nrows, ncols);
     data_alloc(&mat_fft2_in, &mat_fft2_out, &p_fft2, ncols, nrows);
 
+#if defined(_USE_FFT_IQ)
+    // Populate the raw samples with random data and ingest them
+    iq = assert_malloc_al(ncols * nrows * sizeof(*iq));
+    ptime_gettime_monotonic(&t1);
+    IQ_FILL_RAND(iq, ncols * nrows);
+    ptime_gettime_monotonic(&t2);
+    PRINT_ELAPSED_TIME("fill", &t1, &t2);
+    iq_ingest(iq, mat_fft1_in);
+    free(iq);
+#else
     // Populate input with random data
     ptime_gettime_monotonic(&t1);
     FILL_RAND(mat_fft1_in, nrows * ncols);
     ptime_gettime_monotonic(&t2);
     PRINT_ELAPSED_TIME("fill", &t1, &t2);
+#endif
 
     // Execute FFT 1 -> Transpose -> FFT2
     fft_tr_fft_1d(p_fft1, p_fft2, mat_fft1_out, mat_fft2_in);
@@ -145,11 +517,22 @@ static void fft_ct_1d(void)
     data_free(mat_fft2_in, mat_fft2_out, p_fft2, ncols);
     data_free(mat_fft1_in, mat_fft1_out, p_fft1, nrows);
 }
+#endif
 
 static void usage(const char *pname, int code)
 {
     fprintf(code ? stderr : stdout,
-            "Usage: %s -r ROWS -c COLS [-h]\n"
+            "Usage: %s -r ROWS -c COLS"
+#if defined(_USE_TRANSP_BLOCKED)
+            " [-R ROWS] [-C COLS]"
+#endif
+#if defined(_USE_TRANSP_THREADS)
+            " [-t THREADS]"
+#endif
+#if defined(_USE_FFT_PERM)
+            " [-P PERM] [-Q PERM]"
+#endif
+            " [-h]\n"
             "  -r, --rows=ROWS          Matrix row count, in [1, ULONG_MAX]\n"
             "  -c, --cols=COLS          Matrix column count, in [1, ULONG_MAX]\n"
 #if defined(_USE_TRANSP_BLOCKED)
@@ -158,6 +541,17 @@ static void usage(const char *pname, int code)
             "                           ROWS/COLS must be divisors of the corresponding\n"
             "                           matrix dimension\n"
             "                           (default=0, implies no blocking in that dimension)\n"
+#endif
+#if defined(_USE_TRANSP_THREADS)
+            "  -t, --threads=THREADS    Number of threads, in (0, ULONG_MAX] (default=1)\n"
+#endif
+#if defined(_USE_FFT_PERM)
+            "  -P, --perm-rows=PERM     Permute the FFT 1 bins that FFT 2 runs over:\n"
+            "                           fftshift, ifftshift, bitrev (COLS a power of\n"
+            "                           two), rand, or a circular shift by a signed\n"
+            "                           integer\n"
+            "  -Q, --perm-cols=PERM     Permute the input order of each FFT 2, as above\n"
+            "                           (bitrev needs ROWS a power of two)\n"
 #endif
             "  -h, --help               Print this message and exit\n",
             pname);
@@ -173,12 +567,27 @@ static size_t assert_to_size_t(const char* str, const char* pname)
     return s;
 }
 
-static const char opts_short[] = "r:c:R:C:h";
+#if defined(_USE_FFT_PERM)
+static const size_t *assert_to_perm(const char *str, size_t n,
+                                    const char *pname)
+{
+    size_t *p = assert_malloc(n * sizeof(*p));
+    if (transpose_perm_from_name(p, n, str)) {
+        usage(pname, EINVAL);
+    }
+    return p;
+}
+#endif
+
+static const char opts_short[] = "r:c:R:C:t:P:Q:h";
 static const struct option opts_long[] = {
     {"rows",        required_argument,  NULL,   'r'},
     {"cols",        required_argument,  NULL,   'c'},
     {"block-rows",  required_argument,  NULL,   'R'},
     {"block-cols",  required_argument,  NULL,   'C'},
+    {"threads",     required_argument,  NULL,   't'},
+    {"perm-rows",   required_argument,  NULL,   'P'},
+    {"perm-cols",   required_argument,  NULL,   'Q'},
     {"help",        no_argument,        NULL,   'h'},
     {0, 0, 0, 0}
 };
@@ -186,6 +595,10 @@ static const struct option opts_long[] = {
 int main(int argc, char **argv)
 {
     int c;
+#if defined(_USE_FFT_PERM)
+    const char *perm_rows_name = NULL;
+    const char *perm_cols_name = NULL;
+#endif
 
     while ((c = getopt_long(argc, argv, opts_short, opts_long, NULL)) != -1) {
         switch (c) {
@@ -202,6 +615,22 @@ int main(int argc, char **argv)
         case 'C':
             nblkcols = assert_to_size_t(optarg, argv[0]);
             break;
+#endif
+#if defined(_USE_TRANSP_THREADS)
+        case 't':
+            nthreads = assert_to_size_t(optarg, argv[0]);
+            if (!nthreads) {
+                usage(argv[0], EINVAL);
+            }
+            break;
+#endif
+#if defined(_USE_FFT_PERM)
+        case 'P':
+            perm_rows_name = optarg;
+            break;
+        case 'Q':
+            perm_cols_name = optarg;
+            break;
 #endif
         case 'h':
             usage(argv[0], 0);
@@ -226,7 +655,28 @@ int main(int argc, char **argv)
     if ((nrows % nblkrows) || (ncols % nblkcols)) {
         usage(argv[0], EINVAL);
     }
+#endif
+#if defined(_USE_FFT_PERM)
+    // the tables need the matrix dimensions, which may follow -P and -Q
+    if (perm_rows_name) {
+        perm.rows = assert_to_perm(perm_rows_name, ncols, argv[0]);
+    }
+    if (perm_cols_name) {
+        perm.cols = assert_to_perm(perm_cols_name, nrows, argv[0]);
+    }
+#if defined(_USE_FFT_PERM_TABLES)
+    perm_src = assert_malloc((nrows + ncols) * sizeof(*perm_src));
+    perm_dst = perm_src + nrows;
+    transpose_perm_tables(&perm, nrows, ncols, perm_src, perm_dst);
+#endif
 #endif
     fft_ct_1d();
+#if defined(_USE_FFT_PERM_TABLES)
+    free(perm_src);
+#endif
+#if defined(_USE_FFT_PERM)
+    free((void *)perm.cols);
+    free((void *)perm.rows);
+#endif
     return 0;
 }
@@ -11,30 +11,59 @@
 #include <getopt.h>
 #include <limits.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 
 #include "ptime.h"
 #include "transpose.h"
 #include "transpose-avx.h"
+#include "transpose-avx2.h"
+#include "transpose-dispatch.h"
 #include "transpose-threads.h"
 #include "transpose-threads-avx.h"
+#include "transpose-threads-avx2.h"
 #include "util.h"
 
 #if defined(USE_FLOAT_BLOCKED) || \
     defined(USE_DOUBLE_BLOCKED) || \
     defined(USE_FLOAT_COMPLEX_BLOCKED) || \
     defined(USE_DOUBLE_COMPLEX_BLOCKED) || \
+    defined(USE_UINT8_BLOCKED) || \
+    defined(USE_INT16_BLOCKED) || \
+    defined(USE_IQ16_FLOAT_COMPLEX_BLOCKED) || \
+    defined(USE_IQ12_FLOAT_COMPLEX_BLOCKED) || \
     defined(USE_FLOAT_THREADS_ROW_BLOCKED) || \
     defined(USE_DOUBLE_THREADS_ROW_BLOCKED) || \
     defined(USE_FLOAT_THREADS_COL_BLOCKED) || \
     defined(USE_DOUBLE_THREADS_COL_BLOCKED) || \
+    defined(USE_FLOAT_COMPLEX_THREADS_ROW_BLOCKED) || \
+    defined(USE_DOUBLE_COMPLEX_THREADS_ROW_BLOCKED) || \
+    defined(USE_FLOAT_COMPLEX_THREADS_COL_BLOCKED) || \
+    defined(USE_DOUBLE_COMPLEX_THREADS_COL_BLOCKED) || \
     defined(USE_FFTWF_BLOCKED) || \
     defined(USE_FFTW_BLOCKED)
 #define _USE_TRANSP_BLOCKED 1
 #endif
 
+#if defined(USE_FLOAT_BLOCKED2) || \
+    defined(USE_DOUBLE_BLOCKED2) || \
+    defined(USE_FLOAT_COMPLEX_BLOCKED2) || \
+    defined(USE_DOUBLE_COMPLEX_BLOCKED2) || \
+    defined(USE_FLOAT_THREADS_ROW_BLOCKED2) || \
+    defined(USE_DOUBLE_THREADS_ROW_BLOCKED2) || \
+    defined(USE_FLOAT_THREADS_COL_BLOCKED2) || \
+    defined(USE_DOUBLE_THREADS_COL_BLOCKED2) || \
+    defined(USE_DOUBLE_AVX_INTR_8X8_BLOCKED2) || \
+    defined(USE_FLOAT_AVX_INTR_16X16_BLOCKED2) || \
+    defined(USE_FLOAT_COMPLEX_AVX_INTR_8X8_BLOCKED2) || \
+    defined(USE_DOUBLE_COMPLEX_AVX_INTR_4X4_BLOCKED2)
+#define _USE_TRANSP_BLOCKED 1
+#define _USE_TRANSP_BLOCKED2 1
+#endif
+
 #if defined(USE_FLOAT_THREADS_ROW) || \
     defined(USE_DOUBLE_THREADS_ROW) || \
     defined(USE_FLOAT_THREADS_COL) || \
@@ -43,11 +72,113 @@
     defined(USE_DOUBLE_THREADS_ROW_BLOCKED) || \
     defined(USE_FLOAT_THREADS_COL_BLOCKED) || \
     defined(USE_DOUBLE_THREADS_COL_BLOCKED) || \
+    defined(USE_FLOAT_COMPLEX_THREADS_ROW) || \
+    defined(USE_DOUBLE_COMPLEX_THREADS_ROW) || \
+    defined(USE_FLOAT_COMPLEX_THREADS_COL) || \
+    defined(USE_DOUBLE_COMPLEX_THREADS_COL) || \
+    defined(USE_FLOAT_COMPLEX_THREADS_ROW_BLOCKED) || \
+    defined(USE_DOUBLE_COMPLEX_THREADS_ROW_BLOCKED) || \
+    defined(USE_FLOAT_COMPLEX_THREADS_COL_BLOCKED) || \
+    defined(USE_DOUBLE_COMPLEX_THREADS_COL_BLOCKED) || \
     defined(USE_DOUBLE_THREADS_AVX_INTR_8X8_ROW) || \
-    defined(USE_DOUBLE_THREADS_AVX_INTR_8X8_COL)
+    defined(USE_DOUBLE_THREADS_AVX_INTR_8X8_COL) || \
+    defined(USE_FLOAT_THREADS_AVX_INTR_16X16_ROW) || \
+    defined(USE_FLOAT_THREADS_AVX_INTR_16X16_COL) || \
+    defined(USE_FLOAT_COMPLEX_THREADS_AVX_INTR_8X8_ROW) || \
+    defined(USE_FLOAT_COMPLEX_THREADS_AVX_INTR_8X8_COL) || \
+    defined(USE_FFTWF_THREADS_AVX_INTR_8X8_ROW) || \
+    defined(USE_FFTWF_THREADS_AVX_INTR_8X8_COL) || \
+    defined(USE_DOUBLE_COMPLEX_THREADS_AVX_INTR_4X4_ROW) || \
+    defined(USE_DOUBLE_COMPLEX_THREADS_AVX_INTR_4X4_COL) || \
+    defined(USE_UINT8_THREADS_AVX_INTR_16X16_ROW) || \
+    defined(USE_UINT8_THREADS_AVX_INTR_16X16_COL) || \
+    defined(USE_INT16_THREADS_AVX_INTR_16X16_ROW) || \
+    defined(USE_INT16_THREADS_AVX_INTR_16X16_COL) || \
+    defined(USE_IQ16_FLOAT_COMPLEX_THREADS_AVX_INTR_8X8_ROW) || \
+    defined(USE_IQ16_FLOAT_COMPLEX_THREADS_AVX_INTR_8X8_COL) || \
+    defined(USE_IQ12_FLOAT_COMPLEX_THREADS_AVX_INTR_8X8_ROW) || \
+    defined(USE_IQ12_FLOAT_COMPLEX_THREADS_AVX_INTR_8X8_COL) || \
+    defined(USE_DOUBLE_FLOAT_THREADS_AVX_INTR_16X16_ROW) || \
+    defined(USE_DOUBLE_FLOAT_THREADS_AVX_INTR_16X16_COL) || \
+    defined(USE_DOUBLE_COMPLEX_FLOAT_COMPLEX_THREADS_AVX_INTR_8X8_ROW) || \
+    defined(USE_DOUBLE_COMPLEX_FLOAT_COMPLEX_THREADS_AVX_INTR_8X8_COL) || \
+    defined(USE_FLOAT_FP16_THREADS_AVX_INTR_16X16_ROW) || \
+    defined(USE_FLOAT_FP16_THREADS_AVX_INTR_16X16_COL) || \
+    defined(USE_FLOAT_BF16_THREADS_AVX_INTR_16X16_ROW) || \
+    defined(USE_FLOAT_BF16_THREADS_AVX_INTR_16X16_COL) || \
+    defined(USE_FLOAT_COMPLEX_FP16_COMPLEX_THREADS_AVX_INTR_8X8_ROW) || \
+    defined(USE_FLOAT_COMPLEX_FP16_COMPLEX_THREADS_AVX_INTR_8X8_COL) || \
+    defined(USE_FLOAT_COMPLEX_BF16_COMPLEX_THREADS_AVX_INTR_8X8_ROW) || \
+    defined(USE_FLOAT_COMPLEX_BF16_COMPLEX_THREADS_AVX_INTR_8X8_COL) || \
+    defined(USE_FLOAT_COMPLEX_SPLIT_THREADS_AVX_INTR_16X16_ROW) || \
+    defined(USE_FLOAT_COMPLEX_SPLIT_THREADS_AVX_INTR_16X16_COL) || \
+    defined(USE_FLOAT_SPLIT_COMPLEX_THREADS_AVX_INTR_16X16_ROW) || \
+    defined(USE_FLOAT_SPLIT_COMPLEX_THREADS_AVX_INTR_16X16_COL) || \
+    defined(USE_DOUBLE_COMPLEX_SPLIT_THREADS_AVX_INTR_8X8_ROW) || \
+    defined(USE_DOUBLE_COMPLEX_SPLIT_THREADS_AVX_INTR_8X8_COL) || \
+    defined(USE_DOUBLE_SPLIT_COMPLEX_THREADS_AVX_INTR_8X8_ROW) || \
+    defined(USE_DOUBLE_SPLIT_COMPLEX_THREADS_AVX_INTR_8X8_COL) || \
+    defined(USE_FFTW_THREADS_AVX_INTR_4X4_ROW) || \
+    defined(USE_FFTW_THREADS_AVX_INTR_4X4_COL) || \
+    defined(USE_FLOAT_THREADS_AVX2_INTR_8X8_ROW) || \
+    defined(USE_FLOAT_THREADS_AVX2_INTR_8X8_COL) || \
+    defined(USE_DOUBLE_THREADS_AVX2_INTR_4X4_ROW) || \
+    defined(USE_DOUBLE_THREADS_AVX2_INTR_4X4_COL) || \
+    defined(USE_FLOAT_THREADS_DISPATCH_ROW) || \
+    defined(USE_FLOAT_THREADS_DISPATCH_COL) || \
+    defined(USE_DOUBLE_THREADS_DISPATCH_ROW) || \
+    defined(USE_DOUBLE_THREADS_DISPATCH_COL) || \
+    defined(USE_FLOAT_THREADS_CYCLES) || \
+    defined(USE_DOUBLE_THREADS_CYCLES) || \
+    defined(USE_FLOAT_COMPLEX_THREADS_CYCLES) || \
+    defined(USE_DOUBLE_COMPLEX_THREADS_CYCLES) || \
+    defined(USE_FLOAT_THREADS_RECURSIVE) || \
+    defined(USE_DOUBLE_THREADS_RECURSIVE) || \
+    defined(USE_FLOAT_THREADS_ROW_BLOCKED2) || \
+    defined(USE_DOUBLE_THREADS_ROW_BLOCKED2) || \
+    defined(USE_FLOAT_THREADS_COL_BLOCKED2) || \
+    defined(USE_DOUBLE_THREADS_COL_BLOCKED2) || \
+    defined(USE_FLOAT_THREADS_ROW_WC) || \
+    defined(USE_FLOAT_THREADS_COL_WC) || \
+    defined(USE_DOUBLE_THREADS_ROW_WC) || \
+    defined(USE_DOUBLE_THREADS_COL_WC) || \
+    defined(USE_DOUBLE_THREADS_AVX_INTR_8X8_ROW_WC) || \
+    defined(USE_DOUBLE_THREADS_AVX_INTR_8X8_COL_WC) || \
+    defined(USE_FLOAT_THREADS_AVX_INTR_16X16_ROW_WC) || \
+    defined(USE_FLOAT_THREADS_AVX_INTR_16X16_COL_WC) || \
+    defined(USE_FLOAT_COMPLEX_THREADS_AVX_INTR_8X8_ROW_WC) || \
+    defined(USE_FLOAT_COMPLEX_THREADS_AVX_INTR_8X8_COL_WC) || \
+    defined(USE_DOUBLE_COMPLEX_THREADS_AVX_INTR_4X4_ROW_WC) || \
+    defined(USE_DOUBLE_COMPLEX_THREADS_AVX_INTR_4X4_COL_WC)
 #define _USE_TRANSP_THREADS 1
 #endif
 
+// the I/Q ingest transposes convert integer samples to float complex
+#if defined(USE_IQ16_FLOAT_COMPLEX_NAIVE) || \
+    defined(USE_IQ12_FLOAT_COMPLEX_NAIVE) || \
+    defined(USE_IQ16_FLOAT_COMPLEX_BLOCKED) || \
+    defined(USE_IQ12_FLOAT_COMPLEX_BLOCKED) || \
+    defined(USE_IQ16_FLOAT_COMPLEX_AVX_INTR_8X8) || \
+    defined(USE_IQ12_FLOAT_COMPLEX_AVX_INTR_8X8) || \
+    defined(USE_IQ16_FLOAT_COMPLEX_THREADS_AVX_INTR_8X8_ROW) || \
+    defined(USE_IQ16_FLOAT_COMPLEX_THREADS_AVX_INTR_8X8_COL) || \
+    defined(USE_IQ12_FLOAT_COMPLEX_THREADS_AVX_INTR_8X8_ROW) || \
+    defined(USE_IQ12_FLOAT_COMPLEX_THREADS_AVX_INTR_8X8_COL)
+#define _USE_TRANSP_IQ 1
+#endif
+
+// the cycle-following in-place transposes also handle rectangular matrices
+#if defined(USE_FLOAT_CYCLES) || \
+    defined(USE_DOUBLE_CYCLES) || \
+    defined(USE_FLOAT_COMPLEX_CYCLES) || \
+    defined(USE_DOUBLE_COMPLEX_CYCLES) || \
+    defined(USE_FLOAT_THREADS_CYCLES) || \
+    defined(USE_DOUBLE_THREADS_CYCLES) || \
+    defined(USE_FLOAT_COMPLEX_THREADS_CYCLES) || \
+    defined(USE_DOUBLE_COMPLEX_THREADS_CYCLES)
+#define _USE_TRANSP_INPLACE_RECT 1
+#endif
+
 #if defined(USE_FFTWF_NAIVE) || defined(USE_FFTWF_BLOCKED)
 #include <fftw3.h>
 #include "transpose-fftwf.h"
@@ -58,6 +189,30 @@
 #include "transpose-fftw.h"
 #include "util-fftw.h"
 #endif
+#if defined(USE_FFTWF_AVX_INTR_8X8) || \
+    defined(USE_FFTWF_THREADS_AVX_INTR_8X8_ROW) || \
+    defined(USE_FFTWF_THREADS_AVX_INTR_8X8_COL)
+#include <fftw3.h>
+#include "transpose-fftwf-avx.h"
+#include "util-fftwf.h"
+#endif
+#if defined(USE_FFTW_AVX_INTR_4X4) || \
+    defined(USE_FFTW_THREADS_AVX_INTR_4X4_ROW) || \
+    defined(USE_FFTW_THREADS_AVX_INTR_4X4_COL)
+#include <fftw3.h>
+#include "transpose-fftw-avx.h"
+#include "util-fftw.h"
+#endif
+#if defined(USE_FFTWF_DISPATCH)
+#include <fftw3.h>
+#include "transpose-fftwf-dispatch.h"
+#include "util-fftwf.h"
+#endif
+#if defined(USE_FFTW_DISPATCH)
+#include <fftw3.h>
+#include "transpose-fftw-dispatch.h"
+#include "util-fftw.h"
+#endif
 
 #if defined(USE_MKL_FLOAT) || defined(USE_MKL_DOUBLE) || \
     defined(USE_MKL_CMPLX8) || defined(USE_MKL_CMPLX16)
@@ -76,10 +231,191 @@ static size_t nblkrows = 0;
 static size_t nblkcols = 0;
 #endif
 
+#if defined(_USE_TRANSP_BLOCKED2)
+static size_t nsubrows = 0;
+static size_t nsubcols = 0;
+#endif
+
 #if defined(_USE_TRANSP_THREADS)
 static size_t nthreads = 1;
 #endif
 
+// USE_TRANSP_LD selects the strided/scaled *_ld variant of the transpose
+#if defined(USE_TRANSP_LD)
+static size_t lda = 0;
+static size_t ldb = 0;
+static double complex alpha = 1;
+#define TRANSP_LDA lda
+#define TRANSP_LDB ldb
+#define TRANSP_FN(fn) fn##_ld
+#define TRANSP_ARGS(datatype) A, lda, B, ldb, nrows, ncols, (datatype)alpha
+#define TRANSP_SCALE(datatype, x) ((datatype)alpha * (x))
+#elif defined(USE_TRANSP_INPLACE)
+// USE_TRANSP_INPLACE selects the square in-place *_inplace variant, which
+// transposes B onto itself; A then only keeps a copy of the input for verify
+#define TRANSP_LDA ncols
+#define TRANSP_LDB nrows
+#define TRANSP_FN(fn) fn##_inplace
+#if defined(_USE_TRANSP_INPLACE_RECT)
+#define TRANSP_ARGS(datatype) B, nrows, ncols
+#else
+#define TRANSP_ARGS(datatype) B, nrows
+#endif
+#define TRANSP_SCALE(datatype, x) (x)
+#elif defined(USE_TRANSP_PF)
+// USE_TRANSP_PF selects the prefetching *_pf variant, which takes the prefetch
+// distance (in tiles) and hint after the usual arguments
+static size_t pf_dist = 2;
+static enum transpose_pf_hint pf_hint = TRANSPOSE_PF_T0;
+#define TRANSP_LDA ncols
+#define TRANSP_LDB nrows
+#define TRANSP_FN(fn) fn##_pf
+#define TRANSP_ARGS(datatype) A, B, nrows, ncols
+#define TRANSP_PF_ARGS , pf_dist, pf_hint
+#define TRANSP_SCALE(datatype, x) (x)
+#elif defined(USE_TRANSP_EPI)
+// USE_TRANSP_EPI selects the *_epi variant of a complex transpose, which applies
+// the epilogue chosen by the options (see transpose-epi.h); windows and
+// twiddles are random, as only the cost of applying them matters here
+static double complex alpha = 1;
+static bool epi_conj = false;
+static bool epi_row_win = false;
+static bool epi_col_win = false;
+static bool epi_twiddle = false;
+static struct transpose_epi_flt_cmplx epi_flt_cmplx;
+static struct transpose_epi_dbl_cmplx epi_dbl_cmplx;
+#define TRANSP_LDA ncols
+#define TRANSP_LDB nrows
+#define TRANSP_FN(fn) fn##_epi
+#define TRANSP_EPI(datatype) \
+    _Generic((datatype)0, float complex: &epi_flt_cmplx, \
+                          double complex: &epi_dbl_cmplx)
+#define TRANSP_ARGS(datatype) A, B, nrows, ncols, TRANSP_EPI(datatype)
+// r and c are the loop indices of VERIFY_TRANSPOSE
+#define TRANSP_SCALE(datatype, x) \
+    _Generic((datatype)0, float complex: transpose_epi_flt_cmplx_apply, \
+                          double complex: transpose_epi_dbl_cmplx_apply) \
+        (TRANSP_EPI(datatype), (x), r, c, ncols)
+
+#define EPI_SETUP_DEFINE(name, cmplx_type, real_type, fn_fill, fn_fill_cmplx) \
+static void epi_setup_##name(void) \
+{ \
+    real_type *row_win = NULL, *col_win = NULL; \
+    cmplx_type *twiddle = NULL; \
+    if (epi_row_win) { \
+        row_win = assert_malloc_al(nrows * sizeof(*row_win)); \
+        fn_fill(row_win, nrows); \
+    } \
+    if (epi_col_win) { \
+        col_win = assert_malloc_al(ncols * sizeof(*col_win)); \
+        fn_fill(col_win, ncols); \
+    } \
+    if (epi_twiddle) { \
+        twiddle = assert_malloc_al(nrows * ncols * sizeof(*twiddle)); \
+        fn_fill_cmplx(twiddle, nrows * ncols); \
+    } \
+    epi_##name.alpha = alpha; \
+    epi_##name.conj = epi_conj; \
+    epi_##name.row_win = row_win; \
+    epi_##name.col_win = col_win; \
+    epi_##name.twiddle = twiddle; \
+} \
+\
+static void epi_teardown_##name(void) \
+{ \
+    free((void *)epi_##name.twiddle); \
+    free((void *)epi_##name.col_win); \
+    free((void *)epi_##name.row_win); \
+}
+
+EPI_SETUP_DEFINE(flt_cmplx, float complex, float, fill_rand_flt,
+                 fill_rand_flt_cmplx)
+EPI_SETUP_DEFINE(dbl_cmplx, double complex, double, fill_rand_dbl,
+                 fill_rand_dbl_cmplx)
+
+#define EPI_SETUP(datatype) \
+    _Generic((datatype)0, float complex: epi_setup_flt_cmplx, \
+                          double complex: epi_setup_dbl_cmplx)();
+#define EPI_TEARDOWN(datatype) \
+    _Generic((datatype)0, float complex: epi_teardown_flt_cmplx, \
+                          double complex: epi_teardown_dbl_cmplx)();
+#elif defined(USE_TRANSP_PERM)
+// USE_TRANSP_PERM selects the *_perm variant, which permutes the rows and/or
+// columns of B as chosen by the options (see transpose-perm.h)
+static struct transpose_perm perm;
+#define TRANSP_LDA ncols
+#define TRANSP_LDB nrows
+#if defined(USE_FLOAT_AVX_INTR_16X16) || defined(USE_DOUBLE_AVX_INTR_8X8) || \
+    defined(USE_FLOAT_COMPLEX_AVX_INTR_8X8) || \
+    defined(USE_DOUBLE_COMPLEX_AVX_INTR_4X4)
+// the AVX transposes take perm as gather tables, built before timing starts
+#define _USE_TRANSP_PERM_TABLES 1
+static size_t *perm_src, *perm_dst;
+#define TRANSP_FN(fn) fn##_perm_tables
+#define TRANSP_ARGS(datatype) A, B, nrows, ncols, perm_src, perm_dst
+#define PERM_TABLES_TEARDOWN() free(perm_src);
+#else
+#define TRANSP_FN(fn) fn##_perm
+#define TRANSP_ARGS(datatype) A, B, nrows, ncols, &perm
+#define PERM_TABLES_TEARDOWN()
+#endif
+#define TRANSP_SCALE(datatype, x) (x)
+#define TRANSP_B_ROW(c) TRANSPOSE_PERM_IDX(perm.rows, c)
+#define TRANSP_B_COL(r) TRANSPOSE_PERM_IDX(perm.cols, r)
+#define PERM_TEARDOWN() \
+    PERM_TABLES_TEARDOWN() \
+    free((void *)perm.cols); \
+    free((void *)perm.rows);
+#else
+#define TRANSP_LDA ncols
+#define TRANSP_LDB nrows
+#define TRANSP_FN(fn) fn
+#define TRANSP_ARGS(datatype) A, B, nrows, ncols
+#define TRANSP_SCALE(datatype, x) (x)
+#endif
+
+#if !defined(USE_TRANSP_EPI)
+#define EPI_SETUP(datatype)
+#define EPI_TEARDOWN(datatype)
+#endif
+
+#if !defined(TRANSP_PF_ARGS)
+#define TRANSP_PF_ARGS
+#endif
+
+// element (r, c) of A lands at (TRANSP_B_ROW(c), TRANSP_B_COL(r)) of B
+#if !defined(USE_TRANSP_PERM)
+#define TRANSP_B_ROW(c) (c)
+#define TRANSP_B_COL(r) (r)
+#define PERM_TEARDOWN()
+#endif
+
+#if defined(_USE_TRANSP_IQ)
+// the I/Q ingest transposes scale each converted sample by the real part of
+// alpha
+static double complex alpha = 1;
+#define TRANSP_CVT_ARGS , (float)creal(alpha)
+
+static inline float complex cvt_iq16_flt_cmplx(transpose_iq16_t v)
+{
+    return transpose_iq16_to_flt_cmplx(v, (float)creal(alpha));
+}
+
+static inline float complex cvt_iq12_flt_cmplx(transpose_iq12_t v)
+{
+    return transpose_iq12_to_flt_cmplx(v, (float)creal(alpha));
+}
+#else
+#define TRANSP_CVT_ARGS
+#endif
+
+// in-place tiles are square
+#if defined(USE_TRANSP_INPLACE)
+#define TRANSP_BLK_ARGS nblkrows
+#else
+#define TRANSP_BLK_ARGS nblkrows, nblkcols
+#endif
+
 static bool do_print = false;
 static bool do_verify = false;
 static int rc = 0;
@@ -87,73 +423,359 @@ static int rc = 0;
 #define PRINT_ELAPSED_TIME(prefix, t1, t2) \
     printf("%s (ms): %f\n", prefix, ptime_elapsed_ns(t1, t2) / 1000000.0);
 
-#define VERIFY_TRANSPOSE(A, B, fn_is_eq) { \
+#define VERIFY_TRANSPOSE(datatype, A, B, fn_is_eq) { \
     size_t r, c; \
     for (r = 0; r < nrows && !rc; r++) { \
         for (c = 0; c < ncols && !rc; c++) { \
-            rc = !fn_is_eq(A[r * ncols + c], B[c * nrows + r]); \
+            rc = !fn_is_eq(TRANSP_SCALE(datatype, A[r * TRANSP_LDA + c]), \
+                           B[TRANSP_B_ROW(c) * TRANSP_LDB + \
+                             TRANSP_B_COL(r)]); \
         } \
     } \
 }
 
+#if defined(USE_TRANSP_LD)
+// the padding at the end of each row of B is cleared and must stay untouched
+#define CLEAR_PADDING(datatype, B) \
+    memset(B, 0, ncols * ldb * sizeof(datatype));
+#define VERIFY_PADDING(B, fn_is_eq) { \
+    size_t r, c; \
+    for (c = 0; c < ncols && !rc; c++) { \
+        for (r = nrows; r < ldb && !rc; r++) { \
+            rc = !fn_is_eq(B[c * ldb + r], 0); \
+        } \
+    } \
+}
+#else
+#define CLEAR_PADDING(datatype, B)
+#define VERIFY_PADDING(B, fn_is_eq)
+#endif
+
+#if defined(USE_TRANSP_INPLACE)
 #define TRANSP_SETUP(datatype, fn_malloc, fn_fill, fn_mat_print) \
-    datatype *A = fn_malloc(nrows * ncols * sizeof(datatype)); \
     datatype *B = fn_malloc(nrows * ncols * sizeof(datatype)); \
+    datatype *A = NULL; \
     ptime_gettime_monotonic(&t1); \
-    fn_fill(A, nrows * ncols); \
+    fn_fill(B, nrows * ncols); \
     ptime_gettime_monotonic(&t2); \
     PRINT_ELAPSED_TIME("fill", &t1, &t2); \
     if (do_print) { \
         ptime_gettime_monotonic(&t1); \
         printf("In:\n"); \
-        fn_mat_print(A, nrows, ncols); \
+        fn_mat_print(B, nrows, ncols); \
+        ptime_gettime_monotonic(&t2); \
+        PRINT_ELAPSED_TIME("print", &t1, &t2); \
+    } \
+    if (do_verify) { \
+        A = fn_malloc(nrows * ncols * sizeof(datatype)); \
+        memcpy(A, B, nrows * ncols * sizeof(datatype)); \
+    } \
+    ptime_gettime_monotonic(&t1);
+#else
+#define TRANSP_SETUP(datatype, fn_malloc, fn_fill, fn_mat_print) \
+    datatype *A = fn_malloc(nrows * TRANSP_LDA * sizeof(datatype)); \
+    datatype *B = fn_malloc(ncols * TRANSP_LDB * sizeof(datatype)); \
+    CLEAR_PADDING(datatype, B); \
+    EPI_SETUP(datatype); \
+    ptime_gettime_monotonic(&t1); \
+    fn_fill(A, nrows * TRANSP_LDA); \
+    ptime_gettime_monotonic(&t2); \
+    PRINT_ELAPSED_TIME("fill", &t1, &t2); \
+    if (do_print) { \
+        ptime_gettime_monotonic(&t1); \
+        printf("In:\n"); \
+        fn_mat_print(A, nrows, TRANSP_LDA); \
         ptime_gettime_monotonic(&t2); \
         PRINT_ELAPSED_TIME("print", &t1, &t2); \
     } \
     ptime_gettime_monotonic(&t1);
+#endif
 
-#define TRANSP_TEARDOWN(A, B, fn_mat_print, fn_is_eq, fn_free) \
+#define TRANSP_TEARDOWN(datatype, A, B, fn_mat_print, fn_is_eq, fn_free) \
     ptime_gettime_monotonic(&t2); \
     PRINT_ELAPSED_TIME("transpose", &t1, &t2); \
     if (do_print) { \
         printf("Out:\n"); \
-        fn_mat_print(B, ncols, nrows); \
+        fn_mat_print(B, ncols, TRANSP_LDB); \
     } \
     if (do_verify) { \
         ptime_gettime_monotonic(&t1); \
-        VERIFY_TRANSPOSE(A, B, fn_is_eq); \
+        VERIFY_TRANSPOSE(datatype, A, B, fn_is_eq); \
+        VERIFY_PADDING(B, fn_is_eq); \
         ptime_gettime_monotonic(&t2); \
         PRINT_ELAPSED_TIME("verify", &t1, &t2); \
     } \
+    EPI_TEARDOWN(datatype); \
+    PERM_TEARDOWN(); \
     fn_free(B); \
     fn_free(A);
 
 #define TRANSP(datatype, fn_malloc, fn_free, fn_fill, fn_mat_print, fn_transp, \
                fn_is_eq) { \
     TRANSP_SETUP(datatype, fn_malloc, fn_fill, fn_mat_print); \
-    fn_transp(A, B, nrows, ncols); \
-    TRANSP_TEARDOWN(A, B, fn_mat_print, fn_is_eq, fn_free); \
+    TRANSP_FN(fn_transp)(TRANSP_ARGS(datatype) TRANSP_PF_ARGS); \
+    TRANSP_TEARDOWN(datatype, A, B, fn_mat_print, fn_is_eq, fn_free); \
 }
 
 #define TRANSP_BLOCKED(datatype, fn_malloc, fn_free, fn_fill, fn_mat_print, \
                        fn_transp, fn_is_eq) { \
     TRANSP_SETUP(datatype, fn_malloc, fn_fill, fn_mat_print); \
-    fn_transp(A, B, nrows, ncols, nblkrows, nblkcols); \
-    TRANSP_TEARDOWN(A, B, fn_mat_print, fn_is_eq, fn_free); \
+    TRANSP_FN(fn_transp)(TRANSP_ARGS(datatype), TRANSP_BLK_ARGS \
+                         TRANSP_PF_ARGS); \
+    TRANSP_TEARDOWN(datatype, A, B, fn_mat_print, fn_is_eq, fn_free); \
 }
 
 #define TRANSP_THREADED(datatype, fn_malloc, fn_free, fn_fill, fn_mat_print, \
                         fn_transp, fn_is_eq) { \
     TRANSP_SETUP(datatype, fn_malloc, fn_fill, fn_mat_print); \
-    fn_transp(A, B, nrows, ncols, nthreads); \
-    TRANSP_TEARDOWN(A, B, fn_mat_print, fn_is_eq, fn_free); \
+    TRANSP_FN(fn_transp)(TRANSP_ARGS(datatype), nthreads); \
+    TRANSP_TEARDOWN(datatype, A, B, fn_mat_print, fn_is_eq, fn_free); \
 }
 
 #define TRANSP_THREADED_BLOCKED(datatype, fn_malloc, fn_free, fn_fill, \
                                 fn_mat_print, fn_transp, fn_is_eq) { \
     TRANSP_SETUP(datatype, fn_malloc, fn_fill, fn_mat_print); \
-    fn_transp(A, B, nrows, ncols, nthreads, nblkrows, nblkcols); \
-    TRANSP_TEARDOWN(A, B, fn_mat_print, fn_is_eq, fn_free); \
+    TRANSP_FN(fn_transp)(TRANSP_ARGS(datatype), nthreads, \
+                         TRANSP_BLK_ARGS TRANSP_PF_ARGS); \
+    TRANSP_TEARDOWN(datatype, A, B, fn_mat_print, fn_is_eq, fn_free); \
+}
+
+#define TRANSP_BLOCKED2(datatype, fn_malloc, fn_free, fn_fill, fn_mat_print, \
+                        fn_transp, fn_is_eq) { \
+    TRANSP_SETUP(datatype, fn_malloc, fn_fill, fn_mat_print); \
+    TRANSP_FN(fn_transp)(TRANSP_ARGS(datatype), TRANSP_BLK_ARGS, \
+                         nsubrows, nsubcols); \
+    TRANSP_TEARDOWN(datatype, A, B, fn_mat_print, fn_is_eq, fn_free); \
+}
+
+#define TRANSP_THREADED_BLOCKED2(datatype, fn_malloc, fn_free, fn_fill, \
+                                 fn_mat_print, fn_transp, fn_is_eq) { \
+    TRANSP_SETUP(datatype, fn_malloc, fn_fill, fn_mat_print); \
+    TRANSP_FN(fn_transp)(TRANSP_ARGS(datatype), nthreads, \
+                         TRANSP_BLK_ARGS, nsubrows, nsubcols); \
+    TRANSP_TEARDOWN(datatype, A, B, fn_mat_print, fn_is_eq, fn_free); \
+}
+
+/*
+ * Converting transposes read A as in_type and write B as out_type.  fn_cvt
+ * converts one element of A the way the transpose should, for verification.
+ * They take no strides and are never in place.  The precision-converting ones
+ * are verified by round trip instead: fn_cvt is CVT_NONE and fn_is_eq checks
+ * that the element of B, widened again, is within rounding error of A.  The
+ * AVX-512 fp16 and bf16 ones are instead checked bit for bit against the scalar
+ * conversion of the naive transpose, on input with NaNs, infinities, overflow
+ * and subnormals mixed in (fill_edge_flt).
+ */
+#define CVT_NONE(x) (x)
+
+#define VERIFY_TRANSPOSE_CVT(A, B, fn_cvt, fn_is_eq) { \
+    size_t r, c; \
+    for (r = 0; r < nrows && !rc; r++) { \
+        for (c = 0; c < ncols && !rc; c++) { \
+            rc = !fn_is_eq(fn_cvt(A[r * ncols + c]), B[c * nrows + r]); \
+        } \
+    } \
+}
+
+#define TRANSP_CVT_SETUP(in_type, out_type, fn_malloc, fn_fill, \
+                         fn_mat_print) \
+    in_type *A = fn_malloc(nrows * ncols * sizeof(in_type)); \
+    out_type *B = fn_malloc(ncols * nrows * sizeof(out_type)); \
+    ptime_gettime_monotonic(&t1); \
+    fn_fill(A, nrows * ncols); \
+    ptime_gettime_monotonic(&t2); \
+    PRINT_ELAPSED_TIME("fill", &t1, &t2); \
+    if (do_print) { \
+        ptime_gettime_monotonic(&t1); \
+        printf("In:\n"); \
+        fn_mat_print(A, nrows, ncols); \
+        ptime_gettime_monotonic(&t2); \
+        PRINT_ELAPSED_TIME("print", &t1, &t2); \
+    } \
+    ptime_gettime_monotonic(&t1);
+
+#define TRANSP_CVT_TEARDOWN(A, B, fn_mat_print, fn_cvt, fn_is_eq, fn_free) \
+    ptime_gettime_monotonic(&t2); \
+    PRINT_ELAPSED_TIME("transpose", &t1, &t2); \
+    if (do_print) { \
+        printf("Out:\n"); \
+        fn_mat_print(B, ncols, nrows); \
+    } \
+    if (do_verify) { \
+        ptime_gettime_monotonic(&t1); \
+        VERIFY_TRANSPOSE_CVT(A, B, fn_cvt, fn_is_eq); \
+        ptime_gettime_monotonic(&t2); \
+        PRINT_ELAPSED_TIME("verify", &t1, &t2); \
+    } \
+    fn_free(B); \
+    fn_free(A);
+
+#define TRANSP_CVT(in_type, out_type, fn_malloc, fn_free, fn_fill, \
+                   fn_mat_print_in, fn_mat_print_out, fn_transp, fn_cvt, \
+                   fn_is_eq) { \
+    TRANSP_CVT_SETUP(in_type, out_type, fn_malloc, fn_fill, fn_mat_print_in); \
+    fn_transp(A, B, nrows, ncols TRANSP_CVT_ARGS); \
+    TRANSP_CVT_TEARDOWN(A, B, fn_mat_print_out, fn_cvt, fn_is_eq, fn_free); \
+}
+
+#define TRANSP_CVT_BLOCKED(in_type, out_type, fn_malloc, fn_free, fn_fill, \
+                           fn_mat_print_in, fn_mat_print_out, fn_transp, \
+                           fn_cvt, fn_is_eq) { \
+    TRANSP_CVT_SETUP(in_type, out_type, fn_malloc, fn_fill, fn_mat_print_in); \
+    fn_transp(A, B, nrows, ncols TRANSP_CVT_ARGS, nblkrows, nblkcols); \
+    TRANSP_CVT_TEARDOWN(A, B, fn_mat_print_out, fn_cvt, fn_is_eq, fn_free); \
+}
+
+#define TRANSP_CVT_THREADED(in_type, out_type, fn_malloc, fn_free, fn_fill, \
+                            fn_mat_print_in, fn_mat_print_out, fn_transp, \
+                            fn_cvt, fn_is_eq) { \
+    TRANSP_CVT_SETUP(in_type, out_type, fn_malloc, fn_fill, fn_mat_print_in); \
+    fn_transp(A, B, nrows, ncols TRANSP_CVT_ARGS, nthreads); \
+    TRANSP_CVT_TEARDOWN(A, B, fn_mat_print_out, fn_cvt, fn_is_eq, fn_free); \
+}
+
+/*
+ * Split-complex transposes: TO_SPLIT reads an interleaved cmplx_type A and
+ * writes its real and imaginary parts as real_type planes B_re and B_im, and
+ * FROM_SPLIT does the reverse.  Both parts are verified with fn_is_eq.
+ */
+#define VERIFY_TRANSPOSE_TO_SPLIT(A, B_re, B_im, fn_re, fn_im, fn_is_eq) { \
+    size_t r, c; \
+    for (r = 0; r < nrows && !rc; r++) { \
+        for (c = 0; c < ncols && !rc; c++) { \
+            rc = !fn_is_eq(fn_re(A[r * ncols + c]), B_re[c * nrows + r]) || \
+                 !fn_is_eq(fn_im(A[r * ncols + c]), B_im[c * nrows + r]); \
+        } \
+    } \
+}
+
+#define VERIFY_TRANSPOSE_FROM_SPLIT(A_re, A_im, B, fn_re, fn_im, fn_is_eq) { \
+    size_t r, c; \
+    for (r = 0; r < nrows && !rc; r++) { \
+        for (c = 0; c < ncols && !rc; c++) { \
+            rc = !fn_is_eq(A_re[r * ncols + c], fn_re(B[c * nrows + r])) || \
+                 !fn_is_eq(A_im[r * ncols + c], fn_im(B[c * nrows + r])); \
+        } \
+    } \
+}
+
+#define TRANSP_TO_SPLIT_SETUP(real_type, cmplx_type, fn_malloc, fn_fill, \
+                              fn_mat_print) \
+    cmplx_type *A = fn_malloc(nrows * ncols * sizeof(cmplx_type)); \
+    real_type *B_re = fn_malloc(ncols * nrows * sizeof(real_type)); \
+    real_type *B_im = fn_malloc(ncols * nrows * sizeof(real_type)); \
+    ptime_gettime_monotonic(&t1); \
+    fn_fill(A, nrows * ncols); \
+    ptime_gettime_monotonic(&t2); \
+    PRINT_ELAPSED_TIME("fill", &t1, &t2); \
+    if (do_print) { \
+        ptime_gettime_monotonic(&t1); \
+        printf("In:\n"); \
+        fn_mat_print(A, nrows, ncols); \
+        ptime_gettime_monotonic(&t2); \
+        PRINT_ELAPSED_TIME("print", &t1, &t2); \
+    } \
+    ptime_gettime_monotonic(&t1);
+
+#define TRANSP_TO_SPLIT_TEARDOWN(fn_mat_print, fn_re, fn_im, fn_is_eq, \
+                                 fn_free) \
+    ptime_gettime_monotonic(&t2); \
+    PRINT_ELAPSED_TIME("transpose", &t1, &t2); \
+    if (do_print) { \
+        printf("Out (real):\n"); \
+        fn_mat_print(B_re, ncols, nrows); \
+        printf("Out (imag):\n"); \
+        fn_mat_print(B_im, ncols, nrows); \
+    } \
+    if (do_verify) { \
+        ptime_gettime_monotonic(&t1); \
+        VERIFY_TRANSPOSE_TO_SPLIT(A, B_re, B_im, fn_re, fn_im, fn_is_eq); \
+        ptime_gettime_monotonic(&t2); \
+        PRINT_ELAPSED_TIME("verify", &t1, &t2); \
+    } \
+    fn_free(B_im); \
+    fn_free(B_re); \
+    fn_free(A);
+
+#define TRANSP_FROM_SPLIT_SETUP(real_type, cmplx_type, fn_malloc, fn_fill, \
+                                fn_mat_print) \
+    real_type *A_re = fn_malloc(nrows * ncols * sizeof(real_type)); \
+    real_type *A_im = fn_malloc(nrows * ncols * sizeof(real_type)); \
+    cmplx_type *B = fn_malloc(ncols * nrows * sizeof(cmplx_type)); \
+    ptime_gettime_monotonic(&t1); \
+    fn_fill(A_re, nrows * ncols); \
+    fn_fill(A_im, nrows * ncols); \
+    ptime_gettime_monotonic(&t2); \
+    PRINT_ELAPSED_TIME("fill", &t1, &t2); \
+    if (do_print) { \
+        ptime_gettime_monotonic(&t1); \
+        printf("In (real):\n"); \
+        fn_mat_print(A_re, nrows, ncols); \
+        printf("In (imag):\n"); \
+        fn_mat_print(A_im, nrows, ncols); \
+        ptime_gettime_monotonic(&t2); \
+        PRINT_ELAPSED_TIME("print", &t1, &t2); \
+    } \
+    ptime_gettime_monotonic(&t1);
+
+#define TRANSP_FROM_SPLIT_TEARDOWN(fn_mat_print, fn_re, fn_im, fn_is_eq, \
+                                   fn_free) \
+    ptime_gettime_monotonic(&t2); \
+    PRINT_ELAPSED_TIME("transpose", &t1, &t2); \
+    if (do_print) { \
+        printf("Out:\n"); \
+        fn_mat_print(B, ncols, nrows); \
+    } \
+    if (do_verify) { \
+        ptime_gettime_monotonic(&t1); \
+        VERIFY_TRANSPOSE_FROM_SPLIT(A_re, A_im, B, fn_re, fn_im, fn_is_eq); \
+        ptime_gettime_monotonic(&t2); \
+        PRINT_ELAPSED_TIME("verify", &t1, &t2); \
+    } \
+    fn_free(B); \
+    fn_free(A_im); \
+    fn_free(A_re);
+
+#define TRANSP_TO_SPLIT(real_type, cmplx_type, fn_malloc, fn_free, fn_fill, \
+                        fn_mat_print_real, fn_mat_print_cmplx, fn_transp, \
+                        fn_re, fn_im, fn_is_eq) { \
+    TRANSP_TO_SPLIT_SETUP(real_type, cmplx_type, fn_malloc, fn_fill, \
+                          fn_mat_print_cmplx); \
+    fn_transp(A, B_re, B_im, nrows, ncols); \
+    TRANSP_TO_SPLIT_TEARDOWN(fn_mat_print_real, fn_re, fn_im, fn_is_eq, \
+                             fn_free); \
+}
+
+#define TRANSP_TO_SPLIT_THREADED(real_type, cmplx_type, fn_malloc, fn_free, \
+                                 fn_fill, fn_mat_print_real, \
+                                 fn_mat_print_cmplx, fn_transp, fn_re, fn_im, \
+                                 fn_is_eq) { \
+    TRANSP_TO_SPLIT_SETUP(real_type, cmplx_type, fn_malloc, fn_fill, \
+                          fn_mat_print_cmplx); \
+    fn_transp(A, B_re, B_im, nrows, ncols, nthreads); \
+    TRANSP_TO_SPLIT_TEARDOWN(fn_mat_print_real, fn_re, fn_im, fn_is_eq, \
+                             fn_free); \
+}
+
+#define TRANSP_FROM_SPLIT(real_type, cmplx_type, fn_malloc, fn_free, fn_fill, \
+                          fn_mat_print_real, fn_mat_print_cmplx, fn_transp, \
+                          fn_re, fn_im, fn_is_eq) { \
+    TRANSP_FROM_SPLIT_SETUP(real_type, cmplx_type, fn_malloc, fn_fill, \
+                            fn_mat_print_real); \
+    fn_transp(A_re, A_im, B, nrows, ncols); \
+    TRANSP_FROM_SPLIT_TEARDOWN(fn_mat_print_cmplx, fn_re, fn_im, fn_is_eq, \
+                               fn_free); \
+}
+
+#define TRANSP_FROM_SPLIT_THREADED(real_type, cmplx_type, fn_malloc, fn_free, \
+                                   fn_fill, fn_mat_print_real, \
+                                   fn_mat_print_cmplx, fn_transp, fn_re, \
+                                   fn_im, fn_is_eq) { \
+    TRANSP_FROM_SPLIT_SETUP(real_type, cmplx_type, fn_malloc, fn_fill, \
+                            fn_mat_print_real); \
+    fn_transp(A_re, A_im, B, nrows, ncols, nthreads); \
+    TRANSP_FROM_SPLIT_TEARDOWN(fn_mat_print_cmplx, fn_re, fn_im, fn_is_eq, \
+                               fn_free); \
 }
 
 static void usage(const char *pname, int code)
@@ -163,21 +785,84 @@ static void usage(const char *pname, int code)
 #if defined(_USE_TRANSP_BLOCKED)
             " [-R ROWS] [-C COLS]"
 #endif
+#if defined(_USE_TRANSP_BLOCKED2)
+            " [-s ROWS] [-S COLS]"
+#endif
 #if defined(_USE_TRANSP_THREADS)
             " [-t THREADS]"
+#endif
+#if defined(USE_TRANSP_LD)
+            " [-l LDA] [-L LDB] [-a ALPHA]"
+#endif
+#if defined(_USE_TRANSP_IQ)
+            " [-a SCALE]"
+#endif
+#if defined(USE_TRANSP_EPI)
+            " [-a ALPHA] [-j] [-w] [-W] [-T]"
+#endif
+#if defined(USE_TRANSP_PF)
+            " [-D DIST] [-H HINT]"
+#endif
+#if defined(USE_TRANSP_PERM)
+            " [-P PERM] [-Q PERM]"
 #endif
             " [-p] [-v] [-h]\n"
             "  -r, --rows=ROWS          Matrix row count, in [1, ULONG_MAX]\n"
             "  -c, --cols=COLS          Matrix column count, in [1, ULONG_MAX]\n"
+#if defined(USE_TRANSP_INPLACE) && !defined(_USE_TRANSP_INPLACE_RECT)
+            "                           In-place transposes need ROWS == COLS\n"
+#endif
 #if defined(_USE_TRANSP_BLOCKED)
             "  -R, --block-rows=ROWS    Rows per block, in [0, ULONG_MAX]\n"
             "  -C, --block-cols=COLS    Columns per block, in [0, ULONG_MAX]\n"
             "                           ROWS/COLS must be divisors of the corresponding\n"
             "                           matrix dimension\n"
             "                           (default=0, implies no blocking in that dimension)\n"
+#if defined(USE_TRANSP_INPLACE)
+            "                           In-place tiles are square, so ROWS and COLS must\n"
+            "                           match\n"
+#endif
+#endif
+#if defined(_USE_TRANSP_BLOCKED2)
+            "                           Outer blocks bound the pages in use: keep\n"
+            "                           ROWS + COLS within the DTLB entries\n"
+            "  -s, --sub-rows=ROWS      Rows per inner tile, in [0, ULONG_MAX]\n"
+            "  -S, --sub-cols=COLS      Columns per inner tile, in [0, ULONG_MAX]\n"
+            "                           ROWS/COLS must be divisors of the corresponding\n"
+            "                           block dimension\n"
+            "                           (default=0, implies one tile per block)\n"
 #endif
 #if defined(_USE_TRANSP_THREADS)
             "  -t, --threads=THREADS    Number of threads, in (0, ULONG_MAX] (default=1)\n"
+#endif
+#if defined(USE_TRANSP_LD)
+            "  -l, --lda=LDA            Input row stride, in [COLS, ULONG_MAX] (default=COLS)\n"
+            "  -L, --ldb=LDB            Output row stride, in [ROWS, ULONG_MAX] (default=ROWS)\n"
+            "  -a, --alpha=RE[,IM]      Output scale factor; IM is ignored for real data\n"
+            "                           (default=1)\n"
+#endif
+#if defined(_USE_TRANSP_IQ)
+            "  -a, --alpha=SCALE        Scale factor for the converted samples (default=1)\n"
+#endif
+#if defined(USE_TRANSP_EPI)
+            "  -a, --alpha=RE[,IM]      Output scale factor (default=1)\n"
+            "  -j, --conj               Conjugate the input (Hermitian transpose)\n"
+            "  -w, --row-window         Multiply by a per-row window\n"
+            "  -W, --col-window         Multiply by a per-column window\n"
+            "  -T, --twiddle            Multiply by a twiddle table\n"
+#endif
+#if defined(USE_TRANSP_PF)
+            "  -D, --pf-dist=DIST       Prefetch distance in tiles, in [0, ULONG_MAX]\n"
+            "                           (default=2, 0 disables prefetching)\n"
+            "  -H, --pf-hint=HINT       Prefetch hint: t0, nta or w (prefetchw for the\n"
+            "                           destination) (default=t0)\n"
+#endif
+#if defined(USE_TRANSP_PERM)
+            "  -P, --perm-rows=PERM     Permute the rows of the output: fftshift,\n"
+            "                           ifftshift, bitrev (COLS a power of two), rand,\n"
+            "                           or a circular shift by a signed integer\n"
+            "  -Q, --perm-cols=PERM     Permute the columns of the output, as above\n"
+            "                           (bitrev needs ROWS a power of two)\n"
 #endif
             "  -p, --print              Print matrices\n"
             "  -v, --verify             Verify transpose\n"
@@ -195,19 +880,64 @@ static size_t assert_to_size_t(const char* str, const char* pname)
     return s;
 }
 
-static const char opts_short[] = "r:c:R:C:t:pvh";
+static const char opts_short[] = "r:c:R:C:s:S:t:l:L:a:D:H:P:Q:jwWTpvh";
 static const struct option opts_long[] = {
     {"rows",        required_argument,  NULL,   'r'},
     {"cols",        required_argument,  NULL,   'c'},
     {"block-rows",  required_argument,  NULL,   'R'},
     {"block-cols",  required_argument,  NULL,   'C'},
+    {"sub-rows",    required_argument,  NULL,   's'},
+    {"sub-cols",    required_argument,  NULL,   'S'},
     {"threads",     required_argument,  NULL,   't'},
+    {"lda",         required_argument,  NULL,   'l'},
+    {"ldb",         required_argument,  NULL,   'L'},
+    {"alpha",       required_argument,  NULL,   'a'},
+    {"pf-dist",     required_argument,  NULL,   'D'},
+    {"pf-hint",     required_argument,  NULL,   'H'},
+    {"perm-rows",   required_argument,  NULL,   'P'},
+    {"perm-cols",   required_argument,  NULL,   'Q'},
+    {"conj",        no_argument,        NULL,   'j'},
+    {"row-window",  no_argument,        NULL,   'w'},
+    {"col-window",  no_argument,        NULL,   'W'},
+    {"twiddle",     no_argument,        NULL,   'T'},
     {"print",       no_argument,        NULL,   'p'},
     {"verify",      no_argument,        NULL,   'v'},
     {"help",        no_argument,        NULL,   'h'},
     {0, 0, 0, 0}
 };
 
+#if defined(USE_TRANSP_LD) || defined(_USE_TRANSP_IQ) || \
+    defined(USE_TRANSP_EPI)
+static double complex assert_to_cmplx(const char* str, const char* pname)
+{
+    char *end;
+    double re, im = 0;
+    re = strtod(str, &end);
+    if (*end == ',') {
+        im = strtod(end + 1, &end);
+    }
+    if (end == str || *end != '\0') {
+        usage(pname, EINVAL);
+    }
+    return CMPLX(re, im);
+}
+#endif
+
+#if defined(USE_TRANSP_PERM)
+static const size_t *assert_to_perm(const char *str, size_t n,
+                                    const char *pname)
+{
+    size_t *p = assert_malloc(n * sizeof(*p));
+    if (transpose_perm_from_name(p, n, str)) {
+        usage(pname, EINVAL);
+    }
+    return p;
+}
+
+static const char *perm_rows_name = NULL;
+static const char *perm_cols_name = NULL;
+#endif
+
 static void parse_args(int argc, char **argv)
 {
     int c;
@@ -227,6 +957,14 @@ static void parse_args(int argc, char **argv)
             nblkcols = assert_to_size_t(optarg, argv[0]);
             break;
 #endif
+#if defined(_USE_TRANSP_BLOCKED2)
+        case 's':
+            nsubrows = assert_to_size_t(optarg, argv[0]);
+            break;
+        case 'S':
+            nsubcols = assert_to_size_t(optarg, argv[0]);
+            break;
+#endif
 #if defined(_USE_TRANSP_THREADS)
         case 't':
             nthreads = assert_to_size_t(optarg, argv[0]);
@@ -234,6 +972,58 @@ static void parse_args(int argc, char **argv)
                 usage(argv[0], EINVAL);
             }
             break;
+#endif
+#if defined(USE_TRANSP_LD) || defined(_USE_TRANSP_IQ) || \
+    defined(USE_TRANSP_EPI)
+        case 'a':
+            alpha = assert_to_cmplx(optarg, argv[0]);
+#if defined(_USE_TRANSP_IQ)
+            // the I/Q conversions only take a real scale
+            if (cimag(alpha) != 0) {
+                usage(argv[0], EINVAL);
+            }
+#endif
+            break;
+#endif
+#if defined(USE_TRANSP_LD)
+        case 'l':
+            lda = assert_to_size_t(optarg, argv[0]);
+            break;
+        case 'L':
+            ldb = assert_to_size_t(optarg, argv[0]);
+            break;
+#endif
+#if defined(USE_TRANSP_EPI)
+        case 'j':
+            epi_conj = true;
+            break;
+        case 'w':
+            epi_row_win = true;
+            break;
+        case 'W':
+            epi_col_win = true;
+            break;
+        case 'T':
+            epi_twiddle = true;
+            break;
+#endif
+#if defined(USE_TRANSP_PF)
+        case 'D':
+            pf_dist = assert_to_size_t(optarg, argv[0]);
+            break;
+        case 'H':
+            if (transpose_pf_hint_from_name(optarg, &pf_hint)) {
+                usage(argv[0], EINVAL);
+            }
+            break;
+#endif
+#if defined(USE_TRANSP_PERM)
+        case 'P':
+            perm_rows_name = optarg;
+            break;
+        case 'Q':
+            perm_cols_name = optarg;
+            break;
 #endif
         case 'p':
             do_print = true;
@@ -252,6 +1042,37 @@ static void parse_args(int argc, char **argv)
     if (!nrows || !ncols) {
         usage(argv[0], EINVAL);
     }
+#if defined(USE_TRANSP_INPLACE) && !defined(_USE_TRANSP_INPLACE_RECT)
+    if (nrows != ncols) {
+        usage(argv[0], EINVAL);
+    }
+#endif
+#if defined(USE_TRANSP_PERM)
+    // the tables need the matrix dimensions, which may follow -P and -Q
+    if (perm_rows_name) {
+        perm.rows = assert_to_perm(perm_rows_name, ncols, argv[0]);
+    }
+    if (perm_cols_name) {
+        perm.cols = assert_to_perm(perm_cols_name, nrows, argv[0]);
+    }
+#if defined(_USE_TRANSP_PERM_TABLES)
+    perm_src = assert_malloc((nrows + ncols) * sizeof(*perm_src));
+    perm_dst = perm_src + nrows;
+    transpose_perm_tables(&perm, nrows, ncols, perm_src, perm_dst);
+#endif
+#endif
+#if defined(USE_TRANSP_LD)
+    // fall back to dense strides
+    if (!lda) {
+        lda = ncols;
+    }
+    if (!ldb) {
+        ldb = nrows;
+    }
+    if (lda < ncols || ldb < nrows) {
+        usage(argv[0], EINVAL);
+    }
+#endif
 #if defined(_USE_TRANSP_BLOCKED)
     // fall back to default values
     if (!nblkrows) {
@@ -264,6 +1085,22 @@ static void parse_args(int argc, char **argv)
     if ((nrows % nblkrows) || (ncols % nblkcols)) {
         usage(argv[0], EINVAL);
     }
+#if defined(USE_TRANSP_INPLACE)
+    if (nblkrows != nblkcols) {
+        usage(argv[0], EINVAL);
+    }
+#endif
+#endif
+#if defined(_USE_TRANSP_BLOCKED2)
+    if (!nsubrows) {
+        nsubrows = nblkrows;
+    }
+    if (!nsubcols) {
+        nsubcols = nblkcols;
+    }
+    if ((nblkrows % nsubrows) || (nblkcols % nsubcols)) {
+        usage(argv[0], EINVAL);
+    }
 #endif
 }
 
@@ -300,6 +1137,114 @@ int main(int argc, char **argv)
     TRANSP_BLOCKED(double complex, assert_malloc_al, free,
                    fill_rand_dbl_cmplx, matrix_print_dbl_cmplx,
                    transpose_dbl_cmplx_blocked, is_eq_dbl_cmplx);
+#elif defined(USE_UINT8_NAIVE)
+    TRANSP(uint8_t, assert_malloc_al, free,
+           fill_rand_u8, matrix_print_u8, transpose_u8_naive, is_eq_u8);
+#elif defined(USE_INT16_NAIVE)
+    TRANSP(int16_t, assert_malloc_al, free,
+           fill_rand_i16, matrix_print_i16, transpose_i16_naive, is_eq_i16);
+#elif defined(USE_UINT8_BLOCKED)
+    TRANSP_BLOCKED(uint8_t, assert_malloc_al, free,
+                   fill_rand_u8, matrix_print_u8, transpose_u8_blocked,
+                   is_eq_u8);
+#elif defined(USE_INT16_BLOCKED)
+    TRANSP_BLOCKED(int16_t, assert_malloc_al, free,
+                   fill_rand_i16, matrix_print_i16, transpose_i16_blocked,
+                   is_eq_i16);
+#elif defined(USE_FLOAT_BLOCKED2)
+    TRANSP_BLOCKED2(float, assert_malloc_al, free,
+                    fill_rand_flt, matrix_print_flt,
+                    transpose_flt_blocked2, is_eq_flt);
+#elif defined(USE_DOUBLE_BLOCKED2)
+    TRANSP_BLOCKED2(double, assert_malloc_al, free,
+                    fill_rand_dbl, matrix_print_dbl,
+                    transpose_dbl_blocked2, is_eq_dbl);
+#elif defined(USE_FLOAT_COMPLEX_BLOCKED2)
+    TRANSP_BLOCKED2(float complex, assert_malloc_al, free,
+                    fill_rand_flt_cmplx, matrix_print_flt_cmplx,
+                    transpose_flt_cmplx_blocked2, is_eq_flt_cmplx);
+#elif defined(USE_DOUBLE_COMPLEX_BLOCKED2)
+    TRANSP_BLOCKED2(double complex, assert_malloc_al, free,
+                    fill_rand_dbl_cmplx, matrix_print_dbl_cmplx,
+                    transpose_dbl_cmplx_blocked2, is_eq_dbl_cmplx);
+#elif defined(USE_FLOAT_RECURSIVE)
+    TRANSP(float, assert_malloc_al, free,
+           fill_rand_flt, matrix_print_flt,
+           transpose_flt_recursive, is_eq_flt);
+#elif defined(USE_DOUBLE_RECURSIVE)
+    TRANSP(double, assert_malloc_al, free,
+           fill_rand_dbl, matrix_print_dbl,
+           transpose_dbl_recursive, is_eq_dbl);
+#elif defined(USE_FLOAT_COMPLEX_RECURSIVE)
+    TRANSP(float complex, assert_malloc_al, free,
+           fill_rand_flt_cmplx, matrix_print_flt_cmplx,
+           transpose_flt_cmplx_recursive, is_eq_flt_cmplx);
+#elif defined(USE_DOUBLE_COMPLEX_RECURSIVE)
+    TRANSP(double complex, assert_malloc_al, free,
+           fill_rand_dbl_cmplx, matrix_print_dbl_cmplx,
+           transpose_dbl_cmplx_recursive, is_eq_dbl_cmplx);
+#elif defined(USE_FLOAT_MORTON)
+    TRANSP(float, assert_malloc_al, free,
+           fill_rand_flt, matrix_print_flt,
+           transpose_flt_morton, is_eq_flt);
+#elif defined(USE_DOUBLE_MORTON)
+    TRANSP(double, assert_malloc_al, free,
+           fill_rand_dbl, matrix_print_dbl,
+           transpose_dbl_morton, is_eq_dbl);
+#elif defined(USE_FLOAT_COMPLEX_MORTON)
+    TRANSP(float complex, assert_malloc_al, free,
+           fill_rand_flt_cmplx, matrix_print_flt_cmplx,
+           transpose_flt_cmplx_morton, is_eq_flt_cmplx);
+#elif defined(USE_DOUBLE_COMPLEX_MORTON)
+    TRANSP(double complex, assert_malloc_al, free,
+           fill_rand_dbl_cmplx, matrix_print_dbl_cmplx,
+           transpose_dbl_cmplx_morton, is_eq_dbl_cmplx);
+#elif defined(USE_FLOAT_WC)
+    TRANSP(float, assert_malloc_al, free,
+           fill_rand_flt, matrix_print_flt,
+           transpose_flt_wc, is_eq_flt);
+#elif defined(USE_DOUBLE_WC)
+    TRANSP(double, assert_malloc_al, free,
+           fill_rand_dbl, matrix_print_dbl,
+           transpose_dbl_wc, is_eq_dbl);
+#elif defined(USE_FLOAT_COMPLEX_WC)
+    TRANSP(float complex, assert_malloc_al, free,
+           fill_rand_flt_cmplx, matrix_print_flt_cmplx,
+           transpose_flt_cmplx_wc, is_eq_flt_cmplx);
+#elif defined(USE_DOUBLE_COMPLEX_WC)
+    TRANSP(double complex, assert_malloc_al, free,
+           fill_rand_dbl_cmplx, matrix_print_dbl_cmplx,
+           transpose_dbl_cmplx_wc, is_eq_dbl_cmplx);
+#elif defined(USE_FLOAT_CYCLES)
+    TRANSP(float, assert_malloc_al, free,
+           fill_rand_flt, matrix_print_flt, transpose_flt_cycles, is_eq_flt);
+#elif defined(USE_DOUBLE_CYCLES)
+    TRANSP(double, assert_malloc_al, free,
+           fill_rand_dbl, matrix_print_dbl, transpose_dbl_cycles, is_eq_dbl);
+#elif defined(USE_FLOAT_COMPLEX_CYCLES)
+    TRANSP(float complex, assert_malloc_al, free,
+           fill_rand_flt_cmplx, matrix_print_flt_cmplx,
+           transpose_flt_cmplx_cycles, is_eq_flt_cmplx);
+#elif defined(USE_DOUBLE_COMPLEX_CYCLES)
+    TRANSP(double complex, assert_malloc_al, free,
+           fill_rand_dbl_cmplx, matrix_print_dbl_cmplx,
+           transpose_dbl_cmplx_cycles, is_eq_dbl_cmplx);
+#elif defined(USE_FLOAT_THREADS_CYCLES)
+    TRANSP_THREADED(float, assert_malloc_al, free,
+                    fill_rand_flt, matrix_print_flt,
+                    transpose_flt_threads_cycles, is_eq_flt);
+#elif defined(USE_DOUBLE_THREADS_CYCLES)
+    TRANSP_THREADED(double, assert_malloc_al, free,
+                    fill_rand_dbl, matrix_print_dbl,
+                    transpose_dbl_threads_cycles, is_eq_dbl);
+#elif defined(USE_FLOAT_COMPLEX_THREADS_CYCLES)
+    TRANSP_THREADED(float complex, assert_malloc_al, free,
+                    fill_rand_flt_cmplx, matrix_print_flt_cmplx,
+                    transpose_flt_cmplx_threads_cycles, is_eq_flt_cmplx);
+#elif defined(USE_DOUBLE_COMPLEX_THREADS_CYCLES)
+    TRANSP_THREADED(double complex, assert_malloc_al, free,
+                    fill_rand_dbl_cmplx, matrix_print_dbl_cmplx,
+                    transpose_dbl_cmplx_threads_cycles, is_eq_dbl_cmplx);
 #elif defined(USE_FLOAT_THREADS_ROW)
     TRANSP_THREADED(float, assert_malloc_al, free,
                     fill_rand_flt, matrix_print_flt, transpose_flt_threads_row,
@@ -332,6 +1277,58 @@ int main(int argc, char **argv)
     TRANSP_THREADED_BLOCKED(double, assert_malloc_al, free,
                             fill_rand_dbl, matrix_print_dbl,
                             transpose_dbl_threads_col_blocked, is_eq_dbl);
+#elif defined(USE_FLOAT_COMPLEX_THREADS_ROW)
+    TRANSP_THREADED(float complex, assert_malloc_al, free,
+                    fill_rand_flt_cmplx, matrix_print_flt_cmplx,
+                    transpose_flt_cmplx_threads_row, is_eq_flt_cmplx);
+#elif defined(USE_FLOAT_COMPLEX_THREADS_COL)
+    TRANSP_THREADED(float complex, assert_malloc_al, free,
+                    fill_rand_flt_cmplx, matrix_print_flt_cmplx,
+                    transpose_flt_cmplx_threads_col, is_eq_flt_cmplx);
+#elif defined(USE_DOUBLE_COMPLEX_THREADS_ROW)
+    TRANSP_THREADED(double complex, assert_malloc_al, free,
+                    fill_rand_dbl_cmplx, matrix_print_dbl_cmplx,
+                    transpose_dbl_cmplx_threads_row, is_eq_dbl_cmplx);
+#elif defined(USE_DOUBLE_COMPLEX_THREADS_COL)
+    TRANSP_THREADED(double complex, assert_malloc_al, free,
+                    fill_rand_dbl_cmplx, matrix_print_dbl_cmplx,
+                    transpose_dbl_cmplx_threads_col, is_eq_dbl_cmplx);
+#elif defined(USE_FLOAT_COMPLEX_THREADS_ROW_BLOCKED)
+    TRANSP_THREADED_BLOCKED(float complex, assert_malloc_al, free,
+                            fill_rand_flt_cmplx, matrix_print_flt_cmplx,
+                            transpose_flt_cmplx_threads_row_blocked,
+                            is_eq_flt_cmplx);
+#elif defined(USE_FLOAT_COMPLEX_THREADS_COL_BLOCKED)
+    TRANSP_THREADED_BLOCKED(float complex, assert_malloc_al, free,
+                            fill_rand_flt_cmplx, matrix_print_flt_cmplx,
+                            transpose_flt_cmplx_threads_col_blocked,
+                            is_eq_flt_cmplx);
+#elif defined(USE_DOUBLE_COMPLEX_THREADS_ROW_BLOCKED)
+    TRANSP_THREADED_BLOCKED(double complex, assert_malloc_al, free,
+                            fill_rand_dbl_cmplx, matrix_print_dbl_cmplx,
+                            transpose_dbl_cmplx_threads_row_blocked,
+                            is_eq_dbl_cmplx);
+#elif defined(USE_DOUBLE_COMPLEX_THREADS_COL_BLOCKED)
+    TRANSP_THREADED_BLOCKED(double complex, assert_malloc_al, free,
+                            fill_rand_dbl_cmplx, matrix_print_dbl_cmplx,
+                            transpose_dbl_cmplx_threads_col_blocked,
+                            is_eq_dbl_cmplx);
+#elif defined(USE_FLOAT_THREADS_ROW_WC)
+    TRANSP_THREADED(float, assert_malloc_al, free,
+                    fill_rand_flt, matrix_print_flt,
+                    transpose_flt_threads_row_wc, is_eq_flt);
+#elif defined(USE_FLOAT_THREADS_COL_WC)
+    TRANSP_THREADED(float, assert_malloc_al, free,
+                    fill_rand_flt, matrix_print_flt,
+                    transpose_flt_threads_col_wc, is_eq_flt);
+#elif defined(USE_DOUBLE_THREADS_ROW_WC)
+    TRANSP_THREADED(double, assert_malloc_al, free,
+                    fill_rand_dbl, matrix_print_dbl,
+                    transpose_dbl_threads_row_wc, is_eq_dbl);
+#elif defined(USE_DOUBLE_THREADS_COL_WC)
+    TRANSP_THREADED(double, assert_malloc_al, free,
+                    fill_rand_dbl, matrix_print_dbl,
+                    transpose_dbl_threads_col_wc, is_eq_dbl);
 #elif defined(USE_FFTWF_NAIVE)
     TRANSP(fftwf_complex, assert_fftwf_malloc, fftwf_free,
            fill_rand_fftwf_complex, matrix_print_fftwf_complex,
@@ -362,13 +1359,142 @@ int main(int argc, char **argv)
     TRANSP(MKL_Complex16, assert_malloc_al, free,
            fill_rand_cmplx16, matrix_print_cmplx16, transpose_cmplx16_mkl,
            is_eq_cmplx16);
-#elif defined(USE_FLOAT_AVX_INTR_8X8)
-    // TODO
-    return ENOTSUP;
+#elif defined(USE_FLOAT_AVX_INTR_16X16)
+    TRANSP(float, assert_malloc_al, free,
+           fill_rand_flt, matrix_print_flt, transpose_flt_avx_intr_16x16,
+           is_eq_flt);
+#elif defined(USE_FLOAT_COMPLEX_AVX_INTR_8X8)
+    TRANSP(float complex, assert_malloc_al, free,
+           fill_rand_flt_cmplx, matrix_print_flt_cmplx,
+           transpose_flt_cmplx_avx_intr_8x8, is_eq_flt_cmplx);
+#elif defined(USE_DOUBLE_COMPLEX_AVX_INTR_4X4)
+    TRANSP(double complex, assert_malloc_al, free,
+           fill_rand_dbl_cmplx, matrix_print_dbl_cmplx,
+           transpose_dbl_cmplx_avx_intr_4x4, is_eq_dbl_cmplx);
+#elif defined(USE_FLOAT_AVX_INTR_SKINNY)
+    TRANSP(float, assert_malloc_al, free,
+           fill_rand_flt, matrix_print_flt, transpose_flt_avx_intr_skinny,
+           is_eq_flt);
+#elif defined(USE_DOUBLE_AVX_INTR_SKINNY)
+    TRANSP(double, assert_malloc_al, free,
+           fill_rand_dbl, matrix_print_dbl, transpose_dbl_avx_intr_skinny,
+           is_eq_dbl);
+#elif defined(USE_FLOAT_COMPLEX_AVX_INTR_SKINNY)
+    TRANSP(float complex, assert_malloc_al, free,
+           fill_rand_flt_cmplx, matrix_print_flt_cmplx,
+           transpose_flt_cmplx_avx_intr_skinny, is_eq_flt_cmplx);
+#elif defined(USE_DOUBLE_COMPLEX_AVX_INTR_SKINNY)
+    TRANSP(double complex, assert_malloc_al, free,
+           fill_rand_dbl_cmplx, matrix_print_dbl_cmplx,
+           transpose_dbl_cmplx_avx_intr_skinny, is_eq_dbl_cmplx);
 #elif defined(USE_DOUBLE_AVX_INTR_8X8)
     TRANSP(double, assert_malloc_al, free,
            fill_rand_dbl, matrix_print_dbl, transpose_dbl_avx_intr_8x8,
            is_eq_dbl);
+#elif defined(USE_DOUBLE_AVX_INTR_8X16)
+    TRANSP(double, assert_malloc_al, free,
+           fill_rand_dbl, matrix_print_dbl, transpose_dbl_avx_intr_8x16,
+           is_eq_dbl);
+#elif defined(USE_DOUBLE_AVX_INTR_16X8)
+    TRANSP(double, assert_malloc_al, free,
+           fill_rand_dbl, matrix_print_dbl, transpose_dbl_avx_intr_16x8,
+           is_eq_dbl);
+#elif defined(USE_DOUBLE_AVX_INTR_16X16)
+    TRANSP(double, assert_malloc_al, free,
+           fill_rand_dbl, matrix_print_dbl, transpose_dbl_avx_intr_16x16,
+           is_eq_dbl);
+#elif defined(USE_DOUBLE_AVX_INTR_8X8_RECURSIVE)
+    TRANSP(double, assert_malloc_al, free,
+           fill_rand_dbl, matrix_print_dbl,
+           transpose_dbl_avx_intr_8x8_recursive, is_eq_dbl);
+#elif defined(USE_FLOAT_AVX_INTR_16X16_RECURSIVE)
+    TRANSP(float, assert_malloc_al, free,
+           fill_rand_flt, matrix_print_flt,
+           transpose_flt_avx_intr_16x16_recursive, is_eq_flt);
+#elif defined(USE_FLOAT_COMPLEX_AVX_INTR_8X8_RECURSIVE)
+    TRANSP(float complex, assert_malloc_al, free,
+           fill_rand_flt_cmplx, matrix_print_flt_cmplx,
+           transpose_flt_cmplx_avx_intr_8x8_recursive, is_eq_flt_cmplx);
+#elif defined(USE_DOUBLE_COMPLEX_AVX_INTR_4X4_RECURSIVE)
+    TRANSP(double complex, assert_malloc_al, free,
+           fill_rand_dbl_cmplx, matrix_print_dbl_cmplx,
+           transpose_dbl_cmplx_avx_intr_4x4_recursive, is_eq_dbl_cmplx);
+#elif defined(USE_DOUBLE_AVX_INTR_8X8_MORTON)
+    TRANSP(double, assert_malloc_al, free,
+           fill_rand_dbl, matrix_print_dbl,
+           transpose_dbl_avx_intr_8x8_morton, is_eq_dbl);
+#elif defined(USE_FLOAT_AVX_INTR_16X16_MORTON)
+    TRANSP(float, assert_malloc_al, free,
+           fill_rand_flt, matrix_print_flt,
+           transpose_flt_avx_intr_16x16_morton, is_eq_flt);
+#elif defined(USE_FLOAT_COMPLEX_AVX_INTR_8X8_MORTON)
+    TRANSP(float complex, assert_malloc_al, free,
+           fill_rand_flt_cmplx, matrix_print_flt_cmplx,
+           transpose_flt_cmplx_avx_intr_8x8_morton, is_eq_flt_cmplx);
+#elif defined(USE_DOUBLE_COMPLEX_AVX_INTR_4X4_MORTON)
+    TRANSP(double complex, assert_malloc_al, free,
+           fill_rand_dbl_cmplx, matrix_print_dbl_cmplx,
+           transpose_dbl_cmplx_avx_intr_4x4_morton, is_eq_dbl_cmplx);
+#elif defined(USE_DOUBLE_AVX_INTR_8X8_WC)
+    TRANSP(double, assert_malloc_al, free,
+           fill_rand_dbl, matrix_print_dbl,
+           transpose_dbl_avx_intr_8x8_wc, is_eq_dbl);
+#elif defined(USE_FLOAT_AVX_INTR_16X16_WC)
+    TRANSP(float, assert_malloc_al, free,
+           fill_rand_flt, matrix_print_flt,
+           transpose_flt_avx_intr_16x16_wc, is_eq_flt);
+#elif defined(USE_FLOAT_COMPLEX_AVX_INTR_8X8_WC)
+    TRANSP(float complex, assert_malloc_al, free,
+           fill_rand_flt_cmplx, matrix_print_flt_cmplx,
+           transpose_flt_cmplx_avx_intr_8x8_wc, is_eq_flt_cmplx);
+#elif defined(USE_DOUBLE_COMPLEX_AVX_INTR_4X4_WC)
+    TRANSP(double complex, assert_malloc_al, free,
+           fill_rand_dbl_cmplx, matrix_print_dbl_cmplx,
+           transpose_dbl_cmplx_avx_intr_4x4_wc, is_eq_dbl_cmplx);
+#elif defined(USE_DOUBLE_AVX_INTR_8X8_BLOCKED2)
+    TRANSP_BLOCKED2(double, assert_malloc_al, free,
+                    fill_rand_dbl, matrix_print_dbl,
+                    transpose_dbl_avx_intr_8x8_blocked2, is_eq_dbl);
+#elif defined(USE_FLOAT_AVX_INTR_16X16_BLOCKED2)
+    TRANSP_BLOCKED2(float, assert_malloc_al, free,
+                    fill_rand_flt, matrix_print_flt,
+                    transpose_flt_avx_intr_16x16_blocked2, is_eq_flt);
+#elif defined(USE_FLOAT_COMPLEX_AVX_INTR_8X8_BLOCKED2)
+    TRANSP_BLOCKED2(float complex, assert_malloc_al, free,
+                    fill_rand_flt_cmplx, matrix_print_flt_cmplx,
+                    transpose_flt_cmplx_avx_intr_8x8_blocked2, is_eq_flt_cmplx);
+#elif defined(USE_DOUBLE_COMPLEX_AVX_INTR_4X4_BLOCKED2)
+    TRANSP_BLOCKED2(double complex, assert_malloc_al, free,
+                    fill_rand_dbl_cmplx, matrix_print_dbl_cmplx,
+                    transpose_dbl_cmplx_avx_intr_4x4_blocked2, is_eq_dbl_cmplx);
+#elif defined(USE_FLOAT_THREADS_ROW_BLOCKED2)
+    TRANSP_THREADED_BLOCKED2(float, assert_malloc_al, free,
+                             fill_rand_flt, matrix_print_flt,
+                             transpose_flt_threads_row_blocked2,
+                             is_eq_flt);
+#elif defined(USE_FLOAT_THREADS_COL_BLOCKED2)
+    TRANSP_THREADED_BLOCKED2(float, assert_malloc_al, free,
+                             fill_rand_flt, matrix_print_flt,
+                             transpose_flt_threads_col_blocked2,
+                             is_eq_flt);
+#elif defined(USE_DOUBLE_THREADS_ROW_BLOCKED2)
+    TRANSP_THREADED_BLOCKED2(double, assert_malloc_al, free,
+                             fill_rand_dbl, matrix_print_dbl,
+                             transpose_dbl_threads_row_blocked2,
+                             is_eq_dbl);
+#elif defined(USE_DOUBLE_THREADS_COL_BLOCKED2)
+    TRANSP_THREADED_BLOCKED2(double, assert_malloc_al, free,
+                             fill_rand_dbl, matrix_print_dbl,
+                             transpose_dbl_threads_col_blocked2,
+                             is_eq_dbl);
+#elif defined(USE_FLOAT_THREADS_RECURSIVE)
+    TRANSP_THREADED(float, assert_malloc_al, free,
+                    fill_rand_flt, matrix_print_flt,
+                    transpose_flt_threads_recursive, is_eq_flt);
+#elif defined(USE_DOUBLE_THREADS_RECURSIVE)
+    TRANSP_THREADED(double, assert_malloc_al, free,
+                    fill_rand_dbl, matrix_print_dbl,
+                    transpose_dbl_threads_recursive, is_eq_dbl);
 #elif defined(USE_DOUBLE_THREADS_AVX_INTR_8X8_ROW)
     TRANSP_THREADED(double, assert_malloc_al, free,
                     fill_rand_dbl, matrix_print_dbl,
@@ -377,6 +1503,452 @@ int main(int argc, char **argv)
     TRANSP_THREADED(double, assert_malloc_al, free,
                     fill_rand_dbl, matrix_print_dbl,
                     transpose_dbl_threads_avx_intr_8x8_col, is_eq_dbl);
+#elif defined(USE_FLOAT_THREADS_AVX_INTR_16X16_ROW)
+    TRANSP_THREADED(float, assert_malloc_al, free,
+                    fill_rand_flt, matrix_print_flt,
+                    transpose_flt_threads_avx_intr_16x16_row, is_eq_flt);
+#elif defined(USE_FLOAT_THREADS_AVX_INTR_16X16_COL)
+    TRANSP_THREADED(float, assert_malloc_al, free,
+                    fill_rand_flt, matrix_print_flt,
+                    transpose_flt_threads_avx_intr_16x16_col, is_eq_flt);
+#elif defined(USE_FLOAT_COMPLEX_THREADS_AVX_INTR_8X8_ROW)
+    TRANSP_THREADED(float complex, assert_malloc_al, free,
+                    fill_rand_flt_cmplx, matrix_print_flt_cmplx,
+                    transpose_flt_cmplx_threads_avx_intr_8x8_row,
+                    is_eq_flt_cmplx);
+#elif defined(USE_FLOAT_COMPLEX_THREADS_AVX_INTR_8X8_COL)
+    TRANSP_THREADED(float complex, assert_malloc_al, free,
+                    fill_rand_flt_cmplx, matrix_print_flt_cmplx,
+                    transpose_flt_cmplx_threads_avx_intr_8x8_col,
+                    is_eq_flt_cmplx);
+#elif defined(USE_FFTWF_AVX_INTR_8X8)
+    TRANSP(fftwf_complex, assert_fftwf_malloc, fftwf_free,
+           fill_rand_fftwf_complex, matrix_print_fftwf_complex,
+           transpose_fftwf_complex_avx_intr_8x8, is_eq_fftwf_complex);
+#elif defined(USE_FFTWF_THREADS_AVX_INTR_8X8_ROW)
+    TRANSP_THREADED(fftwf_complex, assert_fftwf_malloc, fftwf_free,
+                    fill_rand_fftwf_complex, matrix_print_fftwf_complex,
+                    transpose_fftwf_complex_threads_avx_intr_8x8_row,
+                    is_eq_fftwf_complex);
+#elif defined(USE_FFTWF_THREADS_AVX_INTR_8X8_COL)
+    TRANSP_THREADED(fftwf_complex, assert_fftwf_malloc, fftwf_free,
+                    fill_rand_fftwf_complex, matrix_print_fftwf_complex,
+                    transpose_fftwf_complex_threads_avx_intr_8x8_col,
+                    is_eq_fftwf_complex);
+#elif defined(USE_DOUBLE_COMPLEX_THREADS_AVX_INTR_4X4_ROW)
+    TRANSP_THREADED(double complex, assert_malloc_al, free,
+                    fill_rand_dbl_cmplx, matrix_print_dbl_cmplx,
+                    transpose_dbl_cmplx_threads_avx_intr_4x4_row,
+                    is_eq_dbl_cmplx);
+#elif defined(USE_DOUBLE_COMPLEX_THREADS_AVX_INTR_4X4_COL)
+    TRANSP_THREADED(double complex, assert_malloc_al, free,
+                    fill_rand_dbl_cmplx, matrix_print_dbl_cmplx,
+                    transpose_dbl_cmplx_threads_avx_intr_4x4_col,
+                    is_eq_dbl_cmplx);
+#elif defined(USE_UINT8_AVX_INTR_16X16)
+    TRANSP(uint8_t, assert_malloc_al, free,
+           fill_rand_u8, matrix_print_u8,
+           transpose_u8_avx_intr_16x16, is_eq_u8);
+#elif defined(USE_INT16_AVX_INTR_16X16)
+    TRANSP(int16_t, assert_malloc_al, free,
+           fill_rand_i16, matrix_print_i16,
+           transpose_i16_avx_intr_16x16, is_eq_i16);
+#elif defined(USE_UINT8_THREADS_AVX_INTR_16X16_ROW)
+    TRANSP_THREADED(uint8_t, assert_malloc_al, free,
+                    fill_rand_u8, matrix_print_u8,
+                    transpose_u8_threads_avx_intr_16x16_row, is_eq_u8);
+#elif defined(USE_UINT8_THREADS_AVX_INTR_16X16_COL)
+    TRANSP_THREADED(uint8_t, assert_malloc_al, free,
+                    fill_rand_u8, matrix_print_u8,
+                    transpose_u8_threads_avx_intr_16x16_col, is_eq_u8);
+#elif defined(USE_INT16_THREADS_AVX_INTR_16X16_ROW)
+    TRANSP_THREADED(int16_t, assert_malloc_al, free,
+                    fill_rand_i16, matrix_print_i16,
+                    transpose_i16_threads_avx_intr_16x16_row, is_eq_i16);
+#elif defined(USE_INT16_THREADS_AVX_INTR_16X16_COL)
+    TRANSP_THREADED(int16_t, assert_malloc_al, free,
+                    fill_rand_i16, matrix_print_i16,
+                    transpose_i16_threads_avx_intr_16x16_col, is_eq_i16);
+#elif defined(USE_DOUBLE_THREADS_AVX_INTR_8X8_ROW_WC)
+    TRANSP_THREADED(double, assert_malloc_al, free,
+                    fill_rand_dbl, matrix_print_dbl,
+                    transpose_dbl_threads_avx_intr_8x8_row_wc, is_eq_dbl);
+#elif defined(USE_DOUBLE_THREADS_AVX_INTR_8X8_COL_WC)
+    TRANSP_THREADED(double, assert_malloc_al, free,
+                    fill_rand_dbl, matrix_print_dbl,
+                    transpose_dbl_threads_avx_intr_8x8_col_wc, is_eq_dbl);
+#elif defined(USE_FLOAT_THREADS_AVX_INTR_16X16_ROW_WC)
+    TRANSP_THREADED(float, assert_malloc_al, free,
+                    fill_rand_flt, matrix_print_flt,
+                    transpose_flt_threads_avx_intr_16x16_row_wc, is_eq_flt);
+#elif defined(USE_FLOAT_THREADS_AVX_INTR_16X16_COL_WC)
+    TRANSP_THREADED(float, assert_malloc_al, free,
+                    fill_rand_flt, matrix_print_flt,
+                    transpose_flt_threads_avx_intr_16x16_col_wc, is_eq_flt);
+#elif defined(USE_FLOAT_COMPLEX_THREADS_AVX_INTR_8X8_ROW_WC)
+    TRANSP_THREADED(float complex, assert_malloc_al, free,
+                    fill_rand_flt_cmplx, matrix_print_flt_cmplx,
+                    transpose_flt_cmplx_threads_avx_intr_8x8_row_wc,
+                    is_eq_flt_cmplx);
+#elif defined(USE_FLOAT_COMPLEX_THREADS_AVX_INTR_8X8_COL_WC)
+    TRANSP_THREADED(float complex, assert_malloc_al, free,
+                    fill_rand_flt_cmplx, matrix_print_flt_cmplx,
+                    transpose_flt_cmplx_threads_avx_intr_8x8_col_wc,
+                    is_eq_flt_cmplx);
+#elif defined(USE_DOUBLE_COMPLEX_THREADS_AVX_INTR_4X4_ROW_WC)
+    TRANSP_THREADED(double complex, assert_malloc_al, free,
+                    fill_rand_dbl_cmplx, matrix_print_dbl_cmplx,
+                    transpose_dbl_cmplx_threads_avx_intr_4x4_row_wc,
+                    is_eq_dbl_cmplx);
+#elif defined(USE_DOUBLE_COMPLEX_THREADS_AVX_INTR_4X4_COL_WC)
+    TRANSP_THREADED(double complex, assert_malloc_al, free,
+                    fill_rand_dbl_cmplx, matrix_print_dbl_cmplx,
+                    transpose_dbl_cmplx_threads_avx_intr_4x4_col_wc,
+                    is_eq_dbl_cmplx);
+#elif defined(USE_FFTW_AVX_INTR_4X4)
+    TRANSP(fftw_complex, assert_fftw_malloc, fftw_free,
+           fill_rand_fftw_complex, matrix_print_fftw_complex,
+           transpose_fftw_complex_avx_intr_4x4, is_eq_fftw_complex);
+#elif defined(USE_FFTW_THREADS_AVX_INTR_4X4_ROW)
+    TRANSP_THREADED(fftw_complex, assert_fftw_malloc, fftw_free,
+                    fill_rand_fftw_complex, matrix_print_fftw_complex,
+                    transpose_fftw_complex_threads_avx_intr_4x4_row,
+                    is_eq_fftw_complex);
+#elif defined(USE_FFTW_THREADS_AVX_INTR_4X4_COL)
+    TRANSP_THREADED(fftw_complex, assert_fftw_malloc, fftw_free,
+                    fill_rand_fftw_complex, matrix_print_fftw_complex,
+                    transpose_fftw_complex_threads_avx_intr_4x4_col,
+                    is_eq_fftw_complex);
+#elif defined(USE_FLOAT_AVX2_INTR_8X8)
+    TRANSP(float, assert_malloc_al, free,
+           fill_rand_flt, matrix_print_flt, transpose_flt_avx2_intr_8x8,
+           is_eq_flt);
+#elif defined(USE_DOUBLE_AVX2_INTR_4X4)
+    TRANSP(double, assert_malloc_al, free,
+           fill_rand_dbl, matrix_print_dbl, transpose_dbl_avx2_intr_4x4,
+           is_eq_dbl);
+#elif defined(USE_FLOAT_THREADS_AVX2_INTR_8X8_ROW)
+    TRANSP_THREADED(float, assert_malloc_al, free,
+                    fill_rand_flt, matrix_print_flt,
+                    transpose_flt_threads_avx2_intr_8x8_row, is_eq_flt);
+#elif defined(USE_FLOAT_THREADS_AVX2_INTR_8X8_COL)
+    TRANSP_THREADED(float, assert_malloc_al, free,
+                    fill_rand_flt, matrix_print_flt,
+                    transpose_flt_threads_avx2_intr_8x8_col, is_eq_flt);
+#elif defined(USE_DOUBLE_THREADS_AVX2_INTR_4X4_ROW)
+    TRANSP_THREADED(double, assert_malloc_al, free,
+                    fill_rand_dbl, matrix_print_dbl,
+                    transpose_dbl_threads_avx2_intr_4x4_row, is_eq_dbl);
+#elif defined(USE_DOUBLE_THREADS_AVX2_INTR_4X4_COL)
+    TRANSP_THREADED(double, assert_malloc_al, free,
+                    fill_rand_dbl, matrix_print_dbl,
+                    transpose_dbl_threads_avx2_intr_4x4_col, is_eq_dbl);
+#elif defined(USE_FLOAT_DISPATCH)
+    TRANSP(float, assert_malloc_al, free,
+           fill_rand_flt, matrix_print_flt, transpose_flt_dispatch, is_eq_flt);
+#elif defined(USE_DOUBLE_DISPATCH)
+    TRANSP(double, assert_malloc_al, free,
+           fill_rand_dbl, matrix_print_dbl, transpose_dbl_dispatch, is_eq_dbl);
+#elif defined(USE_FLOAT_COMPLEX_DISPATCH)
+    TRANSP(float complex, assert_malloc_al, free,
+           fill_rand_flt_cmplx, matrix_print_flt_cmplx,
+           transpose_flt_cmplx_dispatch, is_eq_flt_cmplx);
+#elif defined(USE_DOUBLE_COMPLEX_DISPATCH)
+    TRANSP(double complex, assert_malloc_al, free,
+           fill_rand_dbl_cmplx, matrix_print_dbl_cmplx,
+           transpose_dbl_cmplx_dispatch, is_eq_dbl_cmplx);
+#elif defined(USE_FLOAT_THREADS_DISPATCH_ROW)
+    TRANSP_THREADED(float, assert_malloc_al, free,
+                    fill_rand_flt, matrix_print_flt,
+                    transpose_flt_threads_dispatch_row, is_eq_flt);
+#elif defined(USE_FLOAT_THREADS_DISPATCH_COL)
+    TRANSP_THREADED(float, assert_malloc_al, free,
+                    fill_rand_flt, matrix_print_flt,
+                    transpose_flt_threads_dispatch_col, is_eq_flt);
+#elif defined(USE_DOUBLE_THREADS_DISPATCH_ROW)
+    TRANSP_THREADED(double, assert_malloc_al, free,
+                    fill_rand_dbl, matrix_print_dbl,
+                    transpose_dbl_threads_dispatch_row, is_eq_dbl);
+#elif defined(USE_DOUBLE_THREADS_DISPATCH_COL)
+    TRANSP_THREADED(double, assert_malloc_al, free,
+                    fill_rand_dbl, matrix_print_dbl,
+                    transpose_dbl_threads_dispatch_col, is_eq_dbl);
+#elif defined(USE_FFTWF_DISPATCH)
+    TRANSP(fftwf_complex, assert_fftwf_malloc, fftwf_free,
+           fill_rand_fftwf_complex, matrix_print_fftwf_complex,
+           transpose_fftwf_complex_dispatch, is_eq_fftwf_complex);
+#elif defined(USE_FFTW_DISPATCH)
+    TRANSP(fftw_complex, assert_fftw_malloc, fftw_free,
+           fill_rand_fftw_complex, matrix_print_fftw_complex,
+           transpose_fftw_complex_dispatch, is_eq_fftw_complex);
+#elif defined(USE_IQ16_FLOAT_COMPLEX_NAIVE)
+    TRANSP_CVT(transpose_iq16_t, float complex, assert_malloc_al, free,
+               fill_rand_iq16, matrix_print_iq16, matrix_print_flt_cmplx,
+               transpose_iq16_flt_cmplx_naive, cvt_iq16_flt_cmplx,
+               is_eq_flt_cmplx);
+#elif defined(USE_IQ12_FLOAT_COMPLEX_NAIVE)
+    TRANSP_CVT(transpose_iq12_t, float complex, assert_malloc_al, free,
+               fill_rand_iq12, matrix_print_iq12, matrix_print_flt_cmplx,
+               transpose_iq12_flt_cmplx_naive, cvt_iq12_flt_cmplx,
+               is_eq_flt_cmplx);
+#elif defined(USE_IQ16_FLOAT_COMPLEX_BLOCKED)
+    TRANSP_CVT_BLOCKED(transpose_iq16_t, float complex, assert_malloc_al, free,
+                       fill_rand_iq16, matrix_print_iq16, matrix_print_flt_cmplx,
+                       transpose_iq16_flt_cmplx_blocked, cvt_iq16_flt_cmplx,
+                       is_eq_flt_cmplx);
+#elif defined(USE_IQ12_FLOAT_COMPLEX_BLOCKED)
+    TRANSP_CVT_BLOCKED(transpose_iq12_t, float complex, assert_malloc_al, free,
+                       fill_rand_iq12, matrix_print_iq12, matrix_print_flt_cmplx,
+                       transpose_iq12_flt_cmplx_blocked, cvt_iq12_flt_cmplx,
+                       is_eq_flt_cmplx);
+#elif defined(USE_IQ16_FLOAT_COMPLEX_AVX_INTR_8X8)
+    TRANSP_CVT(transpose_iq16_t, float complex, assert_malloc_al, free,
+               fill_rand_iq16, matrix_print_iq16, matrix_print_flt_cmplx,
+               transpose_iq16_flt_cmplx_avx_intr_8x8, cvt_iq16_flt_cmplx,
+               is_eq_flt_cmplx);
+#elif defined(USE_IQ12_FLOAT_COMPLEX_AVX_INTR_8X8)
+    TRANSP_CVT(transpose_iq12_t, float complex, assert_malloc_al, free,
+               fill_rand_iq12, matrix_print_iq12, matrix_print_flt_cmplx,
+               transpose_iq12_flt_cmplx_avx_intr_8x8, cvt_iq12_flt_cmplx,
+               is_eq_flt_cmplx);
+#elif defined(USE_IQ16_FLOAT_COMPLEX_THREADS_AVX_INTR_8X8_ROW)
+    TRANSP_CVT_THREADED(transpose_iq16_t, float complex, assert_malloc_al, free,
+                        fill_rand_iq16, matrix_print_iq16,
+                        matrix_print_flt_cmplx,
+                        transpose_iq16_flt_cmplx_threads_avx_intr_8x8_row,
+                        cvt_iq16_flt_cmplx, is_eq_flt_cmplx);
+#elif defined(USE_IQ16_FLOAT_COMPLEX_THREADS_AVX_INTR_8X8_COL)
+    TRANSP_CVT_THREADED(transpose_iq16_t, float complex, assert_malloc_al, free,
+                        fill_rand_iq16, matrix_print_iq16,
+                        matrix_print_flt_cmplx,
+                        transpose_iq16_flt_cmplx_threads_avx_intr_8x8_col,
+                        cvt_iq16_flt_cmplx, is_eq_flt_cmplx);
+#elif defined(USE_IQ12_FLOAT_COMPLEX_THREADS_AVX_INTR_8X8_ROW)
+    TRANSP_CVT_THREADED(transpose_iq12_t, float complex, assert_malloc_al, free,
+                        fill_rand_iq12, matrix_print_iq12,
+                        matrix_print_flt_cmplx,
+                        transpose_iq12_flt_cmplx_threads_avx_intr_8x8_row,
+                        cvt_iq12_flt_cmplx, is_eq_flt_cmplx);
+#elif defined(USE_IQ12_FLOAT_COMPLEX_THREADS_AVX_INTR_8X8_COL)
+    TRANSP_CVT_THREADED(transpose_iq12_t, float complex, assert_malloc_al, free,
+                        fill_rand_iq12, matrix_print_iq12,
+                        matrix_print_flt_cmplx,
+                        transpose_iq12_flt_cmplx_threads_avx_intr_8x8_col,
+                        cvt_iq12_flt_cmplx, is_eq_flt_cmplx);
+#elif defined(USE_DOUBLE_FLOAT_NAIVE)
+    TRANSP_CVT(double, float, assert_malloc_al, free, fill_rand_dbl,
+               matrix_print_dbl, matrix_print_flt, transpose_dbl_flt_naive,
+               CVT_NONE, is_rt_dbl_flt);
+#elif defined(USE_DOUBLE_COMPLEX_FLOAT_COMPLEX_NAIVE)
+    TRANSP_CVT(double complex, float complex, assert_malloc_al, free,
+               fill_rand_dbl_cmplx, matrix_print_dbl_cmplx,
+               matrix_print_flt_cmplx, transpose_dbl_cmplx_flt_cmplx_naive,
+               CVT_NONE, is_rt_dbl_cmplx_flt_cmplx);
+#elif defined(USE_FLOAT_FP16_NAIVE)
+    TRANSP_CVT(float, transpose_fp16_t, assert_malloc_al, free, fill_rand_flt,
+               matrix_print_flt, matrix_print_fp16, transpose_flt_fp16_naive,
+               CVT_NONE, is_rt_flt_fp16);
+#elif defined(USE_FLOAT_BF16_NAIVE)
+    TRANSP_CVT(float, transpose_bf16_t, assert_malloc_al, free, fill_rand_flt,
+               matrix_print_flt, matrix_print_bf16, transpose_flt_bf16_naive,
+               CVT_NONE, is_rt_flt_bf16);
+#elif defined(USE_FLOAT_COMPLEX_FP16_COMPLEX_NAIVE)
+    TRANSP_CVT(float complex, transpose_fp16_cmplx_t, assert_malloc_al, free,
+               fill_rand_flt_cmplx, matrix_print_flt_cmplx,
+               matrix_print_fp16_cmplx, transpose_flt_cmplx_fp16_cmplx_naive,
+               CVT_NONE, is_rt_flt_cmplx_fp16_cmplx);
+#elif defined(USE_FLOAT_COMPLEX_BF16_COMPLEX_NAIVE)
+    TRANSP_CVT(float complex, transpose_bf16_cmplx_t, assert_malloc_al, free,
+               fill_rand_flt_cmplx, matrix_print_flt_cmplx,
+               matrix_print_bf16_cmplx, transpose_flt_cmplx_bf16_cmplx_naive,
+               CVT_NONE, is_rt_flt_cmplx_bf16_cmplx);
+#elif defined(USE_DOUBLE_FLOAT_AVX_INTR_16X16)
+    TRANSP_CVT(double, float, assert_malloc_al, free, fill_rand_dbl,
+               matrix_print_dbl, matrix_print_flt,
+               transpose_dbl_flt_avx_intr_16x16, CVT_NONE, is_rt_dbl_flt);
+#elif defined(USE_DOUBLE_COMPLEX_FLOAT_COMPLEX_AVX_INTR_8X8)
+    TRANSP_CVT(double complex, float complex, assert_malloc_al, free,
+               fill_rand_dbl_cmplx, matrix_print_dbl_cmplx,
+               matrix_print_flt_cmplx,
+               transpose_dbl_cmplx_flt_cmplx_avx_intr_8x8, CVT_NONE,
+               is_rt_dbl_cmplx_flt_cmplx);
+#elif defined(USE_FLOAT_FP16_AVX_INTR_16X16)
+    TRANSP_CVT(float, transpose_fp16_t, assert_malloc_al, free, fill_edge_flt,
+               matrix_print_flt, matrix_print_fp16,
+               transpose_flt_fp16_avx_intr_16x16,
+               transpose_flt_to_fp16, is_eq_fp16);
+#elif defined(USE_FLOAT_BF16_AVX_INTR_16X16)
+    TRANSP_CVT(float, transpose_bf16_t, assert_malloc_al, free, fill_edge_flt,
+               matrix_print_flt, matrix_print_bf16,
+               transpose_flt_bf16_avx_intr_16x16,
+               transpose_flt_to_bf16, is_eq_bf16);
+#elif defined(USE_FLOAT_COMPLEX_FP16_COMPLEX_AVX_INTR_8X8)
+    TRANSP_CVT(float complex, transpose_fp16_cmplx_t, assert_malloc_al, free,
+               fill_edge_flt_cmplx, matrix_print_flt_cmplx,
+               matrix_print_fp16_cmplx,
+               transpose_flt_cmplx_fp16_cmplx_avx_intr_8x8,
+               transpose_flt_cmplx_to_fp16_cmplx, is_eq_fp16_cmplx);
+#elif defined(USE_FLOAT_COMPLEX_BF16_COMPLEX_AVX_INTR_8X8)
+    TRANSP_CVT(float complex, transpose_bf16_cmplx_t, assert_malloc_al, free,
+               fill_edge_flt_cmplx, matrix_print_flt_cmplx,
+               matrix_print_bf16_cmplx,
+               transpose_flt_cmplx_bf16_cmplx_avx_intr_8x8,
+               transpose_flt_cmplx_to_bf16_cmplx, is_eq_bf16_cmplx);
+#elif defined(USE_DOUBLE_FLOAT_THREADS_AVX_INTR_16X16_ROW)
+    TRANSP_CVT_THREADED(double, float, assert_malloc_al, free, fill_rand_dbl,
+                        matrix_print_dbl, matrix_print_flt,
+                        transpose_dbl_flt_threads_avx_intr_16x16_row, CVT_NONE,
+                        is_rt_dbl_flt);
+#elif defined(USE_DOUBLE_FLOAT_THREADS_AVX_INTR_16X16_COL)
+    TRANSP_CVT_THREADED(double, float, assert_malloc_al, free, fill_rand_dbl,
+                        matrix_print_dbl, matrix_print_flt,
+                        transpose_dbl_flt_threads_avx_intr_16x16_col, CVT_NONE,
+                        is_rt_dbl_flt);
+#elif defined(USE_DOUBLE_COMPLEX_FLOAT_COMPLEX_THREADS_AVX_INTR_8X8_ROW)
+    TRANSP_CVT_THREADED(double complex, float complex, assert_malloc_al, free,
+                        fill_rand_dbl_cmplx, matrix_print_dbl_cmplx,
+                        matrix_print_flt_cmplx,
+                        transpose_dbl_cmplx_flt_cmplx_threads_avx_intr_8x8_row,
+                        CVT_NONE, is_rt_dbl_cmplx_flt_cmplx);
+#elif defined(USE_DOUBLE_COMPLEX_FLOAT_COMPLEX_THREADS_AVX_INTR_8X8_COL)
+    TRANSP_CVT_THREADED(double complex, float complex, assert_malloc_al, free,
+                        fill_rand_dbl_cmplx, matrix_print_dbl_cmplx,
+                        matrix_print_flt_cmplx,
+                        transpose_dbl_cmplx_flt_cmplx_threads_avx_intr_8x8_col,
+                        CVT_NONE, is_rt_dbl_cmplx_flt_cmplx);
+#elif defined(USE_FLOAT_FP16_THREADS_AVX_INTR_16X16_ROW)
+    TRANSP_CVT_THREADED(float, transpose_fp16_t, assert_malloc_al, free,
+                        fill_edge_flt, matrix_print_flt, matrix_print_fp16,
+                        transpose_flt_fp16_threads_avx_intr_16x16_row,
+                        transpose_flt_to_fp16, is_eq_fp16);
+#elif defined(USE_FLOAT_FP16_THREADS_AVX_INTR_16X16_COL)
+    TRANSP_CVT_THREADED(float, transpose_fp16_t, assert_malloc_al, free,
+                        fill_edge_flt, matrix_print_flt, matrix_print_fp16,
+                        transpose_flt_fp16_threads_avx_intr_16x16_col,
+                        transpose_flt_to_fp16, is_eq_fp16);
+#elif defined(USE_FLOAT_BF16_THREADS_AVX_INTR_16X16_ROW)
+    TRANSP_CVT_THREADED(float, transpose_bf16_t, assert_malloc_al, free,
+                        fill_edge_flt, matrix_print_flt, matrix_print_bf16,
+                        transpose_flt_bf16_threads_avx_intr_16x16_row,
+                        transpose_flt_to_bf16, is_eq_bf16);
+#elif defined(USE_FLOAT_BF16_THREADS_AVX_INTR_16X16_COL)
+    TRANSP_CVT_THREADED(float, transpose_bf16_t, assert_malloc_al, free,
+                        fill_edge_flt, matrix_print_flt, matrix_print_bf16,
+                        transpose_flt_bf16_threads_avx_intr_16x16_col,
+                        transpose_flt_to_bf16, is_eq_bf16);
+#elif defined(USE_FLOAT_COMPLEX_FP16_COMPLEX_THREADS_AVX_INTR_8X8_ROW)
+    TRANSP_CVT_THREADED(float complex, transpose_fp16_cmplx_t, assert_malloc_al,
+                        free, fill_edge_flt_cmplx, matrix_print_flt_cmplx,
+                        matrix_print_fp16_cmplx,
+                        transpose_flt_cmplx_fp16_cmplx_threads_avx_intr_8x8_row,
+                        transpose_flt_cmplx_to_fp16_cmplx, is_eq_fp16_cmplx);
+#elif defined(USE_FLOAT_COMPLEX_FP16_COMPLEX_THREADS_AVX_INTR_8X8_COL)
+    TRANSP_CVT_THREADED(float complex, transpose_fp16_cmplx_t, assert_malloc_al,
+                        free, fill_edge_flt_cmplx, matrix_print_flt_cmplx,
+                        matrix_print_fp16_cmplx,
+                        transpose_flt_cmplx_fp16_cmplx_threads_avx_intr_8x8_col,
+                        transpose_flt_cmplx_to_fp16_cmplx, is_eq_fp16_cmplx);
+#elif defined(USE_FLOAT_COMPLEX_BF16_COMPLEX_THREADS_AVX_INTR_8X8_ROW)
+    TRANSP_CVT_THREADED(float complex, transpose_bf16_cmplx_t, assert_malloc_al,
+                        free, fill_edge_flt_cmplx, matrix_print_flt_cmplx,
+                        matrix_print_bf16_cmplx,
+                        transpose_flt_cmplx_bf16_cmplx_threads_avx_intr_8x8_row,
+                        transpose_flt_cmplx_to_bf16_cmplx, is_eq_bf16_cmplx);
+#elif defined(USE_FLOAT_COMPLEX_BF16_COMPLEX_THREADS_AVX_INTR_8X8_COL)
+    TRANSP_CVT_THREADED(float complex, transpose_bf16_cmplx_t, assert_malloc_al,
+                        free, fill_edge_flt_cmplx, matrix_print_flt_cmplx,
+                        matrix_print_bf16_cmplx,
+                        transpose_flt_cmplx_bf16_cmplx_threads_avx_intr_8x8_col,
+                        transpose_flt_cmplx_to_bf16_cmplx, is_eq_bf16_cmplx);
+#elif defined(USE_FLOAT_COMPLEX_SPLIT_NAIVE)
+    TRANSP_TO_SPLIT(float, float complex, assert_malloc_al, free,
+                    fill_rand_flt_cmplx, matrix_print_flt,
+                    matrix_print_flt_cmplx, transpose_flt_cmplx_split_naive,
+                    crealf, cimagf, is_eq_flt);
+#elif defined(USE_FLOAT_SPLIT_COMPLEX_NAIVE)
+    TRANSP_FROM_SPLIT(float, float complex, assert_malloc_al, free,
+                      fill_rand_flt, matrix_print_flt, matrix_print_flt_cmplx,
+                      transpose_flt_split_cmplx_naive, crealf, cimagf,
+                      is_eq_flt);
+#elif defined(USE_FLOAT_COMPLEX_SPLIT_AVX_INTR_16X16)
+    TRANSP_TO_SPLIT(float, float complex, assert_malloc_al, free,
+                    fill_rand_flt_cmplx, matrix_print_flt,
+                    matrix_print_flt_cmplx,
+                    transpose_flt_cmplx_split_avx_intr_16x16, crealf, cimagf,
+                    is_eq_flt);
+#elif defined(USE_FLOAT_SPLIT_COMPLEX_AVX_INTR_16X16)
+    TRANSP_FROM_SPLIT(float, float complex, assert_malloc_al, free,
+                      fill_rand_flt, matrix_print_flt, matrix_print_flt_cmplx,
+                      transpose_flt_split_cmplx_avx_intr_16x16, crealf, cimagf,
+                      is_eq_flt);
+#elif defined(USE_FLOAT_COMPLEX_SPLIT_THREADS_AVX_INTR_16X16_ROW)
+    TRANSP_TO_SPLIT_THREADED(float, float complex, assert_malloc_al, free,
+                             fill_rand_flt_cmplx, matrix_print_flt,
+                             matrix_print_flt_cmplx,
+                             transpose_flt_cmplx_split_threads_avx_intr_16x16_row,
+                             crealf, cimagf, is_eq_flt);
+#elif defined(USE_FLOAT_SPLIT_COMPLEX_THREADS_AVX_INTR_16X16_ROW)
+    TRANSP_FROM_SPLIT_THREADED(float, float complex, assert_malloc_al, free,
+                               fill_rand_flt, matrix_print_flt,
+                               matrix_print_flt_cmplx,
+                               transpose_flt_split_cmplx_threads_avx_intr_16x16_row,
+                               crealf, cimagf, is_eq_flt);
+#elif defined(USE_FLOAT_COMPLEX_SPLIT_THREADS_AVX_INTR_16X16_COL)
+    TRANSP_TO_SPLIT_THREADED(float, float complex, assert_malloc_al, free,
+                             fill_rand_flt_cmplx, matrix_print_flt,
+                             matrix_print_flt_cmplx,
+                             transpose_flt_cmplx_split_threads_avx_intr_16x16_col,
+                             crealf, cimagf, is_eq_flt);
+#elif defined(USE_FLOAT_SPLIT_COMPLEX_THREADS_AVX_INTR_16X16_COL)
+    TRANSP_FROM_SPLIT_THREADED(float, float complex, assert_malloc_al, free,
+                               fill_rand_flt, matrix_print_flt,
+                               matrix_print_flt_cmplx,
+                               transpose_flt_split_cmplx_threads_avx_intr_16x16_col,
+                               crealf, cimagf, is_eq_flt);
+#elif defined(USE_DOUBLE_COMPLEX_SPLIT_NAIVE)
+    TRANSP_TO_SPLIT(double, double complex, assert_malloc_al, free,
+                    fill_rand_dbl_cmplx, matrix_print_dbl,
+                    matrix_print_dbl_cmplx, transpose_dbl_cmplx_split_naive,
+                    creal, cimag, is_eq_dbl);
+#elif defined(USE_DOUBLE_SPLIT_COMPLEX_NAIVE)
+    TRANSP_FROM_SPLIT(double, double complex, assert_malloc_al, free,
+                      fill_rand_dbl, matrix_print_dbl, matrix_print_dbl_cmplx,
+                      transpose_dbl_split_cmplx_naive, creal, cimag, is_eq_dbl);
+#elif defined(USE_DOUBLE_COMPLEX_SPLIT_AVX_INTR_8X8)
+    TRANSP_TO_SPLIT(double, double complex, assert_malloc_al, free,
+                    fill_rand_dbl_cmplx, matrix_print_dbl,
+                    matrix_print_dbl_cmplx,
+                    transpose_dbl_cmplx_split_avx_intr_8x8, creal, cimag,
+                    is_eq_dbl);
+#elif defined(USE_DOUBLE_SPLIT_COMPLEX_AVX_INTR_8X8)
+    TRANSP_FROM_SPLIT(double, double complex, assert_malloc_al, free,
+                      fill_rand_dbl, matrix_print_dbl, matrix_print_dbl_cmplx,
+                      transpose_dbl_split_cmplx_avx_intr_8x8, creal, cimag,
+                      is_eq_dbl);
+#elif defined(USE_DOUBLE_COMPLEX_SPLIT_THREADS_AVX_INTR_8X8_ROW)
+    TRANSP_TO_SPLIT_THREADED(double, double complex, assert_malloc_al, free,
+                             fill_rand_dbl_cmplx, matrix_print_dbl,
+                             matrix_print_dbl_cmplx,
+                             transpose_dbl_cmplx_split_threads_avx_intr_8x8_row,
+                             creal, cimag, is_eq_dbl);
+#elif defined(USE_DOUBLE_SPLIT_COMPLEX_THREADS_AVX_INTR_8X8_ROW)
+    TRANSP_FROM_SPLIT_THREADED(double, double complex, assert_malloc_al, free,
+                               fill_rand_dbl, matrix_print_dbl,
+                               matrix_print_dbl_cmplx,
+                               transpose_dbl_split_cmplx_threads_avx_intr_8x8_row,
+                               creal, cimag, is_eq_dbl);
+#elif defined(USE_DOUBLE_COMPLEX_SPLIT_THREADS_AVX_INTR_8X8_COL)
+    TRANSP_TO_SPLIT_THREADED(double, double complex, assert_malloc_al, free,
+                             fill_rand_dbl_cmplx, matrix_print_dbl,
+                             matrix_print_dbl_cmplx,
+                             transpose_dbl_cmplx_split_threads_avx_intr_8x8_col,
+                             creal, cimag, is_eq_dbl);
+#elif defined(USE_DOUBLE_SPLIT_COMPLEX_THREADS_AVX_INTR_8X8_COL)
+    TRANSP_FROM_SPLIT_THREADED(double, double complex, assert_malloc_al, free,
+                               fill_rand_dbl, matrix_print_dbl,
+                               matrix_print_dbl_cmplx,
+                               transpose_dbl_split_cmplx_threads_avx_intr_8x8_col,
+                               creal, cimag, is_eq_dbl);
 #else
     #error "No matching transpose implementation found!"
 #endif
@@ -0,0 +1,2430 @@
+/**
+ * AVX-512 register tile kernels shared by the serial and threaded transposes.
+ *
+ * Each kernel transposes one square tile that starts at A (row stride lda) and
+ * writes it to B (row stride ldb).  Loads and stores are unaligned, so tiles
+ * may start anywhere.  The *_part kernels handle a ragged tile of rows x cols
+ * elements at the bottom or right edge of the matrix using masked loads and
+ * stores, so no memory outside the matrix is touched.  A non-NULL alpha
+ * scales every element of the tile; with a constant NULL the scaling is
+ * compiled out.
+ *
+ * The 8- and 16-bit integer kernels are the exception: one call transposes
+ * 16 rows of a whole 512-bit vector, i.e., four 16x16 byte or two 16x16 word
+ * tiles side by side, and they take no alpha.  Neither do the
+ * precision-converting and split-complex kernels, whose tiles are square.
+ * The epilogue kernels take a struct transpose_epi_* (see transpose-epi.h) and
+ * the position of the tile in A in place of alpha.  The permuting kernels
+ * gather their rows of A and scatter their rows of B through index tables
+ * (see transpose-perm.h) instead of taking the start of a square tile.  The
+ * skinny kernels move whole rows of a matrix with 16 or fewer rows or columns
+ * instead of tiles.
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_AVX_KERNELS_H
+#define TRANSPOSE_AVX_KERNELS_H
+
+#include <complex.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// intrinsics
+#include <immintrin.h>
+
+#include "cpu-features.h"
+#include "transpose-cvt.h"
+#include "transpose-epi.h"
+#include "transpose-iq.h"
+#include "transpose-perm.h"
+#include "transpose-prefetch.h"
+
+/*
+ * Streaming stores need every written row to start on a 64-byte boundary.
+ * Each *_blk kernel is a *_blk_st kernel with a constant nt: *_blk streams only
+ * in USE_AVX_STREAMING_STORES builds, *_blk_nt streams whenever B is aligned.
+ */
+#if defined(USE_AVX_STREAMING_STORES)
+#define AVX_INTR_STREAM 1
+#else
+#define AVX_INTR_STREAM 0
+#endif
+
+// most 8x8 tiles transposed together by the unrolled double kernels
+#define AVX_INTR_UNROLL_MAX 4
+
+static inline int avx_intr_can_stream(const void *B, size_t ldb_bytes)
+{
+    return (uintptr_t)B % 64 == 0 && ldb_bytes % 64 == 0;
+}
+
+// as above for kernels that write rows of row_bytes (a power of two up to 64)
+static inline int avx_intr_can_stream_row(const void *B, size_t ldb_bytes,
+                                          size_t row_bytes)
+{
+    return (uintptr_t)B % row_bytes == 0 && ldb_bytes % row_bytes == 0;
+}
+
+/*
+ * Copy bytes from src to dst with streaming stores for the cache lines of dst
+ * that are covered completely and regular stores for the partial lines at
+ * either end.
+ */
+CPU_TARGET_AVX512
+static inline void avx_intr_stream_copy(void *dst, const void *src,
+                                        size_t bytes)
+{
+    char *d = (char *)dst;
+    const char *s = (const char *)src;
+    size_t head = (64 - (uintptr_t)d % 64) % 64;
+    size_t i;
+    if (head > bytes) {
+        head = bytes;
+    }
+    memcpy(d, s, head);
+    for (i = head; i + 64 <= bytes; i += 64) {
+        _mm512_stream_si512((void *)&d[i], _mm512_loadu_si512(&s[i]));
+    }
+    memcpy(&d[i], &s[i], bytes - i);
+}
+
+CPU_TARGET_AVX512
+static inline void avx_intr_scale_dbl(__m512d *r, size_t n,
+                                      const double *alpha)
+{
+    size_t i;
+    if (alpha) {
+        const __m512d a = _mm512_set1_pd(*alpha);
+        for (i = 0; i < n; i++) {
+            r[i] = _mm512_mul_pd(r[i], a);
+        }
+    }
+}
+
+CPU_TARGET_AVX512
+static inline void avx_intr_scale_flt(__m512 *r, size_t n, const float *alpha)
+{
+    size_t i;
+    if (alpha) {
+        const __m512 a = _mm512_set1_ps(*alpha);
+        for (i = 0; i < n; i++) {
+            r[i] = _mm512_mul_ps(r[i], a);
+        }
+    }
+}
+
+/*
+ * Complex multiply of interleaved (re, im) pairs by alpha: multiply by the real
+ * part, then subtract/add the pair-swapped values times the imaginary part.
+ */
+CPU_TARGET_AVX512
+static inline void avx_intr_scale_flt_cmplx(__m512d *r, size_t n,
+                                            const float complex *alpha)
+{
+    size_t i;
+    __m512 x;
+    if (alpha) {
+        const __m512 ar = _mm512_set1_ps(crealf(*alpha));
+        const __m512 ai = _mm512_set1_ps(cimagf(*alpha));
+        for (i = 0; i < n; i++) {
+            x = _mm512_castpd_ps(r[i]);
+            x = _mm512_fmaddsub_ps(x, ar,
+                                   _mm512_mul_ps(_mm512_permute_ps(x, 0xb1), ai));
+            r[i] = _mm512_castps_pd(x);
+        }
+    }
+}
+
+CPU_TARGET_AVX512
+static inline void avx_intr_scale_dbl_cmplx(__m512d *r, size_t n,
+                                            const double complex *alpha)
+{
+    size_t i;
+    if (alpha) {
+        const __m512d ar = _mm512_set1_pd(creal(*alpha));
+        const __m512d ai = _mm512_set1_pd(cimag(*alpha));
+        for (i = 0; i < n; i++) {
+            r[i] = _mm512_fmaddsub_pd(r[i], ar,
+                                      _mm512_mul_pd(_mm512_permute_pd(r[i], 0x55),
+                                                    ai));
+        }
+    }
+}
+
+/*
+ * Transpose n independent 8x8 tiles of doubles, 8 rows each, in registers using
+ * a recursive transpose algorithm.  Each shuffle stage is done for all tiles
+ * before the next one starts, so the shuffles of one tile hide the latency of
+ * another's.  n is a constant in every caller, so the loops unroll.
+ */
+CPU_TARGET_AVX512
+static inline void transpose_dbl_avx_intr_8x8_reg_n(__m512d r[][8], size_t n)
+{
+    // used for swapping 2x2 blocks using _mm512_permutex2var_pd()
+    static const __m512i idx_2x2_0 = {
+        0x0000, 0x0001, 0x0008, 0x0009, 0x0004, 0x0005, 0x000c, 0x000d
+    };
+    static const __m512i idx_2x2_1 = {
+        0x000a, 0x000b, 0x0002, 0x0003, 0x000e, 0x000f, 0x0006, 0x0007
+    };
+    // used for swapping 4x4 blocks using _mm512_permutex2var_pd()
+    static const __m512i idx_4x4_0 = {
+        0x0000, 0x0001, 0x0002, 0x0003, 0x0008, 0x0009, 0x000a, 0x000b
+    };
+    static const __m512i idx_4x4_1 = {
+        0x000c, 0x000d, 0x000e, 0x000f, 0x0004, 0x0005, 0x0006, 0x0007
+    };
+    // alternate the reads and writes between the r and s vector registers, all
+    // of which hold matrix rows
+    __m512d s[AVX_INTR_UNROLL_MAX][8];
+    size_t t;
+
+    // shuffle doubles within 128-bit lanes
+    for (t = 0; t < n; t++) {
+        s[t][0] = _mm512_unpacklo_pd(r[t][0], r[t][1]);
+        s[t][1] = _mm512_unpackhi_pd(r[t][0], r[t][1]);
+        s[t][2] = _mm512_unpacklo_pd(r[t][2], r[t][3]);
+        s[t][3] = _mm512_unpackhi_pd(r[t][2], r[t][3]);
+        s[t][4] = _mm512_unpacklo_pd(r[t][4], r[t][5]);
+        s[t][5] = _mm512_unpackhi_pd(r[t][4], r[t][5]);
+        s[t][6] = _mm512_unpacklo_pd(r[t][6], r[t][7]);
+        s[t][7] = _mm512_unpackhi_pd(r[t][6], r[t][7]);
+    }
+
+    // shuffle 2x2 blocks of doubles
+    for (t = 0; t < n; t++) {
+        r[t][0] = _mm512_permutex2var_pd(s[t][0], idx_2x2_0, s[t][2]);
+        r[t][1] = _mm512_permutex2var_pd(s[t][1], idx_2x2_0, s[t][3]);
+        r[t][2] = _mm512_permutex2var_pd(s[t][2], idx_2x2_1, s[t][0]);
+        r[t][3] = _mm512_permutex2var_pd(s[t][3], idx_2x2_1, s[t][1]);
+        r[t][4] = _mm512_permutex2var_pd(s[t][4], idx_2x2_0, s[t][6]);
+        r[t][5] = _mm512_permutex2var_pd(s[t][5], idx_2x2_0, s[t][7]);
+        r[t][6] = _mm512_permutex2var_pd(s[t][6], idx_2x2_1, s[t][4]);
+        r[t][7] = _mm512_permutex2var_pd(s[t][7], idx_2x2_1, s[t][5]);
+    }
+
+    // shuffle 4x4 blocks of doubles
+    for (t = 0; t < n; t++) {
+        s[t][0] = _mm512_permutex2var_pd(r[t][0], idx_4x4_0, r[t][4]);
+        s[t][1] = _mm512_permutex2var_pd(r[t][1], idx_4x4_0, r[t][5]);
+        s[t][2] = _mm512_permutex2var_pd(r[t][2], idx_4x4_0, r[t][6]);
+        s[t][3] = _mm512_permutex2var_pd(r[t][3], idx_4x4_0, r[t][7]);
+        s[t][4] = _mm512_permutex2var_pd(r[t][4], idx_4x4_1, r[t][0]);
+        s[t][5] = _mm512_permutex2var_pd(r[t][5], idx_4x4_1, r[t][1]);
+        s[t][6] = _mm512_permutex2var_pd(r[t][6], idx_4x4_1, r[t][2]);
+        s[t][7] = _mm512_permutex2var_pd(r[t][7], idx_4x4_1, r[t][3]);
+    }
+
+    for (t = 0; t < n; t++) {
+        r[t][0] = s[t][0];
+        r[t][1] = s[t][1];
+        r[t][2] = s[t][2];
+        r[t][3] = s[t][3];
+        r[t][4] = s[t][4];
+        r[t][5] = s[t][5];
+        r[t][6] = s[t][6];
+        r[t][7] = s[t][7];
+    }
+}
+
+/*
+ * Transpose 8 rows of 8 doubles in registers.
+ */
+CPU_TARGET_AVX512
+static inline void transpose_dbl_avx_intr_8x8_reg(__m512d r[8])
+{
+    transpose_dbl_avx_intr_8x8_reg_n((__m512d (*)[8])r, 1);
+}
+
+/*
+ * Transpose an 8x8 block of doubles.
+ */
+CPU_TARGET_AVX512
+static inline void transpose_dbl_avx_intr_8x8_blk_st(const double* restrict A,
+                                                     double* restrict B,
+                                                     size_t lda, size_t ldb,
+                                                     const double *alpha, int nt)
+{
+    __m512d r[8];
+    size_t i;
+
+    // read 8x8 block of read array
+    for (i = 0; i < 8; i++) {
+        r[i] = _mm512_loadu_pd(&A[i*lda]);
+    }
+
+    transpose_dbl_avx_intr_8x8_reg(r);
+    avx_intr_scale_dbl(r, 8, alpha);
+
+    // write back 8x8 block of write array
+    if (nt && avx_intr_can_stream(B, ldb * sizeof(double))) {
+        for (i = 0; i < 8; i++) {
+            _mm512_stream_pd(&B[i*ldb], r[i]);
+        }
+        return;
+    }
+    for (i = 0; i < 8; i++) {
+        _mm512_storeu_pd(&B[i*ldb], r[i]);
+    }
+}
+
+CPU_TARGET_AVX512
+static inline void transpose_dbl_avx_intr_8x8_blk(const double* restrict A,
+                                                  double* restrict B,
+                                                  size_t lda, size_t ldb,
+                                                  const double *alpha)
+{
+    transpose_dbl_avx_intr_8x8_blk_st(A, B, lda, ldb, alpha, AVX_INTR_STREAM);
+}
+
+CPU_TARGET_AVX512
+static inline void transpose_dbl_avx_intr_8x8_blk_nt(const double* restrict A,
+                                                     double* restrict B,
+                                                     size_t lda, size_t ldb,
+                                                     const double *alpha)
+{
+    transpose_dbl_avx_intr_8x8_blk_st(A, B, lda, ldb, alpha, 1);
+}
+
+/*
+ * Transpose a block of nr x nc adjacent 8x8 tiles of doubles (nr * nc at most
+ * AVX_INTR_UNROLL_MAX) in one go.  Rows are loaded across the whole block, so
+ * the tiles side by side share each cache line of A, and the tiles are
+ * shuffled together by transpose_dbl_avx_intr_8x8_reg_n().
+ */
+CPU_TARGET_AVX512
+static inline void transpose_dbl_avx_intr_unroll_blk(const double* restrict A,
+                                                     double* restrict B,
+                                                     size_t lda, size_t ldb,
+                                                     const double *alpha,
+                                                     int nt,
+                                                     size_t nr, size_t nc)
+{
+    __m512d r[AVX_INTR_UNROLL_MAX][8];
+    size_t i, j, k;
+
+    // read 8*nr x 8*nc block of read array, tile (i, j) into r[i*nc + j]
+    for (i = 0; i < nr; i++) {
+        for (k = 0; k < 8; k++) {
+            for (j = 0; j < nc; j++) {
+                r[i*nc + j][k] = _mm512_loadu_pd(&A[(8*i + k)*lda + 8*j]);
+            }
+        }
+    }
+
+    transpose_dbl_avx_intr_8x8_reg_n(r, nr * nc);
+    for (i = 0; i < nr * nc; i++) {
+        avx_intr_scale_dbl(r[i], 8, alpha);
+    }
+
+    // write back 8*nc x 8*nr block of write array, a row of B at a time
+    if (nt && avx_intr_can_stream(B, ldb * sizeof(double))) {
+        for (j = 0; j < nc; j++) {
+            for (k = 0; k < 8; k++) {
+                for (i = 0; i < nr; i++) {
+                    _mm512_stream_pd(&B[(8*j + k)*ldb + 8*i], r[i*nc + j][k]);
+                }
+            }
+        }
+        return;
+    }
+    for (j = 0; j < nc; j++) {
+        for (k = 0; k < 8; k++) {
+            for (i = 0; i < nr; i++) {
+                _mm512_storeu_pd(&B[(8*j + k)*ldb + 8*i], r[i*nc + j][k]);
+            }
+        }
+    }
+}
+
+/*
+ * Transpose the top-left rows x cols corner (both in [1, 8]) of an 8x8 block
+ * of doubles.
+ */
+CPU_TARGET_AVX512
+static inline void transpose_dbl_avx_intr_8x8_blk_part(const double* restrict A,
+                                                       double* restrict B,
+                                                       size_t lda, size_t ldb,
+                                                       size_t rows, size_t cols,
+                                                       const double *alpha)
+{
+    const __mmask8 ld_mask = (__mmask8)((1u << cols) - 1);
+    const __mmask8 st_mask = (__mmask8)((1u << rows) - 1);
+    __m512d r[8];
+    size_t i;
+
+    // read the partial block, padding missing rows with zeros
+    for (i = 0; i < 8; i++) {
+        r[i] = i < rows ? _mm512_maskz_loadu_pd(ld_mask, &A[i*lda])
+                        : _mm512_setzero_pd();
+    }
+
+    transpose_dbl_avx_intr_8x8_reg(r);
+    avx_intr_scale_dbl(r, cols, alpha);
+
+    // write back only the transposed partial block
+    for (i = 0; i < cols; i++) {
+        _mm512_mask_storeu_pd(&B[i*ldb], st_mask, r[i]);
+    }
+}
+
+/*
+ * Swap the 8x8 tile of doubles at A with the 8x8 tile at B (both with row
+ * stride ld), transposing each on the way, for an in-place transpose.  Both
+ * tiles are loaded before either is stored.  A diagonal tile is passed as
+ * A == B and is transposed onto itself.  Streaming stores are never used here,
+ * since the tiles were just read and are still in cache.
+ */
+CPU_TARGET_AVX512
+static inline void transpose_dbl_avx_intr_8x8_swap(double *A, double *B,
+                                                   size_t ld)
+{
+    __m512d r[8], s[8];
+    size_t i;
+
+    for (i = 0; i < 8; i++) {
+        r[i] = _mm512_loadu_pd(&A[i*ld]);
+    }
+    transpose_dbl_avx_intr_8x8_reg(r);
+    if (A == B) {
+        for (i = 0; i < 8; i++) {
+            _mm512_storeu_pd(&A[i*ld], r[i]);
+        }
+        return;
+    }
+
+    for (i = 0; i < 8; i++) {
+        s[i] = _mm512_loadu_pd(&B[i*ld]);
+    }
+    transpose_dbl_avx_intr_8x8_reg(s);
+    for (i = 0; i < 8; i++) {
+        _mm512_storeu_pd(&B[i*ld], r[i]);
+        _mm512_storeu_pd(&A[i*ld], s[i]);
+    }
+}
+
+/*
+ * As above for a ragged pair: the tile at A is rows x cols and its mirror at B
+ * is cols x rows (both in [1, 8]).
+ */
+CPU_TARGET_AVX512
+static inline void transpose_dbl_avx_intr_8x8_swap_part(double *A, double *B,
+                                                        size_t ld,
+                                                        size_t rows,
+                                                        size_t cols)
+{
+    const __mmask8 a_mask = (__mmask8)((1u << cols) - 1);
+    const __mmask8 b_mask = (__mmask8)((1u << rows) - 1);
+    __m512d r[8], s[8];
+    size_t i;
+
+    // read both partial tiles, padding missing rows with zeros
+    for (i = 0; i < 8; i++) {
+        r[i] = i < rows ? _mm512_maskz_loadu_pd(a_mask, &A[i*ld])
+                        : _mm512_setzero_pd();
+        s[i] = i < cols ? _mm512_maskz_loadu_pd(b_mask, &B[i*ld])
+                        : _mm512_setzero_pd();
+    }
+
+    transpose_dbl_avx_intr_8x8_reg(r);
+    transpose_dbl_avx_intr_8x8_reg(s);
+
+    // on the diagonal both stores hit the same elements with the same values
+    for (i = 0; i < cols; i++) {
+        _mm512_mask_storeu_pd(&B[i*ld], b_mask, r[i]);
+    }
+    for (i = 0; i < rows; i++) {
+        _mm512_mask_storeu_pd(&A[i*ld], a_mask, s[i]);
+    }
+}
+
+/*
+ * Transpose 16 rows of 16 floats in registers.  Floats are first interleaved in
+ * 32-bit and 64-bit steps within 128-bit lanes, which leaves 4x4 sub-blocks in
+ * place, then the 128-bit lanes themselves are transposed in two shuffle
+ * stages.
+ */
+CPU_TARGET_AVX512
+static inline void transpose_flt_avx_intr_16x16_reg(__m512 r[16])
+{
+    __m512 s[16];
+    size_t i;
+
+    // interleave pairs of rows 32 bits at a time within 128-bit lanes
+    for (i = 0; i < 16; i += 2) {
+        s[i] = _mm512_unpacklo_ps(r[i], r[i+1]);
+        s[i+1] = _mm512_unpackhi_ps(r[i], r[i+1]);
+    }
+
+    // interleave pairs of rows 64 bits at a time within 128-bit lanes; each
+    // lane of r[4g+k] now holds column (4*lane + k) of rows 4g to 4g+3
+    for (i = 0; i < 16; i += 4) {
+        r[i] = _mm512_castpd_ps(_mm512_unpacklo_pd(_mm512_castps_pd(s[i]),
+                                                   _mm512_castps_pd(s[i+2])));
+        r[i+1] = _mm512_castpd_ps(_mm512_unpackhi_pd(_mm512_castps_pd(s[i]),
+                                                     _mm512_castps_pd(s[i+2])));
+        r[i+2] = _mm512_castpd_ps(_mm512_unpacklo_pd(_mm512_castps_pd(s[i+1]),
+                                                     _mm512_castps_pd(s[i+3])));
+        r[i+3] = _mm512_castpd_ps(_mm512_unpackhi_pd(_mm512_castps_pd(s[i+1]),
+                                                     _mm512_castps_pd(s[i+3])));
+    }
+
+    // shuffle 128-bit lanes between row groups 0/1 and 2/3
+    for (i = 0; i < 4; i++) {
+        s[i] = _mm512_shuffle_f32x4(r[i], r[4+i], 0x44);
+        s[4+i] = _mm512_shuffle_f32x4(r[i], r[4+i], 0xee);
+        s[8+i] = _mm512_shuffle_f32x4(r[8+i], r[12+i], 0x44);
+        s[12+i] = _mm512_shuffle_f32x4(r[8+i], r[12+i], 0xee);
+    }
+
+    // gather the matching 128-bit lanes from all four row groups
+    for (i = 0; i < 4; i++) {
+        r[i] = _mm512_shuffle_f32x4(s[i], s[8+i], 0x88);
+        r[4+i] = _mm512_shuffle_f32x4(s[i], s[8+i], 0xdd);
+        r[8+i] = _mm512_shuffle_f32x4(s[4+i], s[12+i], 0x88);
+        r[12+i] = _mm512_shuffle_f32x4(s[4+i], s[12+i], 0xdd);
+    }
+}
+
+/*
+ * Transpose a 16x16 block of floats.
+ */
+CPU_TARGET_AVX512
+static inline void transpose_flt_avx_intr_16x16_blk_st(const float* restrict A,
+                                                       float* restrict B,
+                                                       size_t lda, size_t ldb,
+                                                       const float *alpha, int nt)
+{
+    __m512 r[16];
+    size_t i;
+
+    // read 16x16 block of read array
+    for (i = 0; i < 16; i++) {
+        r[i] = _mm512_loadu_ps(&A[i*lda]);
+    }
+
+    transpose_flt_avx_intr_16x16_reg(r);
+    avx_intr_scale_flt(r, 16, alpha);
+
+    // write back 16x16 block of write array
+    if (nt && avx_intr_can_stream(B, ldb * sizeof(float))) {
+        for (i = 0; i < 16; i++) {
+            _mm512_stream_ps(&B[i*ldb], r[i]);
+        }
+        return;
+    }
+    for (i = 0; i < 16; i++) {
+        _mm512_storeu_ps(&B[i*ldb], r[i]);
+    }
+}
+
+CPU_TARGET_AVX512
+static inline void transpose_flt_avx_intr_16x16_blk(const float* restrict A,
+                                                    float* restrict B,
+                                                    size_t lda, size_t ldb,
+                                                    const float *alpha)
+{
+    transpose_flt_avx_intr_16x16_blk_st(A, B, lda, ldb, alpha, AVX_INTR_STREAM);
+}
+
+CPU_TARGET_AVX512
+static inline void transpose_flt_avx_intr_16x16_blk_nt(const float* restrict A,
+                                                       float* restrict B,
+                                                       size_t lda, size_t ldb,
+                                                       const float *alpha)
+{
+    transpose_flt_avx_intr_16x16_blk_st(A, B, lda, ldb, alpha, 1);
+}
+
+/*
+ * Transpose the top-left rows x cols corner (both in [1, 16]) of a 16x16 block
+ * of floats.
+ */
+CPU_TARGET_AVX512
+static inline void transpose_flt_avx_intr_16x16_blk_part(const float* restrict A,
+                                                         float* restrict B,
+                                                         size_t lda, size_t ldb,
+                                                         size_t rows,
+                                                         size_t cols,
+                                                         const float *alpha)
+{
+    const __mmask16 ld_mask = (__mmask16)((1u << cols) - 1);
+    const __mmask16 st_mask = (__mmask16)((1u << rows) - 1);
+    __m512 r[16];
+    size_t i;
+
+    // read the partial block, padding missing rows with zeros
+    for (i = 0; i < 16; i++) {
+        r[i] = i < rows ? _mm512_maskz_loadu_ps(ld_mask, &A[i*lda])
+                        : _mm512_setzero_ps();
+    }
+
+    transpose_flt_avx_intr_16x16_reg(r);
+    avx_intr_scale_flt(r, cols, alpha);
+
+    // write back only the transposed partial block
+    for (i = 0; i < cols; i++) {
+        _mm512_mask_storeu_ps(&B[i*ldb], st_mask, r[i]);
+    }
+}
+
+/*
+ * Transpose an 8x8 block of float complex values.  Each element is 8 bytes
+ * wide, so the double register transpose moves them unchanged; only the
+ * scaling needs to know the element type.
+ */
+CPU_TARGET_AVX512
+static inline void transpose_flt_cmplx_avx_intr_8x8_blk_st(const float complex* restrict A,
+                                                           float complex* restrict B,
+                                                           size_t lda, size_t ldb,
+                                                           const float complex *alpha, int nt)
+{
+    __m512d r[8];
+    size_t i;
+
+    // read 8x8 block of read array
+    for (i = 0; i < 8; i++) {
+        r[i] = _mm512_loadu_pd((const double *)&A[i*lda]);
+    }
+
+    transpose_dbl_avx_intr_8x8_reg(r);
+    avx_intr_scale_flt_cmplx(r, 8, alpha);
+
+    // write back 8x8 block of write array
+    if (nt && avx_intr_can_stream(B, ldb * sizeof(float complex))) {
+        for (i = 0; i < 8; i++) {
+            _mm512_stream_pd((double *)&B[i*ldb], r[i]);
+        }
+        return;
+    }
+    for (i = 0; i < 8; i++) {
+        _mm512_storeu_pd((double *)&B[i*ldb], r[i]);
+    }
+}
+
+CPU_TARGET_AVX512
+static inline void transpose_flt_cmplx_avx_intr_8x8_blk(const float complex* restrict A,
+                                                        float complex* restrict B,
+                                                        size_t lda, size_t ldb,
+                                                        const float complex *alpha)
+{
+    transpose_flt_cmplx_avx_intr_8x8_blk_st(A, B, lda, ldb, alpha, AVX_INTR_STREAM);
+}
+
+CPU_TARGET_AVX512
+static inline void transpose_flt_cmplx_avx_intr_8x8_blk_nt(const float complex* restrict A,
+                                                           float complex* restrict B,
+                                                           size_t lda, size_t ldb,
+                                                           const float complex *alpha)
+{
+    transpose_flt_cmplx_avx_intr_8x8_blk_st(A, B, lda, ldb, alpha, 1);
+}
+
+/*
+ * Transpose the top-left rows x cols corner (both in [1, 8]) of an 8x8 block
+ * of float complex values.
+ */
+CPU_TARGET_AVX512
+static inline void transpose_flt_cmplx_avx_intr_8x8_blk_part(const float complex* restrict A,
+                                                             float complex* restrict B,
+                                                             size_t lda, size_t ldb,
+                                                             size_t rows,
+                                                             size_t cols,
+                                                             const float complex *alpha)
+{
+    const __mmask8 ld_mask = (__mmask8)((1u << cols) - 1);
+    const __mmask8 st_mask = (__mmask8)((1u << rows) - 1);
+    __m512d r[8];
+    size_t i;
+
+    // read the partial block, padding missing rows with zeros
+    for (i = 0; i < 8; i++) {
+        r[i] = i < rows ? _mm512_maskz_loadu_pd(ld_mask, (const double *)&A[i*lda])
+                        : _mm512_setzero_pd();
+    }
+
+    transpose_dbl_avx_intr_8x8_reg(r);
+    avx_intr_scale_flt_cmplx(r, cols, alpha);
+
+    // write back only the transposed partial block
+    for (i = 0; i < cols; i++) {
+        _mm512_mask_storeu_pd((double *)&B[i*ldb], st_mask, r[i]);
+    }
+}
+
+/*
+ * Load the first cols (in [1, 8]) I/Q samples at p as float complex values
+ * scaled by scale, zeroing the rest of the vector.  The masked load touches
+ * only the bytes of those samples.
+ */
+CPU_TARGET_AVX512
+static inline __m512d avx_intr_load_iq16(const transpose_iq16_t *p,
+                                         size_t cols, __m512 scale)
+{
+    const __mmask16 mask = (__mmask16)((1u << (2 * cols)) - 1);
+    __m256i v = cols == 8 ? _mm256_loadu_si256((const __m256i *)p)
+                          : _mm256_maskz_loadu_epi16(mask, p);
+    __m512 f = _mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(v));
+    return _mm512_castps_pd(_mm512_mul_ps(f, scale));
+}
+
+/*
+ * As above for packed 12-bit samples.  The six bytes of the two samples for
+ * each 128-bit lane are first gathered into that lane by whole dwords.  The
+ * two bytes holding each I or Q are then shuffled into the top half of a dword
+ * of their own and shifted until the 12 bits sit in bits 20-31, from where an
+ * arithmetic shift sign-extends them.
+ */
+CPU_TARGET_AVX512
+static inline __m512d avx_intr_load_iq12(const transpose_iq12_t *p,
+                                         size_t cols, __m512 scale)
+{
+    const __mmask32 mask = (__mmask32)((1u << (3 * cols)) - 1);
+    // lane l takes dwords 0/1, 1/2, 3/4 and 4/5; its bytes start at 0 or 2
+    const __m512i dw_idx = _mm512_set_epi32(0, 0, 5, 4, 0, 0, 4, 3,
+                                            0, 0, 2, 1, 0, 0, 1, 0);
+    const __m512i byte_idx = _mm512_set_epi32(0x07068080, 0x06058080,
+                                              0x04038080, 0x03028080,
+                                              0x05048080, 0x04038080,
+                                              0x02018080, 0x01008080,
+                                              0x07068080, 0x06058080,
+                                              0x04038080, 0x03028080,
+                                              0x05048080, 0x04038080,
+                                              0x02018080, 0x01008080);
+    const __m512i shift = _mm512_set_epi32(0, 4, 0, 4, 0, 4, 0, 4,
+                                           0, 4, 0, 4, 0, 4, 0, 4);
+    __m512i v = _mm512_castsi256_si512(_mm256_maskz_loadu_epi8(mask, p));
+    v = _mm512_permutexvar_epi32(dw_idx, v);
+    v = _mm512_shuffle_epi8(v, byte_idx);
+    v = _mm512_srai_epi32(_mm512_sllv_epi32(v, shift), 20);
+    return _mm512_castps_pd(_mm512_mul_ps(_mm512_cvtepi32_ps(v), scale));
+}
+
+/*
+ * Ingest kernels for the I/Q format fmt: convert an 8x8 block of samples to
+ * float complex and transpose it like transpose_flt_cmplx_avx_intr_8x8_blk*.
+ * The scale is a float passed by value in place of alpha.
+ */
+#define TRANSPOSE_IQ_AVX_INTR_DEFINE(fmt) \
+CPU_TARGET_AVX512 \
+static inline void \
+transpose_##fmt##_flt_cmplx_avx_intr_8x8_blk_st(const transpose_##fmt##_t* restrict A, \
+                                                float complex* restrict B, \
+                                                size_t lda, size_t ldb, \
+                                                float scale, int nt) \
+{ \
+    const __m512 s = _mm512_set1_ps(scale); \
+    __m512d r[8]; \
+    size_t i; \
+    for (i = 0; i < 8; i++) { \
+        r[i] = avx_intr_load_##fmt(&A[i*lda], 8, s); \
+    } \
+    transpose_dbl_avx_intr_8x8_reg(r); \
+    if (nt && avx_intr_can_stream(B, ldb * sizeof(float complex))) { \
+        for (i = 0; i < 8; i++) { \
+            _mm512_stream_pd((double *)&B[i*ldb], r[i]); \
+        } \
+        return; \
+    } \
+    for (i = 0; i < 8; i++) { \
+        _mm512_storeu_pd((double *)&B[i*ldb], r[i]); \
+    } \
+} \
+\
+CPU_TARGET_AVX512 \
+static inline void \
+transpose_##fmt##_flt_cmplx_avx_intr_8x8_blk(const transpose_##fmt##_t* restrict A, \
+                                             float complex* restrict B, \
+                                             size_t lda, size_t ldb, \
+                                             float scale) \
+{ \
+    transpose_##fmt##_flt_cmplx_avx_intr_8x8_blk_st(A, B, lda, ldb, scale, \
+                                                    AVX_INTR_STREAM); \
+} \
+\
+CPU_TARGET_AVX512 \
+static inline void \
+transpose_##fmt##_flt_cmplx_avx_intr_8x8_blk_nt(const transpose_##fmt##_t* restrict A, \
+                                                float complex* restrict B, \
+                                                size_t lda, size_t ldb, \
+                                                float scale) \
+{ \
+    transpose_##fmt##_flt_cmplx_avx_intr_8x8_blk_st(A, B, lda, ldb, scale, 1); \
+} \
+\
+CPU_TARGET_AVX512 \
+static inline void \
+transpose_##fmt##_flt_cmplx_avx_intr_8x8_blk_part(const transpose_##fmt##_t* restrict A, \
+                                                  float complex* restrict B, \
+                                                  size_t lda, size_t ldb, \
+                                                  size_t rows, size_t cols, \
+                                                  float scale) \
+{ \
+    const __mmask8 st_mask = (__mmask8)((1u << rows) - 1); \
+    const __m512 s = _mm512_set1_ps(scale); \
+    __m512d r[8]; \
+    size_t i; \
+    for (i = 0; i < 8; i++) { \
+        r[i] = i < rows ? avx_intr_load_##fmt(&A[i*lda], cols, s) \
+                        : _mm512_setzero_pd(); \
+    } \
+    transpose_dbl_avx_intr_8x8_reg(r); \
+    for (i = 0; i < cols; i++) { \
+        _mm512_mask_storeu_pd((double *)&B[i*ldb], st_mask, r[i]); \
+    } \
+}
+
+TRANSPOSE_IQ_AVX_INTR_DEFINE(iq16)
+TRANSPOSE_IQ_AVX_INTR_DEFINE(iq12)
+
+/*
+ * Transpose 4 rows of 4 double complex values in registers.  Each zmm register
+ * holds one row of four 128-bit complex elements, so the transpose is two
+ * stages of 128-bit lane shuffles.
+ */
+CPU_TARGET_AVX512
+static inline void transpose_dbl_cmplx_avx_intr_4x4_reg(__m512d r[4])
+{
+    __m512d s[4];
+
+    // pair up the low and high halves of rows 0/1 and 2/3
+    s[0] = _mm512_shuffle_f64x2(r[0], r[1], 0x44);
+    s[1] = _mm512_shuffle_f64x2(r[0], r[1], 0xee);
+    s[2] = _mm512_shuffle_f64x2(r[2], r[3], 0x44);
+    s[3] = _mm512_shuffle_f64x2(r[2], r[3], 0xee);
+
+    // gather the matching complex element from each row
+    r[0] = _mm512_shuffle_f64x2(s[0], s[2], 0x88);
+    r[1] = _mm512_shuffle_f64x2(s[0], s[2], 0xdd);
+    r[2] = _mm512_shuffle_f64x2(s[1], s[3], 0x88);
+    r[3] = _mm512_shuffle_f64x2(s[1], s[3], 0xdd);
+}
+
+/*
+ * Transpose a 4x4 block of double complex values.
+ */
+CPU_TARGET_AVX512
+static inline void transpose_dbl_cmplx_avx_intr_4x4_blk_st(const double complex* restrict A,
+                                                           double complex* restrict B,
+                                                           size_t lda, size_t ldb,
+                                                           const double complex *alpha, int nt)
+{
+    __m512d r[4];
+    size_t i;
+
+    // read 4x4 block of read array
+    for (i = 0; i < 4; i++) {
+        r[i] = _mm512_loadu_pd((const double *)&A[i*lda]);
+    }
+
+    transpose_dbl_cmplx_avx_intr_4x4_reg(r);
+    avx_intr_scale_dbl_cmplx(r, 4, alpha);
+
+    // write back 4x4 block of write array
+    if (nt && avx_intr_can_stream(B, ldb * sizeof(double complex))) {
+        for (i = 0; i < 4; i++) {
+            _mm512_stream_pd((double *)&B[i*ldb], r[i]);
+        }
+        return;
+    }
+    for (i = 0; i < 4; i++) {
+        _mm512_storeu_pd((double *)&B[i*ldb], r[i]);
+    }
+}
+
+CPU_TARGET_AVX512
+static inline void transpose_dbl_cmplx_avx_intr_4x4_blk(const double complex* restrict A,
+                                                        double complex* restrict B,
+                                                        size_t lda, size_t ldb,
+                                                        const double complex *alpha)
+{
+    transpose_dbl_cmplx_avx_intr_4x4_blk_st(A, B, lda, ldb, alpha, AVX_INTR_STREAM);
+}
+
+CPU_TARGET_AVX512
+static inline void transpose_dbl_cmplx_avx_intr_4x4_blk_nt(const double complex* restrict A,
+                                                           double complex* restrict B,
+                                                           size_t lda, size_t ldb,
+                                                           const double complex *alpha)
+{
+    transpose_dbl_cmplx_avx_intr_4x4_blk_st(A, B, lda, ldb, alpha, 1);
+}
+
+/*
+ * Transpose the top-left rows x cols corner (both in [1, 4]) of a 4x4 block of
+ * double complex values.  Each complex element covers two mask bits.
+ */
+CPU_TARGET_AVX512
+static inline void transpose_dbl_cmplx_avx_intr_4x4_blk_part(const double complex* restrict A,
+                                                             double complex* restrict B,
+                                                             size_t lda, size_t ldb,
+                                                             size_t rows,
+                                                             size_t cols,
+                                                             const double complex *alpha)
+{
+    const __mmask8 ld_mask = (__mmask8)((1u << (2 * cols)) - 1);
+    const __mmask8 st_mask = (__mmask8)((1u << (2 * rows)) - 1);
+    __m512d r[4];
+    size_t i;
+
+    // read the partial block, padding missing rows with zeros
+    for (i = 0; i < 4; i++) {
+        r[i] = i < rows ? _mm512_maskz_loadu_pd(ld_mask, (const double *)&A[i*lda])
+                        : _mm512_setzero_pd();
+    }
+
+    transpose_dbl_cmplx_avx_intr_4x4_reg(r);
+    avx_intr_scale_dbl_cmplx(r, cols, alpha);
+
+    // write back only the transposed partial block
+    for (i = 0; i < cols; i++) {
+        _mm512_mask_storeu_pd((double *)&B[i*ldb], st_mask, r[i]);
+    }
+}
+
+/*
+ * One stage of an in-lane unpack network over n rows: within each group of
+ * 2 * stride registers, row i is interleaved with row i + stride, width bits
+ * at a time.  Unpacks never cross 128-bit lanes, so each lane of the n
+ * registers is transposed on its own.
+ */
+#define AVX_INTR_UNPACK_STAGE(r, n, stride, width) \
+    do { \
+        __m512i _t[n]; \
+        size_t _g, _k; \
+        for (_g = 0; _g < (n); _g += 2 * (stride)) { \
+            for (_k = 0; _k < (stride); _k++) { \
+                _t[_g + 2 * _k] = \
+                    _mm512_unpacklo_##width((r)[_g + _k], \
+                                            (r)[_g + _k + (stride)]); \
+                _t[_g + 2 * _k + 1] = \
+                    _mm512_unpackhi_##width((r)[_g + _k], \
+                                            (r)[_g + _k + (stride)]); \
+            } \
+        } \
+        for (_k = 0; _k < (n); _k++) { \
+            (r)[_k] = _t[_k]; \
+        } \
+    } while (0)
+
+CPU_TARGET_AVX512
+static inline void avx_intr_store_128(void *p, __m128i v, int nt)
+{
+    if (nt) {
+        _mm_stream_si128((__m128i *)p, v);
+    } else {
+        _mm_storeu_si128((__m128i *)p, v);
+    }
+}
+
+CPU_TARGET_AVX512
+static inline void avx_intr_store_256(void *p, __m256i v, int nt)
+{
+    if (nt) {
+        _mm256_stream_si256((__m256i *)p, v);
+    } else {
+        _mm256_storeu_si256((__m256i *)p, v);
+    }
+}
+
+/*
+ * Transpose 16 rows of 64 bytes in registers as four independent 16x16 tiles,
+ * one per 128-bit lane: afterwards lane l of r[j] holds row 16*l + j of the
+ * transposed 64x16 block.
+ */
+CPU_TARGET_AVX512
+static inline void transpose_u8_avx_intr_16x16_reg(__m512i r[16])
+{
+    AVX_INTR_UNPACK_STAGE(r, 16, 1, epi8);
+    AVX_INTR_UNPACK_STAGE(r, 16, 2, epi16);
+    AVX_INTR_UNPACK_STAGE(r, 16, 4, epi32);
+    AVX_INTR_UNPACK_STAGE(r, 16, 8, epi64);
+}
+
+/*
+ * Transpose a 16x64 block of bytes, i.e., four adjacent 16x16 tiles.  Each
+ * output row is 16 bytes, so streaming needs only 16-byte alignment.
+ */
+CPU_TARGET_AVX512
+static inline void transpose_u8_avx_intr_16x16_blk_st(const uint8_t* restrict A,
+                                                      uint8_t* restrict B,
+                                                      size_t lda, size_t ldb,
+                                                      int nt)
+{
+    __m512i r[16];
+    size_t i;
+
+    // read 16x64 block of read array
+    for (i = 0; i < 16; i++) {
+        r[i] = _mm512_loadu_si512(&A[i*lda]);
+    }
+
+    transpose_u8_avx_intr_16x16_reg(r);
+
+    // write back the 64x16 block of write array one lane at a time
+    nt = nt && (uintptr_t)B % 16 == 0 && ldb % 16 == 0;
+    for (i = 0; i < 16; i++) {
+        avx_intr_store_128(&B[i*ldb], _mm512_castsi512_si128(r[i]), nt);
+        avx_intr_store_128(&B[(16+i)*ldb],
+                           _mm512_extracti32x4_epi32(r[i], 1), nt);
+        avx_intr_store_128(&B[(32+i)*ldb],
+                           _mm512_extracti32x4_epi32(r[i], 2), nt);
+        avx_intr_store_128(&B[(48+i)*ldb],
+                           _mm512_extracti32x4_epi32(r[i], 3), nt);
+    }
+}
+
+CPU_TARGET_AVX512
+static inline void transpose_u8_avx_intr_16x16_blk(const uint8_t* restrict A,
+                                                   uint8_t* restrict B,
+                                                   size_t lda, size_t ldb)
+{
+    transpose_u8_avx_intr_16x16_blk_st(A, B, lda, ldb, AVX_INTR_STREAM);
+}
+
+CPU_TARGET_AVX512
+static inline void transpose_u8_avx_intr_16x16_blk_nt(const uint8_t* restrict A,
+                                                      uint8_t* restrict B,
+                                                      size_t lda, size_t ldb)
+{
+    transpose_u8_avx_intr_16x16_blk_st(A, B, lda, ldb, 1);
+}
+
+/*
+ * Transpose the top-left rows x cols corner (rows in [1, 16], cols in [1, 64])
+ * of a 16x64 block of bytes.
+ */
+CPU_TARGET_AVX512
+static inline void transpose_u8_avx_intr_16x16_blk_part(const uint8_t* restrict A,
+                                                        uint8_t* restrict B,
+                                                        size_t lda, size_t ldb,
+                                                        size_t rows,
+                                                        size_t cols)
+{
+    const __mmask64 ld_mask = cols == 64 ? ~(__mmask64)0
+                                         : ((__mmask64)1 << cols) - 1;
+    const __mmask16 st_mask = (__mmask16)((1u << rows) - 1);
+    _Alignas(64) uint8_t buf[16][64];
+    __m512i r[16];
+    size_t i;
+
+    // read the partial block, padding missing rows with zeros
+    for (i = 0; i < 16; i++) {
+        r[i] = i < rows ? _mm512_maskz_loadu_epi8(ld_mask, &A[i*lda])
+                        : _mm512_setzero_si512();
+    }
+
+    transpose_u8_avx_intr_16x16_reg(r);
+
+    // write back only the transposed partial block; lane l of buf[j] is row
+    // 16*l + j
+    for (i = 0; i < 16; i++) {
+        _mm512_store_si512(buf[i], r[i]);
+    }
+    for (i = 0; i < cols; i++) {
+        _mm_mask_storeu_epi8(&B[i*ldb], st_mask,
+                             _mm_load_si128((const __m128i *)
+                                            &buf[i % 16][i / 16 * 16]));
+    }
+}
+
+/*
+ * Transpose 8 rows of 32 16-bit words in registers as four independent 8x8
+ * tiles, one per 128-bit lane: afterwards lane l of r[j] holds row 8*l + j of
+ * the transposed 32x8 block.
+ */
+CPU_TARGET_AVX512
+static inline void transpose_i16_avx_intr_8x8_reg(__m512i r[8])
+{
+    AVX_INTR_UNPACK_STAGE(r, 8, 1, epi16);
+    AVX_INTR_UNPACK_STAGE(r, 8, 2, epi32);
+    AVX_INTR_UNPACK_STAGE(r, 8, 4, epi64);
+}
+
+/*
+ * Transpose 16 rows of 32 words in registers.  Rows 0-7 and 8-15 are
+ * transposed separately, then the 128-bit lanes of the two halves are paired
+ * up: afterwards the low (high) 256 bits of r[j] hold row j (8 + j) and those
+ * of r[8 + j] hold row 16 + j (24 + j) of the transposed 32x16 block.
+ */
+CPU_TARGET_AVX512
+static inline void transpose_i16_avx_intr_16x16_reg(__m512i r[16])
+{
+    __m512i lo, hi;
+    size_t i;
+
+    transpose_i16_avx_intr_8x8_reg(r);
+    transpose_i16_avx_intr_8x8_reg(r + 8);
+
+    for (i = 0; i < 8; i++) {
+        // lanes 0/1 and 2/3 of the upper and lower halves, then interleave
+        // them so each 256-bit half is one whole output row
+        lo = _mm512_shuffle_i64x2(r[i], r[8+i], 0x44);
+        hi = _mm512_shuffle_i64x2(r[i], r[8+i], 0xee);
+        r[i] = _mm512_shuffle_i64x2(lo, lo, 0xd8);
+        r[8+i] = _mm512_shuffle_i64x2(hi, hi, 0xd8);
+    }
+}
+
+/*
+ * Transpose a 16x32 block of 16-bit words, i.e., two adjacent 16x16 tiles.
+ * Each output row is 32 bytes, so streaming needs only 32-byte alignment.
+ */
+CPU_TARGET_AVX512
+static inline void transpose_i16_avx_intr_16x16_blk_st(const int16_t* restrict A,
+                                                       int16_t* restrict B,
+                                                       size_t lda, size_t ldb,
+                                                       int nt)
+{
+    __m512i r[16];
+    size_t i;
+
+    // read 16x32 block of read array
+    for (i = 0; i < 16; i++) {
+        r[i] = _mm512_loadu_si512(&A[i*lda]);
+    }
+
+    transpose_i16_avx_intr_16x16_reg(r);
+
+    // write back the 32x16 block of write array one half at a time
+    nt = nt && (uintptr_t)B % 32 == 0 && ldb * sizeof(int16_t) % 32 == 0;
+    for (i = 0; i < 8; i++) {
+        avx_intr_store_256(&B[i*ldb], _mm512_castsi512_si256(r[i]), nt);
+        avx_intr_store_256(&B[(8+i)*ldb],
+                           _mm512_extracti64x4_epi64(r[i], 1), nt);
+        avx_intr_store_256(&B[(16+i)*ldb],
+                           _mm512_castsi512_si256(r[8+i]), nt);
+        avx_intr_store_256(&B[(24+i)*ldb],
+                           _mm512_extracti64x4_epi64(r[8+i], 1), nt);
+    }
+}
+
+CPU_TARGET_AVX512
+static inline void transpose_i16_avx_intr_16x16_blk(const int16_t* restrict A,
+                                                    int16_t* restrict B,
+                                                    size_t lda, size_t ldb)
+{
+    transpose_i16_avx_intr_16x16_blk_st(A, B, lda, ldb, AVX_INTR_STREAM);
+}
+
+CPU_TARGET_AVX512
+static inline void transpose_i16_avx_intr_16x16_blk_nt(const int16_t* restrict A,
+                                                       int16_t* restrict B,
+                                                       size_t lda, size_t ldb)
+{
+    transpose_i16_avx_intr_16x16_blk_st(A, B, lda, ldb, 1);
+}
+
+/*
+ * Transpose the top-left rows x cols corner (rows in [1, 16], cols in [1, 32])
+ * of a 16x32 block of 16-bit words.
+ */
+CPU_TARGET_AVX512
+static inline void transpose_i16_avx_intr_16x16_blk_part(const int16_t* restrict A,
+                                                         int16_t* restrict B,
+                                                         size_t lda, size_t ldb,
+                                                         size_t rows,
+                                                         size_t cols)
+{
+    const __mmask32 ld_mask = cols == 32 ? ~(__mmask32)0
+                                         : ((__mmask32)1 << cols) - 1;
+    const __mmask16 st_mask = (__mmask16)((1u << rows) - 1);
+    _Alignas(64) int16_t buf[16][32];
+    __m512i r[16];
+    size_t i;
+
+    // read the partial block, padding missing rows with zeros
+    for (i = 0; i < 16; i++) {
+        r[i] = i < rows ? _mm512_maskz_loadu_epi16(ld_mask, &A[i*lda])
+                        : _mm512_setzero_si512();
+    }
+
+    transpose_i16_avx_intr_16x16_reg(r);
+
+    // write back only the transposed partial block; output row 8*h + j is
+    // half h of buf[j] for h < 2, and half h - 2 of buf[8 + j] otherwise
+    for (i = 0; i < 16; i++) {
+        _mm512_store_si512(buf[i], r[i]);
+    }
+    for (i = 0; i < cols; i++) {
+        _mm256_mask_storeu_epi16(&B[i*ldb], st_mask,
+                                 _mm256_load_si256((const __m256i *)
+                                     &buf[i / 16 * 8 + i % 8][i / 8 % 2 * 16]));
+    }
+}
+
+/*
+ * Load the first cols (in [1, 16]) doubles at p rounded to float, zeroing the
+ * rest of the vector.
+ */
+CPU_TARGET_AVX512
+static inline __m512 avx_intr_load_dbl_flt(const double *p, size_t cols)
+{
+    __m256 lo, hi;
+    if (cols == 16) {
+        lo = _mm512_cvtpd_ps(_mm512_loadu_pd(p));
+        hi = _mm512_cvtpd_ps(_mm512_loadu_pd(p + 8));
+    } else {
+        const size_t n_lo = cols < 8 ? cols : 8;
+        lo = _mm512_cvtpd_ps(_mm512_maskz_loadu_pd((__mmask8)((1u << n_lo) - 1),
+                                                   p));
+        hi = cols > 8 ? _mm512_cvtpd_ps(_mm512_maskz_loadu_pd(
+                            (__mmask8)((1u << (cols - 8)) - 1), p + 8))
+                      : _mm256_setzero_ps();
+    }
+    return _mm512_insertf32x8(_mm512_castps256_ps512(lo), hi, 1);
+}
+
+// as above for cols (in [1, 8]) double complex values, as float complex
+CPU_TARGET_AVX512
+static inline __m512d avx_intr_load_dbl_cmplx_flt_cmplx(const double complex *p,
+                                                        size_t cols)
+{
+    return _mm512_castps_pd(avx_intr_load_dbl_flt((const double *)p,
+                                                  2 * cols));
+}
+
+CPU_TARGET_AVX512
+static inline __m512 avx_intr_load_flt(const float *p, size_t cols)
+{
+    return cols == 16 ? _mm512_loadu_ps(p)
+                      : _mm512_maskz_loadu_ps((__mmask16)((1u << cols) - 1), p);
+}
+
+// float complex values are loaded as doubles to move them as one element
+CPU_TARGET_AVX512
+static inline __m512d avx_intr_load_flt_cmplx(const float complex *p,
+                                              size_t cols)
+{
+    return cols == 8 ? _mm512_loadu_pd((const double *)p)
+                     : _mm512_maskz_loadu_pd((__mmask8)((1u << cols) - 1),
+                                             (const double *)p);
+}
+
+/*
+ * Round 16 floats to fp16 or bf16.  Without AVX512_BF16, bf16 rounds to
+ * nearest even with integer arithmetic on the bit patterns, quieting NaNs
+ * instead of rounding them and flushing subnormals to a signed zero like the
+ * instruction does (see transpose-cvt.h).
+ */
+CPU_TARGET_AVX512
+static inline __m256i avx_intr_cvt_fp16(__m512 v)
+{
+    return _mm512_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+}
+
+CPU_TARGET_AVX512
+static inline __m256i avx_intr_cvt_bf16(__m512 v)
+{
+    const __m512i x = _mm512_castps_si512(v);
+    const __mmask16 nan = _mm512_cmp_ps_mask(v, v, _CMP_UNORD_Q);
+    const __mmask16 tiny = _mm512_testn_epi32_mask(x,
+                                                   _mm512_set1_epi32(0x7f800000));
+    __m512i r = _mm512_and_si512(_mm512_srli_epi32(x, 16),
+                                 _mm512_set1_epi32(1));
+    r = _mm512_add_epi32(x, _mm512_add_epi32(r, _mm512_set1_epi32(0x7fff)));
+    r = _mm512_mask_or_epi32(r, nan, x, _mm512_set1_epi32(0x400000));
+    r = _mm512_mask_and_epi32(r, tiny, x, _mm512_set1_epi32(0x80000000));
+    return _mm512_cvtepi32_epi16(_mm512_srli_epi32(r, 16));
+}
+
+#if defined(CPU_TARGET_AVX512_BF16)
+CPU_TARGET_AVX512_BF16
+static inline __m256i avx_intr_cvt_bf16_native(__m512 v)
+{
+    return (__m256i)_mm512_cvtneps_pbh(v);
+}
+#endif
+
+/*
+ * Row stores for the converting kernels: the plain ones write a whole row,
+ * streaming when nt is set, and the *_part ones the first rows elements.
+ */
+CPU_TARGET_AVX512
+static inline void avx_intr_store_flt(float *p, __m512 v, int nt)
+{
+    if (nt) {
+        _mm512_stream_ps(p, v);
+    } else {
+        _mm512_storeu_ps(p, v);
+    }
+}
+
+CPU_TARGET_AVX512
+static inline void avx_intr_store_flt_part(float *p, __m512 v, size_t rows)
+{
+    _mm512_mask_storeu_ps(p, (__mmask16)((1u << rows) - 1), v);
+}
+
+CPU_TARGET_AVX512
+static inline void avx_intr_store_flt_cmplx(float complex *p, __m512d v,
+                                            int nt)
+{
+    if (nt) {
+        _mm512_stream_pd((double *)p, v);
+    } else {
+        _mm512_storeu_pd((double *)p, v);
+    }
+}
+
+CPU_TARGET_AVX512
+static inline void avx_intr_store_flt_cmplx_part(float complex *p, __m512d v,
+                                                 size_t rows)
+{
+    _mm512_mask_storeu_pd((double *)p, (__mmask8)((1u << rows) - 1), v);
+}
+
+/*
+ * Stores avx_intr_store_name* that round to the 16-bit format fmt with fn_cvt
+ * on the way out: the real ones take 16 floats, the complex ones 8 float
+ * complex values.
+ */
+#define AVX_INTR_STORE_HALF_DEFINE(target, name, fmt, fn_cvt) \
+target \
+static inline void avx_intr_store_##name(transpose_##fmt##_t *p, __m512 v, \
+                                         int nt) \
+{ \
+    avx_intr_store_256(p, fn_cvt(v), nt); \
+} \
+\
+target \
+static inline void avx_intr_store_##name##_part(transpose_##fmt##_t *p, \
+                                                __m512 v, size_t rows) \
+{ \
+    _mm256_mask_storeu_epi16(p, (__mmask16)((1u << rows) - 1), fn_cvt(v)); \
+} \
+\
+target \
+static inline void avx_intr_store_##name##_cmplx(transpose_##fmt##_cmplx_t *p, \
+                                                 __m512d v, int nt) \
+{ \
+    avx_intr_store_256(p, fn_cvt(_mm512_castpd_ps(v)), nt); \
+} \
+\
+target \
+static inline void avx_intr_store_##name##_cmplx_part(transpose_##fmt##_cmplx_t *p, \
+                                                      __m512d v, size_t rows) \
+{ \
+    _mm256_mask_storeu_epi32(p, (__mmask8)((1u << rows) - 1), \
+                             fn_cvt(_mm512_castpd_ps(v))); \
+}
+
+AVX_INTR_STORE_HALF_DEFINE(CPU_TARGET_AVX512, fp16, fp16, avx_intr_cvt_fp16)
+AVX_INTR_STORE_HALF_DEFINE(CPU_TARGET_AVX512, bf16, bf16, avx_intr_cvt_bf16)
+
+/*
+ * Precision-converting kernels name: transpose an n x n tile of in_t held as
+ * one vec_t per row, converting to out_t as each row is loaded (fn_load, when
+ * narrowing halves the data to transpose) or stored (fn_store).  fn_reg is the
+ * register transpose for vec_t and fn_zero pads the missing rows of a partial
+ * tile.  The kernels take no alpha, like the integer ones.
+ */
+#define TRANSPOSE_CVT_AVX_INTR_DEFINE(target, name, in_t, out_t, n, vec_t, \
+                                      fn_zero, fn_reg, fn_load, fn_store, \
+                                      fn_store_part) \
+target \
+static inline void transpose_##name##_blk_st(const in_t* restrict A, \
+                                             out_t* restrict B, \
+                                             size_t lda, size_t ldb, int nt) \
+{ \
+    vec_t r[n]; \
+    size_t i; \
+    for (i = 0; i < (n); i++) { \
+        r[i] = fn_load(&A[i*lda], (n)); \
+    } \
+    fn_reg(r); \
+    if (nt && avx_intr_can_stream_row(B, ldb * sizeof(out_t), \
+                                      (n) * sizeof(out_t))) { \
+        for (i = 0; i < (n); i++) { \
+            fn_store(&B[i*ldb], r[i], 1); \
+        } \
+        return; \
+    } \
+    for (i = 0; i < (n); i++) { \
+        fn_store(&B[i*ldb], r[i], 0); \
+    } \
+} \
+\
+target \
+static inline void transpose_##name##_blk(const in_t* restrict A, \
+                                          out_t* restrict B, \
+                                          size_t lda, size_t ldb) \
+{ \
+    transpose_##name##_blk_st(A, B, lda, ldb, AVX_INTR_STREAM); \
+} \
+\
+target \
+static inline void transpose_##name##_blk_nt(const in_t* restrict A, \
+                                             out_t* restrict B, \
+                                             size_t lda, size_t ldb) \
+{ \
+    transpose_##name##_blk_st(A, B, lda, ldb, 1); \
+} \
+\
+target \
+static inline void transpose_##name##_blk_part(const in_t* restrict A, \
+                                               out_t* restrict B, \
+                                               size_t lda, size_t ldb, \
+                                               size_t rows, size_t cols) \
+{ \
+    vec_t r[n]; \
+    size_t i; \
+    for (i = 0; i < rows; i++) { \
+        r[i] = fn_load(&A[i*lda], cols); \
+    } \
+    for (; i < (n); i++) { \
+        r[i] = fn_zero(); \
+    } \
+    fn_reg(r); \
+    for (i = 0; i < cols; i++) { \
+        fn_store_part(&B[i*ldb], r[i], rows); \
+    } \
+}
+
+TRANSPOSE_CVT_AVX_INTR_DEFINE(CPU_TARGET_AVX512, dbl_flt_avx_intr_16x16,
+                              double, float, 16, __m512, _mm512_setzero_ps,
+                              transpose_flt_avx_intr_16x16_reg,
+                              avx_intr_load_dbl_flt, avx_intr_store_flt,
+                              avx_intr_store_flt_part)
+TRANSPOSE_CVT_AVX_INTR_DEFINE(CPU_TARGET_AVX512,
+                              dbl_cmplx_flt_cmplx_avx_intr_8x8,
+                              double complex, float complex, 8, __m512d,
+                              _mm512_setzero_pd, transpose_dbl_avx_intr_8x8_reg,
+                              avx_intr_load_dbl_cmplx_flt_cmplx,
+                              avx_intr_store_flt_cmplx,
+                              avx_intr_store_flt_cmplx_part)
+TRANSPOSE_CVT_AVX_INTR_DEFINE(CPU_TARGET_AVX512, flt_fp16_avx_intr_16x16,
+                              float, transpose_fp16_t, 16, __m512,
+                              _mm512_setzero_ps,
+                              transpose_flt_avx_intr_16x16_reg,
+                              avx_intr_load_flt, avx_intr_store_fp16,
+                              avx_intr_store_fp16_part)
+TRANSPOSE_CVT_AVX_INTR_DEFINE(CPU_TARGET_AVX512, flt_bf16_avx_intr_16x16,
+                              float, transpose_bf16_t, 16, __m512,
+                              _mm512_setzero_ps,
+                              transpose_flt_avx_intr_16x16_reg,
+                              avx_intr_load_flt, avx_intr_store_bf16,
+                              avx_intr_store_bf16_part)
+TRANSPOSE_CVT_AVX_INTR_DEFINE(CPU_TARGET_AVX512,
+                              flt_cmplx_fp16_cmplx_avx_intr_8x8,
+                              float complex, transpose_fp16_cmplx_t, 8, __m512d,
+                              _mm512_setzero_pd, transpose_dbl_avx_intr_8x8_reg,
+                              avx_intr_load_flt_cmplx,
+                              avx_intr_store_fp16_cmplx,
+                              avx_intr_store_fp16_cmplx_part)
+TRANSPOSE_CVT_AVX_INTR_DEFINE(CPU_TARGET_AVX512,
+                              flt_cmplx_bf16_cmplx_avx_intr_8x8,
+                              float complex, transpose_bf16_cmplx_t, 8, __m512d,
+                              _mm512_setzero_pd, transpose_dbl_avx_intr_8x8_reg,
+                              avx_intr_load_flt_cmplx,
+                              avx_intr_store_bf16_cmplx,
+                              avx_intr_store_bf16_cmplx_part)
+
+/*
+ * bf16 kernels built for AVX512_BF16, which the callers select at run time
+ * when avx_intr_have_bf16 says the CPU has it.
+ */
+#if defined(CPU_TARGET_AVX512_BF16)
+static int avx_intr_bf16;
+
+static void avx_intr_bf16_init(void)
+{
+    struct cpu_features f;
+    cpu_features_detect(&f);
+    avx_intr_bf16 = f.avx512bf16;
+}
+
+// CPUID is slow, so detect once rather than on every transpose
+static inline int avx_intr_have_bf16(void)
+{
+    static pthread_once_t bf16_once = PTHREAD_ONCE_INIT;
+    pthread_once(&bf16_once, avx_intr_bf16_init);
+    return avx_intr_bf16;
+}
+
+AVX_INTR_STORE_HALF_DEFINE(CPU_TARGET_AVX512_BF16, bf16_native, bf16,
+                           avx_intr_cvt_bf16_native)
+TRANSPOSE_CVT_AVX_INTR_DEFINE(CPU_TARGET_AVX512_BF16,
+                              flt_bf16_avx_intr_16x16_native,
+                              float, transpose_bf16_t, 16, __m512,
+                              _mm512_setzero_ps,
+                              transpose_flt_avx_intr_16x16_reg,
+                              avx_intr_load_flt, avx_intr_store_bf16_native,
+                              avx_intr_store_bf16_native_part)
+TRANSPOSE_CVT_AVX_INTR_DEFINE(CPU_TARGET_AVX512_BF16,
+                              flt_cmplx_bf16_cmplx_avx_intr_8x8_native,
+                              float complex, transpose_bf16_cmplx_t, 8, __m512d,
+                              _mm512_setzero_pd, transpose_dbl_avx_intr_8x8_reg,
+                              avx_intr_load_flt_cmplx,
+                              avx_intr_store_bf16_native_cmplx,
+                              avx_intr_store_bf16_native_cmplx_part)
+#endif
+
+/*
+ * Split real and imaginary parts of complex values held in lo:hi (the first
+ * and second half of a row) into re and im, and interleave them back.
+ */
+CPU_TARGET_AVX512
+static inline void avx_intr_deinterleave_ps(__m512 lo, __m512 hi,
+                                            __m512 *re, __m512 *im)
+{
+    const __m512i even = _mm512_set_epi32(30, 28, 26, 24, 22, 20, 18, 16,
+                                          14, 12, 10, 8, 6, 4, 2, 0);
+    const __m512i odd = _mm512_set_epi32(31, 29, 27, 25, 23, 21, 19, 17,
+                                         15, 13, 11, 9, 7, 5, 3, 1);
+    *re = _mm512_permutex2var_ps(lo, even, hi);
+    *im = _mm512_permutex2var_ps(lo, odd, hi);
+}
+
+CPU_TARGET_AVX512
+static inline void avx_intr_interleave_ps(__m512 re, __m512 im,
+                                          __m512 *lo, __m512 *hi)
+{
+    const __m512i idx_lo = _mm512_set_epi32(23, 7, 22, 6, 21, 5, 20, 4,
+                                            19, 3, 18, 2, 17, 1, 16, 0);
+    const __m512i idx_hi = _mm512_set_epi32(31, 15, 30, 14, 29, 13, 28, 12,
+                                            27, 11, 26, 10, 25, 9, 24, 8);
+    *lo = _mm512_permutex2var_ps(re, idx_lo, im);
+    *hi = _mm512_permutex2var_ps(re, idx_hi, im);
+}
+
+CPU_TARGET_AVX512
+static inline void avx_intr_deinterleave_pd(__m512d lo, __m512d hi,
+                                            __m512d *re, __m512d *im)
+{
+    const __m512i even = _mm512_set_epi64(14, 12, 10, 8, 6, 4, 2, 0);
+    const __m512i odd = _mm512_set_epi64(15, 13, 11, 9, 7, 5, 3, 1);
+    *re = _mm512_permutex2var_pd(lo, even, hi);
+    *im = _mm512_permutex2var_pd(lo, odd, hi);
+}
+
+CPU_TARGET_AVX512
+static inline void avx_intr_interleave_pd(__m512d re, __m512d im,
+                                          __m512d *lo, __m512d *hi)
+{
+    const __m512i idx_lo = _mm512_set_epi64(11, 3, 10, 2, 9, 1, 8, 0);
+    const __m512i idx_hi = _mm512_set_epi64(15, 7, 14, 6, 13, 5, 12, 4);
+    *lo = _mm512_permutex2var_pd(re, idx_lo, im);
+    *hi = _mm512_permutex2var_pd(re, idx_hi, im);
+}
+
+/*
+ * Split-complex kernels for real_t (vectors of n elements, intrinsic suffix
+ * sfx, register transpose fn_reg): transpose_name_cmplx_split_* read an n x n
+ * tile of interleaved complex values and write its real and imaginary parts
+ * to separate planes, transpose_name_split_cmplx_* the reverse.  Each complex
+ * row of the tile spans two vectors, which are (de)interleaved in registers,
+ * so the planes are transposed as two real tiles.
+ */
+#define TRANSPOSE_SPLIT_AVX_INTR_DEFINE(name, real_t, cmplx_t, n, tile, vec_t, \
+                                        mask_t, sfx, fn_reg) \
+/* load cols (in [1, n]) complex values at p as re and im, zeroing the rest */ \
+CPU_TARGET_AVX512 \
+static inline void avx_intr_load_cmplx_split_##sfx(const cmplx_t *p, \
+                                                   size_t cols, \
+                                                   vec_t *re, vec_t *im) \
+{ \
+    const real_t *q = (const real_t *)p; \
+    vec_t lo, hi; \
+    if (cols == (n)) { \
+        lo = _mm512_loadu_##sfx(q); \
+        hi = _mm512_loadu_##sfx(q + (n)); \
+    } else { \
+        const size_t n_lo = 2 * cols < (n) ? 2 * cols : (n); \
+        lo = _mm512_maskz_loadu_##sfx((mask_t)((1u << n_lo) - 1), q); \
+        hi = 2 * cols > (n) \
+             ? _mm512_maskz_loadu_##sfx((mask_t)((1u << (2 * cols - (n))) - 1), \
+                                        q + (n)) \
+             : _mm512_setzero_##sfx(); \
+    } \
+    avx_intr_deinterleave_##sfx(lo, hi, re, im); \
+} \
+\
+/* store re and im interleaved as rows (in [1, n]) complex values at p */ \
+CPU_TARGET_AVX512 \
+static inline void avx_intr_store_split_cmplx_##sfx(cmplx_t *p, vec_t re, \
+                                                    vec_t im, size_t rows, \
+                                                    int nt) \
+{ \
+    real_t *q = (real_t *)p; \
+    vec_t lo, hi; \
+    avx_intr_interleave_##sfx(re, im, &lo, &hi); \
+    if (rows == (n) && nt) { \
+        _mm512_stream_##sfx(q, lo); \
+        _mm512_stream_##sfx(q + (n), hi); \
+    } else if (rows == (n)) { \
+        _mm512_storeu_##sfx(q, lo); \
+        _mm512_storeu_##sfx(q + (n), hi); \
+    } else { \
+        const size_t n_lo = 2 * rows < (n) ? 2 * rows : (n); \
+        _mm512_mask_storeu_##sfx(q, (mask_t)((1u << n_lo) - 1), lo); \
+        if (2 * rows > (n)) { \
+            _mm512_mask_storeu_##sfx(q + (n), \
+                                     (mask_t)((1u << (2 * rows - (n))) - 1), \
+                                     hi); \
+        } \
+    } \
+} \
+\
+CPU_TARGET_AVX512 \
+static inline void \
+transpose_##name##_cmplx_split_avx_intr_##tile##_blk_st(const cmplx_t* restrict A, \
+                                                        real_t* restrict B_re, \
+                                                        real_t* restrict B_im, \
+                                                        size_t lda, size_t ldb, \
+                                                        int nt) \
+{ \
+    vec_t re[n], im[n]; \
+    size_t i; \
+    for (i = 0; i < (n); i++) { \
+        avx_intr_load_cmplx_split_##sfx(&A[i*lda], (n), &re[i], &im[i]); \
+    } \
+    fn_reg(re); \
+    fn_reg(im); \
+    if (nt && avx_intr_can_stream(B_re, ldb * sizeof(real_t)) && \
+        avx_intr_can_stream(B_im, ldb * sizeof(real_t))) { \
+        for (i = 0; i < (n); i++) { \
+            _mm512_stream_##sfx(&B_re[i*ldb], re[i]); \
+            _mm512_stream_##sfx(&B_im[i*ldb], im[i]); \
+        } \
+        return; \
+    } \
+    for (i = 0; i < (n); i++) { \
+        _mm512_storeu_##sfx(&B_re[i*ldb], re[i]); \
+        _mm512_storeu_##sfx(&B_im[i*ldb], im[i]); \
+    } \
+} \
+\
+CPU_TARGET_AVX512 \
+static inline void \
+transpose_##name##_cmplx_split_avx_intr_##tile##_blk(const cmplx_t* restrict A, \
+                                                     real_t* restrict B_re, \
+                                                     real_t* restrict B_im, \
+                                                     size_t lda, size_t ldb) \
+{ \
+    transpose_##name##_cmplx_split_avx_intr_##tile##_blk_st(A, B_re, B_im, \
+                                                            lda, ldb, \
+                                                            AVX_INTR_STREAM); \
+} \
+\
+CPU_TARGET_AVX512 \
+static inline void \
+transpose_##name##_cmplx_split_avx_intr_##tile##_blk_nt(const cmplx_t* restrict A, \
+                                                        real_t* restrict B_re, \
+                                                        real_t* restrict B_im, \
+                                                        size_t lda, size_t ldb) \
+{ \
+    transpose_##name##_cmplx_split_avx_intr_##tile##_blk_st(A, B_re, B_im, \
+                                                            lda, ldb, 1); \
+} \
+\
+CPU_TARGET_AVX512 \
+static inline void \
+transpose_##name##_cmplx_split_avx_intr_##tile##_blk_part(const cmplx_t* restrict A, \
+                                                          real_t* restrict B_re, \
+                                                          real_t* restrict B_im, \
+                                                          size_t lda, size_t ldb, \
+                                                          size_t rows, \
+                                                          size_t cols) \
+{ \
+    const mask_t st_mask = (mask_t)((1u << rows) - 1); \
+    vec_t re[n], im[n]; \
+    size_t i; \
+    for (i = 0; i < rows; i++) { \
+        avx_intr_load_cmplx_split_##sfx(&A[i*lda], cols, &re[i], &im[i]); \
+    } \
+    for (; i < (n); i++) { \
+        re[i] = im[i] = _mm512_setzero_##sfx(); \
+    } \
+    fn_reg(re); \
+    fn_reg(im); \
+    for (i = 0; i < cols; i++) { \
+        _mm512_mask_storeu_##sfx(&B_re[i*ldb], st_mask, re[i]); \
+        _mm512_mask_storeu_##sfx(&B_im[i*ldb], st_mask, im[i]); \
+    } \
+} \
+\
+CPU_TARGET_AVX512 \
+static inline void \
+transpose_##name##_split_cmplx_avx_intr_##tile##_blk_st(const real_t* restrict A_re, \
+                                                        const real_t* restrict A_im, \
+                                                        cmplx_t* restrict B, \
+                                                        size_t lda, size_t ldb, \
+                                                        int nt) \
+{ \
+    vec_t re[n], im[n]; \
+    size_t i; \
+    for (i = 0; i < (n); i++) { \
+        re[i] = _mm512_loadu_##sfx(&A_re[i*lda]); \
+        im[i] = _mm512_loadu_##sfx(&A_im[i*lda]); \
+    } \
+    fn_reg(re); \
+    fn_reg(im); \
+    nt = nt && avx_intr_can_stream(B, ldb * sizeof(cmplx_t)); \
+    for (i = 0; i < (n); i++) { \
+        avx_intr_store_split_cmplx_##sfx(&B[i*ldb], re[i], im[i], (n), nt); \
+    } \
+} \
+\
+CPU_TARGET_AVX512 \
+static inline void \
+transpose_##name##_split_cmplx_avx_intr_##tile##_blk(const real_t* restrict A_re, \
+                                                     const real_t* restrict A_im, \
+                                                     cmplx_t* restrict B, \
+                                                     size_t lda, size_t ldb) \
+{ \
+    transpose_##name##_split_cmplx_avx_intr_##tile##_blk_st(A_re, A_im, B, \
+                                                            lda, ldb, \
+                                                            AVX_INTR_STREAM); \
+} \
+\
+CPU_TARGET_AVX512 \
+static inline void \
+transpose_##name##_split_cmplx_avx_intr_##tile##_blk_nt(const real_t* restrict A_re, \
+                                                        const real_t* restrict A_im, \
+                                                        cmplx_t* restrict B, \
+                                                        size_t lda, size_t ldb) \
+{ \
+    transpose_##name##_split_cmplx_avx_intr_##tile##_blk_st(A_re, A_im, B, \
+                                                            lda, ldb, 1); \
+} \
+\
+CPU_TARGET_AVX512 \
+static inline void \
+transpose_##name##_split_cmplx_avx_intr_##tile##_blk_part(const real_t* restrict A_re, \
+                                                          const real_t* restrict A_im, \
+                                                          cmplx_t* restrict B, \
+                                                          size_t lda, size_t ldb, \
+                                                          size_t rows, \
+                                                          size_t cols) \
+{ \
+    const mask_t ld_mask = (mask_t)((1u << cols) - 1); \
+    vec_t re[n], im[n]; \
+    size_t i; \
+    for (i = 0; i < rows; i++) { \
+        re[i] = _mm512_maskz_loadu_##sfx(ld_mask, &A_re[i*lda]); \
+        im[i] = _mm512_maskz_loadu_##sfx(ld_mask, &A_im[i*lda]); \
+    } \
+    for (; i < (n); i++) { \
+        re[i] = im[i] = _mm512_setzero_##sfx(); \
+    } \
+    fn_reg(re); \
+    fn_reg(im); \
+    for (i = 0; i < cols; i++) { \
+        avx_intr_store_split_cmplx_##sfx(&B[i*ldb], re[i], im[i], rows, 0); \
+    } \
+}
+
+TRANSPOSE_SPLIT_AVX_INTR_DEFINE(flt, float, float complex, 16, 16x16, __m512,
+                                __mmask16, ps, transpose_flt_avx_intr_16x16_reg)
+TRANSPOSE_SPLIT_AVX_INTR_DEFINE(dbl, double, double complex, 8, 8x8, __m512d,
+                                __mmask8, pd, transpose_dbl_avx_intr_8x8_reg)
+
+/*
+ * Apply the epilogue of epi, except alpha, to rows x cols elements (both in
+ * [1, 8]) of A at (r0, c0), held one row per register before the tile is
+ * transposed.  The twiddle table has the row stride ldt.  Windows are
+ * duplicated across each (re, im) pair; complex multiplies work like
+ * avx_intr_scale_flt_cmplx with the real and imaginary parts of the twiddles
+ * duplicated instead of broadcast.
+ */
+CPU_TARGET_AVX512
+static inline void avx_intr_epi_flt_cmplx(__m512d *r, size_t rows, size_t cols,
+                                          const struct transpose_epi_flt_cmplx *epi,
+                                          size_t r0, size_t c0, size_t ldt)
+{
+    const __m512i dup = _mm512_set_epi32(7, 7, 6, 6, 5, 5, 4, 4,
+                                         3, 3, 2, 2, 1, 1, 0, 0);
+    const __mmask8 mask = (__mmask8)((1u << cols) - 1);
+    __m512 x, t, cw = _mm512_set1_ps(1.0f);
+    size_t i;
+
+    if (epi->col_win) {
+        cw = _mm512_permutexvar_ps(dup, _mm512_castps256_ps512(
+            _mm256_maskz_loadu_ps(mask, &epi->col_win[c0])));
+    }
+    for (i = 0; i < rows; i++) {
+        x = _mm512_castpd_ps(r[i]);
+        if (epi->conj) {
+            x = _mm512_mask_xor_ps(x, 0xaaaa, x, _mm512_set1_ps(-0.0f));
+        }
+        if (epi->row_win) {
+            x = _mm512_mul_ps(x, _mm512_set1_ps(epi->row_win[r0 + i]));
+        }
+        if (epi->col_win) {
+            x = _mm512_mul_ps(x, cw);
+        }
+        if (epi->twiddle) {
+            t = _mm512_castpd_ps(_mm512_maskz_loadu_pd(mask,
+                (const double *)&epi->twiddle[(r0 + i) * ldt + c0]));
+            x = _mm512_fmaddsub_ps(x, _mm512_moveldup_ps(t),
+                                   _mm512_mul_ps(_mm512_permute_ps(x, 0xb1),
+                                                 _mm512_movehdup_ps(t)));
+        }
+        r[i] = _mm512_castps_pd(x);
+    }
+}
+
+// as above for rows x cols (both in [1, 4]) double complex elements
+CPU_TARGET_AVX512
+static inline void avx_intr_epi_dbl_cmplx(__m512d *r, size_t rows, size_t cols,
+                                          const struct transpose_epi_dbl_cmplx *epi,
+                                          size_t r0, size_t c0, size_t ldt)
+{
+    const __m512i dup = _mm512_set_epi64(3, 3, 2, 2, 1, 1, 0, 0);
+    const __mmask8 mask = (__mmask8)((1u << cols) - 1);
+    const __mmask8 mask2 = (__mmask8)((1u << (2 * cols)) - 1);
+    __m512d x, t, cw = _mm512_set1_pd(1.0);
+    size_t i;
+
+    if (epi->col_win) {
+        cw = _mm512_permutexvar_pd(dup, _mm512_castpd256_pd512(
+            _mm256_maskz_loadu_pd(mask, &epi->col_win[c0])));
+    }
+    for (i = 0; i < rows; i++) {
+        x = r[i];
+        if (epi->conj) {
+            x = _mm512_mask_xor_pd(x, 0xaa, x, _mm512_set1_pd(-0.0));
+        }
+        if (epi->row_win) {
+            x = _mm512_mul_pd(x, _mm512_set1_pd(epi->row_win[r0 + i]));
+        }
+        if (epi->col_win) {
+            x = _mm512_mul_pd(x, cw);
+        }
+        if (epi->twiddle) {
+            t = _mm512_maskz_loadu_pd(mask2,
+                (const double *)&epi->twiddle[(r0 + i) * ldt + c0]);
+            x = _mm512_fmaddsub_pd(x, _mm512_movedup_pd(t),
+                                   _mm512_mul_pd(_mm512_permute_pd(x, 0x55),
+                                                 _mm512_permute_pd(t, 0xff)));
+        }
+        r[i] = x;
+    }
+}
+
+/*
+ * Epilogue kernels for the complex element type of name, n x n tiles that are
+ * moved by fn_reg and whose elements take lanes double lanes each: apply the
+ * epilogue to the rows of the tile at (r0, c0) as they are loaded, transpose
+ * them and scale the columns by alpha.  The twiddle table is laid out like A.
+ */
+#define TRANSPOSE_EPI_AVX_INTR_DEFINE(name, cmplx_t, n, tile, lanes, fn_reg) \
+CPU_TARGET_AVX512 \
+static inline void \
+transpose_##name##_avx_intr_##tile##_epi_blk_st(const cmplx_t* restrict A, \
+                                                cmplx_t* restrict B, \
+                                                size_t lda, size_t ldb, \
+                                                const struct transpose_epi_##name *epi, \
+                                                size_t r0, size_t c0, int nt) \
+{ \
+    __m512d r[n]; \
+    size_t i; \
+    for (i = 0; i < (n); i++) { \
+        r[i] = _mm512_loadu_pd((const double *)&A[i*lda]); \
+    } \
+    avx_intr_epi_##name(r, (n), (n), epi, r0, c0, lda); \
+    fn_reg(r); \
+    avx_intr_scale_##name(r, (n), &epi->alpha); \
+    if (nt && avx_intr_can_stream(B, ldb * sizeof(cmplx_t))) { \
+        for (i = 0; i < (n); i++) { \
+            _mm512_stream_pd((double *)&B[i*ldb], r[i]); \
+        } \
+        return; \
+    } \
+    for (i = 0; i < (n); i++) { \
+        _mm512_storeu_pd((double *)&B[i*ldb], r[i]); \
+    } \
+} \
+\
+CPU_TARGET_AVX512 \
+static inline void \
+transpose_##name##_avx_intr_##tile##_epi_blk(const cmplx_t* restrict A, \
+                                             cmplx_t* restrict B, \
+                                             size_t lda, size_t ldb, \
+                                             const struct transpose_epi_##name *epi, \
+                                             size_t r0, size_t c0) \
+{ \
+    transpose_##name##_avx_intr_##tile##_epi_blk_st(A, B, lda, ldb, epi, \
+                                                    r0, c0, AVX_INTR_STREAM); \
+} \
+\
+CPU_TARGET_AVX512 \
+static inline void \
+transpose_##name##_avx_intr_##tile##_epi_blk_nt(const cmplx_t* restrict A, \
+                                                cmplx_t* restrict B, \
+                                                size_t lda, size_t ldb, \
+                                                const struct transpose_epi_##name *epi, \
+                                                size_t r0, size_t c0) \
+{ \
+    transpose_##name##_avx_intr_##tile##_epi_blk_st(A, B, lda, ldb, epi, \
+                                                    r0, c0, 1); \
+} \
+\
+CPU_TARGET_AVX512 \
+static inline void \
+transpose_##name##_avx_intr_##tile##_epi_blk_part(const cmplx_t* restrict A, \
+                                                  cmplx_t* restrict B, \
+                                                  size_t lda, size_t ldb, \
+                                                  size_t rows, size_t cols, \
+                                                  const struct transpose_epi_##name *epi, \
+                                                  size_t r0, size_t c0) \
+{ \
+    const __mmask8 ld_mask = (__mmask8)((1u << ((lanes) * cols)) - 1); \
+    const __mmask8 st_mask = (__mmask8)((1u << ((lanes) * rows)) - 1); \
+    __m512d r[n]; \
+    size_t i; \
+    for (i = 0; i < (n); i++) { \
+        r[i] = i < rows ? _mm512_maskz_loadu_pd(ld_mask, (const double *)&A[i*lda]) \
+                        : _mm512_setzero_pd(); \
+    } \
+    avx_intr_epi_##name(r, rows, cols, epi, r0, c0, lda); \
+    fn_reg(r); \
+    avx_intr_scale_##name(r, cols, &epi->alpha); \
+    for (i = 0; i < cols; i++) { \
+        _mm512_mask_storeu_pd((double *)&B[i*ldb], st_mask, r[i]); \
+    } \
+}
+
+TRANSPOSE_EPI_AVX_INTR_DEFINE(flt_cmplx, float complex, 8, 8x8, 1,
+                              transpose_dbl_avx_intr_8x8_reg)
+TRANSPOSE_EPI_AVX_INTR_DEFINE(dbl_cmplx, double complex, 4, 4x4, 2,
+                              transpose_dbl_cmplx_avx_intr_4x4_reg)
+
+/*
+ * For the permuting transposes, define transpose_<name>_avx_intr_<tile>_perm_*
+ * kernels that load tile row i from A[src[i] * lda] and store tile row k to
+ * B[dst[k] * ldb], i.e., A and B point to the first column of the tile in
+ * row 0 and src and dst hold absolute row indices.  n is the tile size, vec_t
+ * and the intrinsic suffix sfx those of a row of real_t, and lanes the real_t
+ * lanes per element.
+ */
+#define TRANSPOSE_PERM_AVX_INTR_DEFINE(name, elem_t, real_t, n, tile, vec_t, \
+                                       mask_t, sfx, lanes, fn_reg) \
+CPU_TARGET_AVX512 \
+static inline void \
+transpose_##name##_avx_intr_##tile##_perm_blk_st(const elem_t* restrict A, \
+                                                 elem_t* restrict B, \
+                                                 size_t lda, size_t ldb, \
+                                                 const size_t *src, \
+                                                 const size_t *dst, int nt) \
+{ \
+    vec_t r[n]; \
+    size_t i; \
+    for (i = 0; i < (n); i++) { \
+        r[i] = _mm512_loadu_##sfx((const real_t *)&A[src[i]*lda]); \
+    } \
+    fn_reg(r); \
+    /* rows of B are aligned when they all start on a line */ \
+    if (nt && avx_intr_can_stream(B, ldb * sizeof(elem_t))) { \
+        for (i = 0; i < (n); i++) { \
+            _mm512_stream_##sfx((real_t *)&B[dst[i]*ldb], r[i]); \
+        } \
+        return; \
+    } \
+    for (i = 0; i < (n); i++) { \
+        _mm512_storeu_##sfx((real_t *)&B[dst[i]*ldb], r[i]); \
+    } \
+} \
+\
+CPU_TARGET_AVX512 \
+static inline void \
+transpose_##name##_avx_intr_##tile##_perm_blk(const elem_t* restrict A, \
+                                              elem_t* restrict B, \
+                                              size_t lda, size_t ldb, \
+                                              const size_t *src, \
+                                              const size_t *dst) \
+{ \
+    transpose_##name##_avx_intr_##tile##_perm_blk_st(A, B, lda, ldb, src, dst, \
+                                                     AVX_INTR_STREAM); \
+} \
+\
+CPU_TARGET_AVX512 \
+static inline void \
+transpose_##name##_avx_intr_##tile##_perm_blk_nt(const elem_t* restrict A, \
+                                                 elem_t* restrict B, \
+                                                 size_t lda, size_t ldb, \
+                                                 const size_t *src, \
+                                                 const size_t *dst) \
+{ \
+    transpose_##name##_avx_intr_##tile##_perm_blk_st(A, B, lda, ldb, src, dst, \
+                                                     1); \
+} \
+\
+CPU_TARGET_AVX512 \
+static inline void \
+transpose_##name##_avx_intr_##tile##_perm_blk_part(const elem_t* restrict A, \
+                                                   elem_t* restrict B, \
+                                                   size_t lda, size_t ldb, \
+                                                   size_t rows, size_t cols, \
+                                                   const size_t *src, \
+                                                   const size_t *dst) \
+{ \
+    const mask_t ld_mask = (mask_t)((1u << ((lanes) * cols)) - 1); \
+    const mask_t st_mask = (mask_t)((1u << ((lanes) * rows)) - 1); \
+    vec_t r[n]; \
+    size_t i; \
+    for (i = 0; i < (n); i++) { \
+        r[i] = i < rows ? _mm512_maskz_loadu_##sfx(ld_mask, \
+                                                   (const real_t *)&A[src[i]*lda]) \
+                        : _mm512_setzero_##sfx(); \
+    } \
+    fn_reg(r); \
+    for (i = 0; i < cols; i++) { \
+        _mm512_mask_storeu_##sfx((real_t *)&B[dst[i]*ldb], st_mask, r[i]); \
+    } \
+}
+
+TRANSPOSE_PERM_AVX_INTR_DEFINE(flt, float, float, 16, 16x16, __m512, __mmask16,
+                               ps, 1, transpose_flt_avx_intr_16x16_reg)
+TRANSPOSE_PERM_AVX_INTR_DEFINE(dbl, double, double, 8, 8x8, __m512d, __mmask8,
+                               pd, 1, transpose_dbl_avx_intr_8x8_reg)
+TRANSPOSE_PERM_AVX_INTR_DEFINE(dbl_cmplx, double complex, double, 4, 4x4,
+                               __m512d, __mmask8, pd, 2,
+                               transpose_dbl_cmplx_avx_intr_4x4_reg)
+
+/*
+ * Tile loops over a row range [r_min, r_max) and column range [c_min, c_max)
+ * of A (row stride lda) into B (row stride ldb).  Interior tiles use the full
+ * kernel; tiles cut by r_max or c_max use the masked *_part kernel.
+ */
+#define TRANSPOSE_AVX_INTR_TILES(A, lda, B, ldb, r_min, r_max, c_min, c_max, \
+                                 blk, alpha, fn_blk, fn_blk_part) \
+    do { \
+        size_t _i, _j, _m, _n; \
+        for (_i = (r_min); _i < (r_max); _i += (blk)) { \
+            _m = (r_max) - _i < (blk) ? (r_max) - _i : (blk); \
+            for (_j = (c_min); _j < (c_max); _j += (blk)) { \
+                _n = (c_max) - _j < (blk) ? (c_max) - _j : (blk); \
+                if (_m == (blk) && _n == (blk)) { \
+                    fn_blk(&(A)[_i * (lda) + _j], &(B)[_j * (ldb) + _i], \
+                           (lda), (ldb), (alpha)); \
+                } else { \
+                    fn_blk_part(&(A)[_i * (lda) + _j], &(B)[_j * (ldb) + _i], \
+                                (lda), (ldb), _m, _n, (alpha)); \
+                } \
+            } \
+        } \
+    } while (0)
+
+/*
+ * TRANSPOSE_AVX_INTR_TILES with streaming stores for the full tiles when nt is
+ * set (see transpose-nt.h), followed by a fence so the weakly-ordered stores
+ * are visible before the caller returns.
+ */
+#define TRANSPOSE_AVX_INTR_TILES_NT(A, lda, B, ldb, r_min, r_max, c_min, \
+                                    c_max, blk, alpha, nt, fn_blk, fn_blk_nt, \
+                                    fn_blk_part) \
+    do { \
+        if (nt) { \
+            TRANSPOSE_AVX_INTR_TILES(A, lda, B, ldb, r_min, r_max, c_min, \
+                                     c_max, blk, alpha, fn_blk_nt, \
+                                     fn_blk_part); \
+            _mm_sfence(); \
+        } else { \
+            TRANSPOSE_AVX_INTR_TILES(A, lda, B, ldb, r_min, r_max, c_min, \
+                                     c_max, blk, alpha, fn_blk, fn_blk_part); \
+        } \
+    } while (0)
+
+/*
+ * Tile loop for the integer kernels, whose tiles are blk_rows x blk_cols and
+ * which take no alpha.  Streams, and fences, when nt is set.
+ */
+#define TRANSPOSE_AVX_INTR_TILES_RECT_NT(A, lda, B, ldb, r_min, r_max, c_min, \
+                                         c_max, blk_rows, blk_cols, nt, \
+                                         fn_blk, fn_blk_nt, fn_blk_part) \
+    do { \
+        size_t _i, _j, _m, _n; \
+        for (_i = (r_min); _i < (r_max); _i += (blk_rows)) { \
+            _m = (r_max) - _i < (blk_rows) ? (r_max) - _i : (blk_rows); \
+            for (_j = (c_min); _j < (c_max); _j += (blk_cols)) { \
+                _n = (c_max) - _j < (blk_cols) ? (c_max) - _j : (blk_cols); \
+                if (_m < (blk_rows) || _n < (blk_cols)) { \
+                    fn_blk_part(&(A)[_i * (lda) + _j], &(B)[_j * (ldb) + _i], \
+                                (lda), (ldb), _m, _n); \
+                } else if (nt) { \
+                    fn_blk_nt(&(A)[_i * (lda) + _j], &(B)[_j * (ldb) + _i], \
+                              (lda), (ldb)); \
+                } else { \
+                    fn_blk(&(A)[_i * (lda) + _j], &(B)[_j * (ldb) + _i], \
+                           (lda), (ldb)); \
+                } \
+            } \
+        } \
+        if (nt) { \
+            _mm_sfence(); \
+        } \
+    } while (0)
+
+/*
+ * Tile loops for the split-complex kernels, which read (TO_SPLIT) or write
+ * (FROM_SPLIT) separate real and imaginary planes with the same row stride.
+ * Square tiles of blk; streams, and fences, when nt is set.
+ */
+#define TRANSPOSE_AVX_INTR_TO_SPLIT_TILES_NT(A, lda, B_re, B_im, ldb, r_min, \
+                                             r_max, c_min, c_max, blk, nt, \
+                                             fn_blk, fn_blk_nt, fn_blk_part) \
+    do { \
+        size_t _i, _j, _m, _n; \
+        for (_i = (r_min); _i < (r_max); _i += (blk)) { \
+            _m = (r_max) - _i < (blk) ? (r_max) - _i : (blk); \
+            for (_j = (c_min); _j < (c_max); _j += (blk)) { \
+                _n = (c_max) - _j < (blk) ? (c_max) - _j : (blk); \
+                if (_m < (blk) || _n < (blk)) { \
+                    fn_blk_part(&(A)[_i * (lda) + _j], \
+                                &(B_re)[_j * (ldb) + _i], \
+                                &(B_im)[_j * (ldb) + _i], \
+                                (lda), (ldb), _m, _n); \
+                } else if (nt) { \
+                    fn_blk_nt(&(A)[_i * (lda) + _j], \
+                              &(B_re)[_j * (ldb) + _i], \
+                              &(B_im)[_j * (ldb) + _i], (lda), (ldb)); \
+                } else { \
+                    fn_blk(&(A)[_i * (lda) + _j], &(B_re)[_j * (ldb) + _i], \
+                           &(B_im)[_j * (ldb) + _i], (lda), (ldb)); \
+                } \
+            } \
+        } \
+        if (nt) { \
+            _mm_sfence(); \
+        } \
+    } while (0)
+
+#define TRANSPOSE_AVX_INTR_FROM_SPLIT_TILES_NT(A_re, A_im, lda, B, ldb, r_min, \
+                                               r_max, c_min, c_max, blk, nt, \
+                                               fn_blk, fn_blk_nt, \
+                                               fn_blk_part) \
+    do { \
+        size_t _i, _j, _m, _n; \
+        for (_i = (r_min); _i < (r_max); _i += (blk)) { \
+            _m = (r_max) - _i < (blk) ? (r_max) - _i : (blk); \
+            for (_j = (c_min); _j < (c_max); _j += (blk)) { \
+                _n = (c_max) - _j < (blk) ? (c_max) - _j : (blk); \
+                if (_m < (blk) || _n < (blk)) { \
+                    fn_blk_part(&(A_re)[_i * (lda) + _j], \
+                                &(A_im)[_i * (lda) + _j], \
+                                &(B)[_j * (ldb) + _i], (lda), (ldb), _m, _n); \
+                } else if (nt) { \
+                    fn_blk_nt(&(A_re)[_i * (lda) + _j], \
+                              &(A_im)[_i * (lda) + _j], \
+                              &(B)[_j * (ldb) + _i], (lda), (ldb)); \
+                } else { \
+                    fn_blk(&(A_re)[_i * (lda) + _j], \
+                           &(A_im)[_i * (lda) + _j], \
+                           &(B)[_j * (ldb) + _i], (lda), (ldb)); \
+                } \
+            } \
+        } \
+        if (nt) { \
+            _mm_sfence(); \
+        } \
+    } while (0)
+
+/*
+ * Tile loop for the epilogue kernels, which also take epi and the position of
+ * each tile in A.  Square tiles of blk; streams, and fences, when nt is set.
+ */
+#define TRANSPOSE_AVX_INTR_EPI_TILES_NT(A, lda, B, ldb, r_min, r_max, c_min, \
+                                        c_max, blk, epi, nt, fn_blk, \
+                                        fn_blk_nt, fn_blk_part) \
+    do { \
+        size_t _i, _j, _m, _n; \
+        for (_i = (r_min); _i < (r_max); _i += (blk)) { \
+            _m = (r_max) - _i < (blk) ? (r_max) - _i : (blk); \
+            for (_j = (c_min); _j < (c_max); _j += (blk)) { \
+                _n = (c_max) - _j < (blk) ? (c_max) - _j : (blk); \
+                if (_m < (blk) || _n < (blk)) { \
+                    fn_blk_part(&(A)[_i * (lda) + _j], &(B)[_j * (ldb) + _i], \
+                                (lda), (ldb), _m, _n, (epi), _i, _j); \
+                } else if (nt) { \
+                    fn_blk_nt(&(A)[_i * (lda) + _j], &(B)[_j * (ldb) + _i], \
+                              (lda), (ldb), (epi), _i, _j); \
+                } else { \
+                    fn_blk(&(A)[_i * (lda) + _j], &(B)[_j * (ldb) + _i], \
+                           (lda), (ldb), (epi), _i, _j); \
+                } \
+            } \
+        } \
+        if (nt) { \
+            _mm_sfence(); \
+        } \
+    } while (0)
+
+/*
+ * Tile loop for the unrolled double kernel: the part of the range covered by
+ * whole 8*nr x 8*nc blocks goes to fn_unroll, the strips left over at the
+ * right and bottom to the 8x8 kernels.  Streams, and fences, when nt is set.
+ */
+#define TRANSPOSE_AVX_INTR_TILES_UNROLL(A, lda, B, ldb, r_min, r_max, c_min, \
+                                        c_max, nr, nc, alpha, nt, fn_unroll, \
+                                        fn_blk, fn_blk_nt, fn_blk_part) \
+    do { \
+        const size_t _ur = (r_min) + ((r_max) - (r_min)) / (8 * (nr)) * \
+                           (8 * (nr)); \
+        const size_t _uc = (c_min) + ((c_max) - (c_min)) / (8 * (nc)) * \
+                           (8 * (nc)); \
+        size_t _ui, _uj; \
+        for (_ui = (r_min); _ui < _ur; _ui += 8 * (nr)) { \
+            for (_uj = (c_min); _uj < _uc; _uj += 8 * (nc)) { \
+                fn_unroll(&(A)[_ui * (lda) + _uj], &(B)[_uj * (ldb) + _ui], \
+                          (lda), (ldb), (alpha), (nt), (nr), (nc)); \
+            } \
+        } \
+        if (nt) { \
+            TRANSPOSE_AVX_INTR_TILES(A, lda, B, ldb, r_min, _ur, _uc, c_max, \
+                                     8, alpha, fn_blk_nt, fn_blk_part); \
+            TRANSPOSE_AVX_INTR_TILES(A, lda, B, ldb, _ur, r_max, c_min, c_max, \
+                                     8, alpha, fn_blk_nt, fn_blk_part); \
+            _mm_sfence(); \
+        } else { \
+            TRANSPOSE_AVX_INTR_TILES(A, lda, B, ldb, r_min, _ur, _uc, c_max, \
+                                     8, alpha, fn_blk, fn_blk_part); \
+            TRANSPOSE_AVX_INTR_TILES(A, lda, B, ldb, _ur, r_max, c_min, c_max, \
+                                     8, alpha, fn_blk, fn_blk_part); \
+        } \
+    } while (0)
+
+/*
+ * TRANSPOSE_AVX_INTR_TILES that also prefetches the register tile pf_dist tiles
+ * ahead in the same row-major order (pf_dist must be non-zero).
+ */
+#define TRANSPOSE_AVX_INTR_TILES_PF(A, lda, B, ldb, r_min, r_max, c_min, \
+                                    c_max, blk, alpha, pf_dist, pf_hint, \
+                                    fn_blk, fn_blk_part) \
+    do { \
+        const size_t _ncb = ((c_max) - (c_min) + (blk) - 1) / (blk); \
+        size_t _i, _j, _m, _n; \
+        size_t _pi = (r_min) + (pf_dist) / _ncb * (blk); \
+        size_t _pj = (c_min) + (pf_dist) % _ncb * (blk); \
+        for (_i = (r_min); _i < (r_max); _i += (blk)) { \
+            _m = (r_max) - _i < (blk) ? (r_max) - _i : (blk); \
+            for (_j = (c_min); _j < (c_max); _j += (blk)) { \
+                _n = (c_max) - _j < (blk) ? (c_max) - _j : (blk); \
+                if (_pi < (r_max)) { \
+                    transpose_prefetch_tile((A), (lda), (B), (ldb), \
+                                            sizeof(*(A)), _pi, \
+                                            (r_max) - _pi < (blk) ? \
+                                                (r_max) : _pi + (blk), \
+                                            _pj, \
+                                            (c_max) - _pj < (blk) ? \
+                                                (c_max) : _pj + (blk), \
+                                            (pf_hint)); \
+                    _pj += (blk); \
+                    if (_pj >= (c_max)) { \
+                        _pj = (c_min); \
+                        _pi += (blk); \
+                    } \
+                } \
+                if (_m == (blk) && _n == (blk)) { \
+                    fn_blk(&(A)[_i * (lda) + _j], &(B)[_j * (ldb) + _i], \
+                           (lda), (ldb), (alpha)); \
+                } else { \
+                    fn_blk_part(&(A)[_i * (lda) + _j], &(B)[_j * (ldb) + _i], \
+                                (lda), (ldb), _m, _n, (alpha)); \
+                } \
+            } \
+        } \
+    } while (0)
+
+/*
+ * Write-combining tile loop (see transpose-wc.h): each tile x tile piece of
+ * rows [r_min, r_max) and columns [c_min, c_max) is transposed by the register
+ * kernels into an aligned staging buffer, whose rows are then streamed to B.
+ */
+#define TRANSPOSE_AVX_INTR_WC_TILES(datatype, A, lda, B, ldb, r_min, r_max, \
+                                    c_min, c_max, tile, blk, fn_blk, \
+                                    fn_blk_part) \
+    do { \
+        _Alignas(64) datatype _buf[(tile) * (tile)]; \
+        size_t _ti, _tj, _tm, _tn, _tc; \
+        for (_ti = (r_min); _ti < (r_max); _ti += (tile)) { \
+            _tm = (r_max) - _ti < (tile) ? (r_max) - _ti : (tile); \
+            for (_tj = (c_min); _tj < (c_max); _tj += (tile)) { \
+                _tn = (c_max) - _tj < (tile) ? (c_max) - _tj : (tile); \
+                TRANSPOSE_AVX_INTR_TILES(&(A)[_ti * (lda) + _tj], (lda), \
+                                         _buf, (tile), 0, _tm, 0, _tn, \
+                                         (blk), NULL, fn_blk, fn_blk_part); \
+                for (_tc = 0; _tc < _tn; _tc++) { \
+                    avx_intr_stream_copy(&(B)[(_tj + _tc) * (ldb) + _ti], \
+                                         &_buf[_tc * (tile)], \
+                                         _tm * sizeof(datatype)); \
+                } \
+            } \
+        } \
+        _mm_sfence(); \
+    } while (0)
+
+/*
+ * In-place tile loop over the tile rows starting in [r_min, r_max) of the
+ * n x n matrix A: every tile on or above the diagonal is swapped with its
+ * mirror by fn_swap, or by the masked fn_swap_part when cut by the edge.
+ */
+#define TRANSPOSE_AVX_INTR_INPLACE_TILES(A, n, r_min, r_max, blk, \
+                                         fn_swap, fn_swap_part) \
+    do { \
+        size_t _i, _j, _m, _n; \
+        for (_i = (r_min); _i < (r_max); _i += (blk)) { \
+            _m = (n) - _i < (blk) ? (n) - _i : (blk); \
+            for (_j = _i; _j < (n); _j += (blk)) { \
+                _n = (n) - _j < (blk) ? (n) - _j : (blk); \
+                if (_m == (blk) && _n == (blk)) { \
+                    fn_swap(&(A)[_i * (n) + _j], &(A)[_j * (n) + _i], (n)); \
+                } else { \
+                    fn_swap_part(&(A)[_i * (n) + _j], &(A)[_j * (n) + _i], \
+                                 (n), _m, _n); \
+                } \
+            } \
+        } \
+    } while (0)
+
+/*
+ * Tile loop for the permuting kernels over the A_rows x A_cols matrix A: tile
+ * (j, c) fills columns [j, j + blk) of B from the rows src[j..] of A and writes
+ * columns [c, c + blk) of A to the rows dst[c..] of B.  src has A_rows and dst
+ * A_cols entries.  Streams, and fences, when nt is set.
+ */
+#define TRANSPOSE_AVX_INTR_PERM_TILES_NT(A, lda, B, ldb, A_rows, A_cols, src, \
+                                         dst, blk, nt, fn_blk, fn_blk_nt, \
+                                         fn_blk_part) \
+    do { \
+        size_t _j, _c, _m, _n; \
+        for (_j = 0; _j < (A_rows); _j += (blk)) { \
+            _m = (A_rows) - _j < (blk) ? (A_rows) - _j : (blk); \
+            for (_c = 0; _c < (A_cols); _c += (blk)) { \
+                _n = (A_cols) - _c < (blk) ? (A_cols) - _c : (blk); \
+                if (_m < (blk) || _n < (blk)) { \
+                    fn_blk_part(&(A)[_c], &(B)[_j], (lda), (ldb), _m, _n, \
+                                &(src)[_j], &(dst)[_c]); \
+                } else if (nt) { \
+                    fn_blk_nt(&(A)[_c], &(B)[_j], (lda), (ldb), &(src)[_j], \
+                              &(dst)[_c]); \
+                } else { \
+                    fn_blk(&(A)[_c], &(B)[_j], (lda), (ldb), &(src)[_j], \
+                           &(dst)[_c]); \
+                } \
+            } \
+        } \
+        if (nt) { \
+            _mm_sfence(); \
+        } \
+    } while (0)
+
+/*
+ * Skinny kernels, for an A with k <= AVX_INTR_SKINNY_MAX columns (tall) or
+ * rows (wide), where square tiles would be mostly empty.  The transpose is
+ * then a deinterleave of k channels (tall) or an interleave into k channels
+ * (wide): k consecutive vectors of one side become k vectors of the other, a
+ * vector per channel, or the reverse.  Each output vector is merged from
+ * permutex2var shuffles of the pairs of input vectors, with the index vectors
+ * and lane masks worked out once per call.
+ *
+ * For lanes of bits bits, V to a vector, elements w lanes wide and E = V / w
+ * elements to a vector, define:
+ * - struct avx_intr_skinny_tbl_<bits>, the shuffles of each output vector;
+ * - avx_intr_skinny_tbl_init_<bits>(), which fills them in;
+ * - avx_intr_skinny_<bits>(), which moves all whole vectors of rows (tall)
+ *   or columns (wide) of A, streaming when nt is set.
+ */
+#define AVX_INTR_SKINNY_MAX 16
+
+#define TRANSPOSE_SKINNY_AVX_INTR_DEFINE(bits, V, mask_t, idx_t) \
+struct avx_intr_skinny_tbl_##bits { \
+    size_t k; \
+    int tall; \
+    idx_t idx[AVX_INTR_SKINNY_MAX][AVX_INTR_SKINNY_MAX / 2][V]; \
+    mask_t mask[AVX_INTR_SKINNY_MAX][AVX_INTR_SKINNY_MAX / 2]; \
+}; \
+\
+/* lane l of output vector o is lane lane of input vector s */ \
+static inline void \
+avx_intr_skinny_tbl_set_##bits(struct avx_intr_skinny_tbl_##bits *tbl, \
+                               size_t o, size_t l, size_t s, size_t lane) \
+{ \
+    tbl->idx[o][s / 2][l] = (idx_t)(lane + (s % 2) * (V)); \
+    tbl->mask[o][s / 2] |= (mask_t)(1u << l); \
+} \
+\
+static inline void \
+avx_intr_skinny_tbl_init_##bits(struct avx_intr_skinny_tbl_##bits *tbl, \
+                                size_t k, size_t w, int tall) \
+{ \
+    size_t o, l, f, e; \
+    memset(tbl, 0, sizeof(*tbl)); \
+    tbl->k = k; \
+    tbl->tall = tall; \
+    for (o = 0; o < k; o++) { \
+        for (l = 0; l < (V); l++) { \
+            if (tall) { \
+                /* channel o, element l / w: lane l % w of row l / w of A */ \
+                f = ((l / w) * k + o) * w + l % w; \
+                avx_intr_skinny_tbl_set_##bits(tbl, o, l, f / (V), f % (V)); \
+            } else { \
+                /* element e of the interleaved output is row e % k of A */ \
+                f = o * (V) + l; \
+                e = f / w; \
+                avx_intr_skinny_tbl_set_##bits(tbl, o, l, e % k, \
+                                               (e / k) * w + f % w); \
+            } \
+        } \
+    } \
+} \
+\
+/* \
+ * Move the n / E whole vectors of rows (tall) or columns (wide) of A, n rows \
+ * of B (tall) or columns of A (wide) being n_bytes apart.  Inlined with a \
+ * constant k, the loops unroll and the shuffles stay in registers. \
+ */ \
+CPU_TARGET_AVX512 \
+static inline __attribute__((__always_inline__)) void \
+avx_intr_skinny_##bits(const struct avx_intr_skinny_tbl_##bits *tbl, \
+                       const char* restrict A, char* restrict B, \
+                       size_t n, size_t E, size_t size, int nt, \
+                       const size_t k) \
+{ \
+    __m512i idx[AVX_INTR_SKINNY_MAX][AVX_INTR_SKINNY_MAX / 2]; \
+    __m512i x[AVX_INTR_SKINNY_MAX], y[AVX_INTR_SKINNY_MAX]; \
+    const size_t n_bytes = n * size; \
+    const int tall = tbl->tall; \
+    size_t i, o, p, s; \
+    for (o = 0; o < k; o++) { \
+        for (p = 0; p < (k + 1) / 2; p++) { \
+            idx[o][p] = _mm512_loadu_si512(tbl->idx[o][p]); \
+        } \
+    } \
+    for (i = 0; i + E <= n; i += E) { \
+        const char *a = tall ? &A[i * k * size] : &A[i * size]; \
+        char *b = tall ? &B[i * size] : &B[i * k * size]; \
+        for (s = 0; s < k; s++) { \
+            x[s] = _mm512_loadu_si512(tall ? &a[s * 64] : &a[s * n_bytes]); \
+        } \
+        for (o = 0; o < k; o++) { \
+            /* the other pairs overwrite the lanes pair 0 got wrong; an odd */ \
+            /* k leaves the last vector unpaired */ \
+            y[o] = _mm512_permutex2var_epi##bits(x[0], idx[o][0], x[1]); \
+            for (p = 1; p < (k + 1) / 2; p++) { \
+                y[o] = _mm512_mask_mov_epi##bits( \
+                           y[o], tbl->mask[o][p], \
+                           _mm512_permutex2var_epi##bits( \
+                               x[2 * p], idx[o][p], \
+                               x[2 * p + 1 < k ? 2 * p + 1 : 2 * p])); \
+            } \
+        } \
+        for (o = 0; o < k; o++) { \
+            void *d = tall ? &b[o * n_bytes] : &b[o * 64]; \
+            if (nt) { \
+                _mm512_stream_si512(d, y[o]); \
+            } else { \
+                _mm512_storeu_si512(d, y[o]); \
+            } \
+        } \
+    } \
+}
+
+TRANSPOSE_SKINNY_AVX_INTR_DEFINE(32, 16, __mmask16, uint32_t)
+TRANSPOSE_SKINNY_AVX_INTR_DEFINE(64, 8, __mmask8, uint64_t)
+
+#endif /* TRANSPOSE_AVX_KERNELS_H */
@@ -5,121 +5,1168 @@
  * @author Connor Imes <cimes@isi.edu>
  * @date 2019-08-07
  */
-#include <assert.h>
-#include <inttypes.h>
+#include <complex.h>
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 // intrinsics
 #include <immintrin.h>
 
+#include "cpu-features.h"
 #include "transpose-avx.h"
+#include "transpose-avx-kernels.h"
+#include "transpose-nt.h"
+#include "transpose-order.h"
+#include "transpose-perm.h"
+#include "util.h"
+
+#if defined(HAVE_TRANSPOSE_FIXED_SHAPES)
+#include "transpose-fixed-shapes.h"
+#else
+#define TRANSPOSE_FIXED_SHAPES(X)
+#endif
+
+/*
+ * Size-specialized transposes for the shapes in TRANSPOSE_FIXED_SHAPES.  With
+ * constant trip counts and strides, and A and B known to be 64-byte aligned,
+ * the compiler drops the ragged-edge tests and the per-tile alignment check of
+ * the streaming stores, and folds the tile offsets into addressing.  name is
+ * the generic kernel, whose *_blk kernels are used for the tiles.
+ */
+#define TRANSPOSE_AVX_INTR_FIXED_FN(name, datatype, rows, cols, blk) \
+CPU_TARGET_AVX512 \
+static void name##_fixed_##rows##x##cols(const datatype* restrict A, \
+                                         datatype* restrict B) \
+{ \
+    const datatype* restrict a = __builtin_assume_aligned(A, 64); \
+    datatype* restrict b = __builtin_assume_aligned(B, 64); \
+    const int nt = transpose_nt_use((size_t)(rows) * (cols) * sizeof(*B)); \
+    size_t i, j; \
+    if ((rows) % (blk) || (cols) % (blk)) { \
+        TRANSPOSE_AVX_INTR_TILES_NT(a, (size_t)(cols), b, (size_t)(rows), \
+                                    0, (size_t)(rows), 0, (size_t)(cols), \
+                                    blk, NULL, nt, name##_blk, name##_blk_nt, \
+                                    name##_blk_part); \
+    } else if (nt) { \
+        for (i = 0; i < (rows); i += (blk)) { \
+            for (j = 0; j < (cols); j += (blk)) { \
+                name##_blk_nt(&a[i * (cols) + j], &b[j * (rows) + i], \
+                              (cols), (rows), NULL); \
+            } \
+        } \
+        _mm_sfence(); \
+    } else { \
+        for (i = 0; i < (rows); i += (blk)) { \
+            for (j = 0; j < (cols); j += (blk)) { \
+                name##_blk(&a[i * (cols) + j], &b[j * (rows) + i], \
+                           (cols), (rows), NULL); \
+            } \
+        } \
+    } \
+}
+
+#define TRANSPOSE_AVX_INTR_FIXED_CASE(name, rows, cols) \
+    if (A_rows == (rows) && A_cols == (cols)) { \
+        name##_fixed_##rows##x##cols(A, B); \
+        return 1; \
+    }
+
+/*
+ * Run the specialized transpose matching the shape, if any, and return 1; or
+ * return 0 to leave the call to the generic kernel.
+ */
+#define TRANSPOSE_AVX_INTR_FIXED_SELECT(name, datatype, fixed_case) \
+CPU_TARGET_AVX512 \
+static int name##_fixed(const datatype* restrict A, datatype* restrict B, \
+                        size_t A_rows, size_t A_cols) \
+{ \
+    if ((uintptr_t)A % 64 || (uintptr_t)B % 64) { \
+        return 0; \
+    } \
+    TRANSPOSE_FIXED_SHAPES(fixed_case) \
+    return 0; \
+}
+
+#define TRANSPOSE_DBL_FIXED_FN(rows, cols) \
+    TRANSPOSE_AVX_INTR_FIXED_FN(transpose_dbl_avx_intr_8x8, double, rows, \
+                                cols, 8)
+#define TRANSPOSE_DBL_FIXED_CASE(rows, cols) \
+    TRANSPOSE_AVX_INTR_FIXED_CASE(transpose_dbl_avx_intr_8x8, rows, cols)
+TRANSPOSE_FIXED_SHAPES(TRANSPOSE_DBL_FIXED_FN)
+TRANSPOSE_AVX_INTR_FIXED_SELECT(transpose_dbl_avx_intr_8x8, double,
+                                TRANSPOSE_DBL_FIXED_CASE)
+
+#define TRANSPOSE_FLT_FIXED_FN(rows, cols) \
+    TRANSPOSE_AVX_INTR_FIXED_FN(transpose_flt_avx_intr_16x16, float, rows, \
+                                cols, 16)
+#define TRANSPOSE_FLT_FIXED_CASE(rows, cols) \
+    TRANSPOSE_AVX_INTR_FIXED_CASE(transpose_flt_avx_intr_16x16, rows, cols)
+TRANSPOSE_FIXED_SHAPES(TRANSPOSE_FLT_FIXED_FN)
+TRANSPOSE_AVX_INTR_FIXED_SELECT(transpose_flt_avx_intr_16x16, float,
+                                TRANSPOSE_FLT_FIXED_CASE)
+
+#define TRANSPOSE_DBL_CMPLX_FIXED_FN(rows, cols) \
+    TRANSPOSE_AVX_INTR_FIXED_FN(transpose_dbl_cmplx_avx_intr_4x4, \
+                                double complex, rows, cols, 4)
+#define TRANSPOSE_DBL_CMPLX_FIXED_CASE(rows, cols) \
+    TRANSPOSE_AVX_INTR_FIXED_CASE(transpose_dbl_cmplx_avx_intr_4x4, rows, cols)
+TRANSPOSE_FIXED_SHAPES(TRANSPOSE_DBL_CMPLX_FIXED_FN)
+TRANSPOSE_AVX_INTR_FIXED_SELECT(transpose_dbl_cmplx_avx_intr_4x4,
+                                double complex, TRANSPOSE_DBL_CMPLX_FIXED_CASE)
 
 /*
  * This function uses intrinsics to transpose an 8x8 block of doubles
- * using a recursive transpose algorithm.  It will not work correctly
- * unless both A_rows and A_cols are multiples of 8.
+ * using a recursive transpose algorithm.  Ragged tiles at the bottom and right
+ * edges use masked loads and stores, so any matrix shape is supported.  Shapes
+ * listed in TRANSPOSE_FIXED_SHAPES go to their size-specialized version when A
+ * and B are 64-byte aligned, as do those of the float and double complex
+ * kernels below.
  */
+CPU_TARGET_AVX512
 void transpose_dbl_avx_intr_8x8(const double* restrict A, double* restrict B,
                                 size_t A_rows, size_t A_cols)
 {
-    // used for swapping 2x2 blocks using _mm512_permutex2var_pd()
-    static const __m512i idx_2x2_0 = {
-        0x0000, 0x0001, 0x0008, 0x0009, 0x0004, 0x0005, 0x000c, 0x000d
-    };
-    static const __m512i idx_2x2_1 = {
-        0x000a, 0x000b, 0x0002, 0x0003, 0x000e, 0x000f, 0x0006, 0x0007
-    };
-    // used for swapping 4x4 blocks using _mm512_permutex2var_pd()
-    static const __m512i idx_4x4_0 = {
-        0x0000, 0x0001, 0x0002, 0x0003, 0x0008, 0x0009, 0x000a, 0x000b
-    };
-    static const __m512i idx_4x4_1 = {
-        0x000c, 0x000d, 0x000e, 0x000f, 0x0004, 0x0005, 0x0006, 0x0007
-    };
-    const double *A_block;
-    double *B_block;
-    size_t i_min, j_min;
-    size_t num_row_blocks, num_col_blocks;
-    size_t rblk_num, cblk_num;
-    // alternate the reads and writes between the r and s vector registers, all
-    // of which hold matrix rows
-    __m512d r[8], s[8];
-
-    assert(A_rows % 8 == 0);
-    assert(A_cols % 8 == 0);
-
-    num_row_blocks = A_rows / 8;
-    num_col_blocks = A_cols / 8;
-
-    // perform transpose over all blocks
-    for (rblk_num = 0; rblk_num < num_row_blocks; rblk_num++) {
-        i_min = rblk_num * 8;
-        for (cblk_num = 0; cblk_num < num_col_blocks; cblk_num++) {
-            j_min = cblk_num * 8;
-
-            A_block = &A[i_min * A_cols + j_min];
-            B_block = &B[j_min * A_rows + i_min];
-
-            // read 8x8 block of read array
-            r[0] = _mm512_load_pd(&A_block[0]);
-            r[1] = _mm512_load_pd(&A_block[A_cols]);
-            r[2] = _mm512_load_pd(&A_block[2*A_cols]);
-            r[3] = _mm512_load_pd(&A_block[3*A_cols]);
-            r[4] = _mm512_load_pd(&A_block[4*A_cols]);
-            r[5] = _mm512_load_pd(&A_block[5*A_cols]);
-            r[6] = _mm512_load_pd(&A_block[6*A_cols]);
-            r[7] = _mm512_load_pd(&A_block[7*A_cols]);
-
-            // shuffle doubles within 128-bit lanes
-            s[0] = _mm512_unpacklo_pd(r[0], r[1]);
-            s[1] = _mm512_unpackhi_pd(r[0], r[1]);
-            s[2] = _mm512_unpacklo_pd(r[2], r[3]);
-            s[3] = _mm512_unpackhi_pd(r[2], r[3]);
-            s[4] = _mm512_unpacklo_pd(r[4], r[5]);
-            s[5] = _mm512_unpackhi_pd(r[4], r[5]);
-            s[6] = _mm512_unpacklo_pd(r[6], r[7]);
-            s[7] = _mm512_unpackhi_pd(r[6], r[7]);
-
-            // shuffle 2x2 blocks of doubles
-            r[0] = _mm512_permutex2var_pd(s[0], idx_2x2_0, s[2]);
-            r[1] = _mm512_permutex2var_pd(s[1], idx_2x2_0, s[3]);
-            r[2] = _mm512_permutex2var_pd(s[2], idx_2x2_1, s[0]);
-            r[3] = _mm512_permutex2var_pd(s[3], idx_2x2_1, s[1]);
-            r[4] = _mm512_permutex2var_pd(s[4], idx_2x2_0, s[6]);
-            r[5] = _mm512_permutex2var_pd(s[5], idx_2x2_0, s[7]);
-            r[6] = _mm512_permutex2var_pd(s[6], idx_2x2_1, s[4]);
-            r[7] = _mm512_permutex2var_pd(s[7], idx_2x2_1, s[5]);
-
-            // shuffle 4x4 blocks of doubles
-            s[0] = _mm512_permutex2var_pd(r[0], idx_4x4_0, r[4]);
-            s[1] = _mm512_permutex2var_pd(r[1], idx_4x4_0, r[5]);
-            s[2] = _mm512_permutex2var_pd(r[2], idx_4x4_0, r[6]);
-            s[3] = _mm512_permutex2var_pd(r[3], idx_4x4_0, r[7]);
-            s[4] = _mm512_permutex2var_pd(r[4], idx_4x4_1, r[0]);
-            s[5] = _mm512_permutex2var_pd(r[5], idx_4x4_1, r[1]);
-            s[6] = _mm512_permutex2var_pd(r[6], idx_4x4_1, r[2]);
-            s[7] = _mm512_permutex2var_pd(r[7], idx_4x4_1, r[3]);
-
-            // write back 8x8 block of write array
-#if defined(USE_AVX_STREAMING_STORES)
-            _mm512_stream_pd(&B_block[0], s[0]);
-            _mm512_stream_pd(&B_block[A_rows], s[1]);
-            _mm512_stream_pd(&B_block[2*A_rows], s[2]);
-            _mm512_stream_pd(&B_block[3*A_rows], s[3]);
-            _mm512_stream_pd(&B_block[4*A_rows], s[4]);
-            _mm512_stream_pd(&B_block[5*A_rows], s[5]);
-            _mm512_stream_pd(&B_block[6*A_rows], s[6]);
-            _mm512_stream_pd(&B_block[7*A_rows], s[7]);
-#else
-            _mm512_store_pd(&B_block[0], s[0]);
-            _mm512_store_pd(&B_block[A_rows], s[1]);
-            _mm512_store_pd(&B_block[2*A_rows], s[2]);
-            _mm512_store_pd(&B_block[3*A_rows], s[3]);
-            _mm512_store_pd(&B_block[4*A_rows], s[4]);
-            _mm512_store_pd(&B_block[5*A_rows], s[5]);
-            _mm512_store_pd(&B_block[6*A_rows], s[6]);
-            _mm512_store_pd(&B_block[7*A_rows], s[7]);
+    int nt;
+
+    if (transpose_dbl_avx_intr_8x8_fixed(A, B, A_rows, A_cols)) {
+        return;
+    }
+    nt = transpose_nt_use(A_cols * A_rows * sizeof(*B));
+
+    TRANSPOSE_AVX_INTR_TILES_NT(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                                8, NULL, nt, transpose_dbl_avx_intr_8x8_blk,
+                                transpose_dbl_avx_intr_8x8_blk_nt,
+                                transpose_dbl_avx_intr_8x8_blk_part);
+}
+
+/*
+ * This function uses intrinsics to transpose a 16x16 block of floats.  Ragged
+ * tiles at the bottom and right edges use masked loads and stores.
+ */
+CPU_TARGET_AVX512
+void transpose_flt_avx_intr_16x16(const float* restrict A, float* restrict B,
+                                  size_t A_rows, size_t A_cols)
+{
+    int nt;
+
+    if (transpose_flt_avx_intr_16x16_fixed(A, B, A_rows, A_cols)) {
+        return;
+    }
+    nt = transpose_nt_use(A_cols * A_rows * sizeof(*B));
+
+    TRANSPOSE_AVX_INTR_TILES_NT(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                                16, NULL, nt, transpose_flt_avx_intr_16x16_blk,
+                                transpose_flt_avx_intr_16x16_blk_nt,
+                                transpose_flt_avx_intr_16x16_blk_part);
+}
+
+/*
+ * A float complex is 8 bytes wide, the same as a double, so the double 8x8
+ * kernel moves complex float elements without any change.
+ */
+CPU_TARGET_AVX512
+void transpose_flt_cmplx_avx_intr_8x8(const float complex* restrict A,
+                                      float complex* restrict B,
+                                      size_t A_rows, size_t A_cols)
+{
+    transpose_dbl_avx_intr_8x8((const double*)A, (double*)B, A_rows, A_cols);
+}
+
+/*
+ * This function uses intrinsics to transpose a 4x4 block of double complex
+ * values, one row per zmm register.  Ragged tiles at the bottom and right
+ * edges use masked loads and stores.
+ */
+CPU_TARGET_AVX512
+void transpose_dbl_cmplx_avx_intr_4x4(const double complex* restrict A,
+                                      double complex* restrict B,
+                                      size_t A_rows, size_t A_cols)
+{
+    int nt;
+
+    if (transpose_dbl_cmplx_avx_intr_4x4_fixed(A, B, A_rows, A_cols)) {
+        return;
+    }
+    nt = transpose_nt_use(A_cols * A_rows * sizeof(*B));
+
+    TRANSPOSE_AVX_INTR_TILES_NT(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                                4, NULL, nt, transpose_dbl_cmplx_avx_intr_4x4_blk,
+                                transpose_dbl_cmplx_avx_intr_4x4_blk_nt,
+                                transpose_dbl_cmplx_avx_intr_4x4_blk_part);
+}
+
+/*
+ * Integer variants: a 16-row strip is transposed a whole 512-bit vector wide,
+ * i.e., 64 bytes or 32 words per kernel call.
+ */
+CPU_TARGET_AVX512
+void transpose_u8_avx_intr_16x16(const uint8_t* restrict A, uint8_t* restrict B,
+                                 size_t A_rows, size_t A_cols)
+{
+    const int nt = transpose_nt_use(A_cols * A_rows * sizeof(*B));
+
+    TRANSPOSE_AVX_INTR_TILES_RECT_NT(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                                     16, 64, nt,
+                                     transpose_u8_avx_intr_16x16_blk,
+                                     transpose_u8_avx_intr_16x16_blk_nt,
+                                     transpose_u8_avx_intr_16x16_blk_part);
+}
+
+CPU_TARGET_AVX512
+void transpose_i16_avx_intr_16x16(const int16_t* restrict A,
+                                  int16_t* restrict B,
+                                  size_t A_rows, size_t A_cols)
+{
+    const int nt = transpose_nt_use(A_cols * A_rows * sizeof(*B));
+
+    TRANSPOSE_AVX_INTR_TILES_RECT_NT(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                                     16, 32, nt,
+                                     transpose_i16_avx_intr_16x16_blk,
+                                     transpose_i16_avx_intr_16x16_blk_nt,
+                                     transpose_i16_avx_intr_16x16_blk_part);
+}
+
+CPU_TARGET_AVX512
+void transpose_iq16_flt_cmplx_avx_intr_8x8(const transpose_iq16_t* restrict A,
+                                           float complex* restrict B,
+                                           size_t A_rows, size_t A_cols,
+                                           float scale)
+{
+    const int nt = transpose_nt_use(A_cols * A_rows * sizeof(*B));
+
+    TRANSPOSE_AVX_INTR_TILES_NT(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                                8, scale, nt,
+                                transpose_iq16_flt_cmplx_avx_intr_8x8_blk,
+                                transpose_iq16_flt_cmplx_avx_intr_8x8_blk_nt,
+                                transpose_iq16_flt_cmplx_avx_intr_8x8_blk_part);
+}
+
+CPU_TARGET_AVX512
+void transpose_iq12_flt_cmplx_avx_intr_8x8(const transpose_iq12_t* restrict A,
+                                           float complex* restrict B,
+                                           size_t A_rows, size_t A_cols,
+                                           float scale)
+{
+    const int nt = transpose_nt_use(A_cols * A_rows * sizeof(*B));
+
+    TRANSPOSE_AVX_INTR_TILES_NT(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                                8, scale, nt,
+                                transpose_iq12_flt_cmplx_avx_intr_8x8_blk,
+                                transpose_iq12_flt_cmplx_avx_intr_8x8_blk_nt,
+                                transpose_iq12_flt_cmplx_avx_intr_8x8_blk_part);
+}
+
+CPU_TARGET_AVX512
+void transpose_dbl_flt_avx_intr_16x16(const double* restrict A,
+                                      float* restrict B,
+                                      size_t A_rows, size_t A_cols)
+{
+    const int nt = transpose_nt_use(A_cols * A_rows * sizeof(*B));
+
+    TRANSPOSE_AVX_INTR_TILES_RECT_NT(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                                     16, 16, nt,
+                                     transpose_dbl_flt_avx_intr_16x16_blk,
+                                     transpose_dbl_flt_avx_intr_16x16_blk_nt,
+                                     transpose_dbl_flt_avx_intr_16x16_blk_part);
+}
+
+CPU_TARGET_AVX512
+void transpose_dbl_cmplx_flt_cmplx_avx_intr_8x8(const double complex* restrict A,
+                                                float complex* restrict B,
+                                                size_t A_rows, size_t A_cols)
+{
+    const int nt = transpose_nt_use(A_cols * A_rows * sizeof(*B));
+
+    TRANSPOSE_AVX_INTR_TILES_RECT_NT(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                                     8, 8, nt,
+                                     transpose_dbl_cmplx_flt_cmplx_avx_intr_8x8_blk,
+                                     transpose_dbl_cmplx_flt_cmplx_avx_intr_8x8_blk_nt,
+                                     transpose_dbl_cmplx_flt_cmplx_avx_intr_8x8_blk_part);
+}
+
+CPU_TARGET_AVX512
+void transpose_flt_fp16_avx_intr_16x16(const float* restrict A,
+                                       transpose_fp16_t* restrict B,
+                                       size_t A_rows, size_t A_cols)
+{
+    const int nt = transpose_nt_use(A_cols * A_rows * sizeof(*B));
+
+    TRANSPOSE_AVX_INTR_TILES_RECT_NT(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                                     16, 16, nt,
+                                     transpose_flt_fp16_avx_intr_16x16_blk,
+                                     transpose_flt_fp16_avx_intr_16x16_blk_nt,
+                                     transpose_flt_fp16_avx_intr_16x16_blk_part);
+}
+
+/*
+ * The bf16 variants round with vcvtneps2bf16 when the CPU has AVX512_BF16 and
+ * with integer arithmetic otherwise.  The tile loops for the former are built
+ * for AVX512_BF16 so its kernels can be inlined.
+ */
+#if defined(CPU_TARGET_AVX512_BF16)
+CPU_TARGET_AVX512_BF16
+static void transpose_flt_bf16_avx_intr_16x16_native(const float* restrict A,
+                                                     transpose_bf16_t* restrict B,
+                                                     size_t A_rows, size_t A_cols,
+                                                     int nt)
+{
+    TRANSPOSE_AVX_INTR_TILES_RECT_NT(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                                     16, 16, nt,
+                                     transpose_flt_bf16_avx_intr_16x16_native_blk,
+                                     transpose_flt_bf16_avx_intr_16x16_native_blk_nt,
+                                     transpose_flt_bf16_avx_intr_16x16_native_blk_part);
+}
+#endif
+
+CPU_TARGET_AVX512
+void transpose_flt_bf16_avx_intr_16x16(const float* restrict A,
+                                       transpose_bf16_t* restrict B,
+                                       size_t A_rows, size_t A_cols)
+{
+    const int nt = transpose_nt_use(A_cols * A_rows * sizeof(*B));
+
+#if defined(CPU_TARGET_AVX512_BF16)
+    if (avx_intr_have_bf16()) {
+        transpose_flt_bf16_avx_intr_16x16_native(A, B, A_rows, A_cols, nt);
+        return;
+    }
+#endif
+    TRANSPOSE_AVX_INTR_TILES_RECT_NT(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                                     16, 16, nt,
+                                     transpose_flt_bf16_avx_intr_16x16_blk,
+                                     transpose_flt_bf16_avx_intr_16x16_blk_nt,
+                                     transpose_flt_bf16_avx_intr_16x16_blk_part);
+}
+
+CPU_TARGET_AVX512
+void transpose_flt_cmplx_fp16_cmplx_avx_intr_8x8(const float complex* restrict A,
+                                                 transpose_fp16_cmplx_t* restrict B,
+                                                 size_t A_rows, size_t A_cols)
+{
+    const int nt = transpose_nt_use(A_cols * A_rows * sizeof(*B));
+
+    TRANSPOSE_AVX_INTR_TILES_RECT_NT(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                                     8, 8, nt,
+                                     transpose_flt_cmplx_fp16_cmplx_avx_intr_8x8_blk,
+                                     transpose_flt_cmplx_fp16_cmplx_avx_intr_8x8_blk_nt,
+                                     transpose_flt_cmplx_fp16_cmplx_avx_intr_8x8_blk_part);
+}
+
+#if defined(CPU_TARGET_AVX512_BF16)
+CPU_TARGET_AVX512_BF16
+static void transpose_flt_cmplx_bf16_cmplx_avx_intr_8x8_native(const float complex* restrict A,
+                                                               transpose_bf16_cmplx_t* restrict B,
+                                                               size_t A_rows, size_t A_cols,
+                                                               int nt)
+{
+    TRANSPOSE_AVX_INTR_TILES_RECT_NT(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                                     8, 8, nt,
+                                     transpose_flt_cmplx_bf16_cmplx_avx_intr_8x8_native_blk,
+                                     transpose_flt_cmplx_bf16_cmplx_avx_intr_8x8_native_blk_nt,
+                                     transpose_flt_cmplx_bf16_cmplx_avx_intr_8x8_native_blk_part);
+}
+#endif
+
+CPU_TARGET_AVX512
+void transpose_flt_cmplx_bf16_cmplx_avx_intr_8x8(const float complex* restrict A,
+                                                 transpose_bf16_cmplx_t* restrict B,
+                                                 size_t A_rows, size_t A_cols)
+{
+    const int nt = transpose_nt_use(A_cols * A_rows * sizeof(*B));
+
+#if defined(CPU_TARGET_AVX512_BF16)
+    if (avx_intr_have_bf16()) {
+        transpose_flt_cmplx_bf16_cmplx_avx_intr_8x8_native(A, B, A_rows, A_cols, nt);
+        return;
+    }
 #endif
-        }
+    TRANSPOSE_AVX_INTR_TILES_RECT_NT(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                                     8, 8, nt,
+                                     transpose_flt_cmplx_bf16_cmplx_avx_intr_8x8_blk,
+                                     transpose_flt_cmplx_bf16_cmplx_avx_intr_8x8_blk_nt,
+                                     transpose_flt_cmplx_bf16_cmplx_avx_intr_8x8_blk_part);
+}
+
+CPU_TARGET_AVX512
+void transpose_flt_cmplx_split_avx_intr_16x16(const float complex* restrict A,
+                                              float* restrict B_re,
+                                              float* restrict B_im,
+                                              size_t A_rows, size_t A_cols)
+{
+    const int nt = transpose_nt_use(2 * A_cols * A_rows * sizeof(*B_re));
+
+    TRANSPOSE_AVX_INTR_TO_SPLIT_TILES_NT(A, A_cols, B_re, B_im, A_rows,
+                                         0, A_rows, 0, A_cols, 16, nt,
+                                         transpose_flt_cmplx_split_avx_intr_16x16_blk,
+                                         transpose_flt_cmplx_split_avx_intr_16x16_blk_nt,
+                                         transpose_flt_cmplx_split_avx_intr_16x16_blk_part);
+}
+
+CPU_TARGET_AVX512
+void transpose_dbl_cmplx_split_avx_intr_8x8(const double complex* restrict A,
+                                            double* restrict B_re,
+                                            double* restrict B_im,
+                                            size_t A_rows, size_t A_cols)
+{
+    const int nt = transpose_nt_use(2 * A_cols * A_rows * sizeof(*B_re));
+
+    TRANSPOSE_AVX_INTR_TO_SPLIT_TILES_NT(A, A_cols, B_re, B_im, A_rows,
+                                         0, A_rows, 0, A_cols, 8, nt,
+                                         transpose_dbl_cmplx_split_avx_intr_8x8_blk,
+                                         transpose_dbl_cmplx_split_avx_intr_8x8_blk_nt,
+                                         transpose_dbl_cmplx_split_avx_intr_8x8_blk_part);
+}
+
+CPU_TARGET_AVX512
+void transpose_flt_split_cmplx_avx_intr_16x16(const float* restrict A_re,
+                                              const float* restrict A_im,
+                                              float complex* restrict B,
+                                              size_t A_rows, size_t A_cols)
+{
+    const int nt = transpose_nt_use(A_cols * A_rows * sizeof(*B));
+
+    TRANSPOSE_AVX_INTR_FROM_SPLIT_TILES_NT(A_re, A_im, A_cols, B, A_rows,
+                                           0, A_rows, 0, A_cols, 16, nt,
+                                           transpose_flt_split_cmplx_avx_intr_16x16_blk,
+                                           transpose_flt_split_cmplx_avx_intr_16x16_blk_nt,
+                                           transpose_flt_split_cmplx_avx_intr_16x16_blk_part);
+}
+
+CPU_TARGET_AVX512
+void transpose_dbl_split_cmplx_avx_intr_8x8(const double* restrict A_re,
+                                            const double* restrict A_im,
+                                            double complex* restrict B,
+                                            size_t A_rows, size_t A_cols)
+{
+    const int nt = transpose_nt_use(A_cols * A_rows * sizeof(*B));
+
+    TRANSPOSE_AVX_INTR_FROM_SPLIT_TILES_NT(A_re, A_im, A_cols, B, A_rows,
+                                           0, A_rows, 0, A_cols, 8, nt,
+                                           transpose_dbl_split_cmplx_avx_intr_8x8_blk,
+                                           transpose_dbl_split_cmplx_avx_intr_8x8_blk_nt,
+                                           transpose_dbl_split_cmplx_avx_intr_8x8_blk_part);
+}
+
+CPU_TARGET_AVX512
+void transpose_flt_cmplx_avx_intr_8x8_epi(const float complex* restrict A,
+                                          float complex* restrict B,
+                                          size_t A_rows, size_t A_cols,
+                                          const struct transpose_epi_flt_cmplx *epi)
+{
+    const int nt = transpose_nt_use(A_cols * A_rows * sizeof(*B));
+
+    TRANSPOSE_AVX_INTR_EPI_TILES_NT(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                                    8, epi, nt,
+                                    transpose_flt_cmplx_avx_intr_8x8_epi_blk,
+                                    transpose_flt_cmplx_avx_intr_8x8_epi_blk_nt,
+                                    transpose_flt_cmplx_avx_intr_8x8_epi_blk_part);
+}
+
+CPU_TARGET_AVX512
+void transpose_dbl_cmplx_avx_intr_4x4_epi(const double complex* restrict A,
+                                          double complex* restrict B,
+                                          size_t A_rows, size_t A_cols,
+                                          const struct transpose_epi_dbl_cmplx *epi)
+{
+    const int nt = transpose_nt_use(A_cols * A_rows * sizeof(*B));
+
+    TRANSPOSE_AVX_INTR_EPI_TILES_NT(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                                    4, epi, nt,
+                                    transpose_dbl_cmplx_avx_intr_4x4_epi_blk,
+                                    transpose_dbl_cmplx_avx_intr_4x4_epi_blk_nt,
+                                    transpose_dbl_cmplx_avx_intr_4x4_epi_blk_part);
+}
+
+/*
+ * Permuting variants: the columns of B are permuted by gathering the rows of
+ * each tile of A through the inverse of perm->cols, and the rows of B by
+ * scattering the rows of the transposed tile through perm->rows, so every
+ * load and store still moves a whole tile row.  The *_perm_tables ones take
+ * those gather tables ready made; the *_perm ones build them on each call.
+ */
+#define TRANSPOSE_AVX_INTR_PERM_TABLES(A, B, A_rows, A_cols, src, dst, blk, \
+                                       fn_blk, fn_blk_nt, fn_blk_part) { \
+    const int _nt = transpose_nt_use((A_cols) * (A_rows) * sizeof(*(B))); \
+    TRANSPOSE_AVX_INTR_PERM_TILES_NT(A, A_cols, B, A_rows, A_rows, A_cols, \
+                                     src, dst, blk, _nt, fn_blk, fn_blk_nt, \
+                                     fn_blk_part); \
+}
+
+#define TRANSPOSE_AVX_INTR_PERM(A, B, A_rows, A_cols, perm, fn_tables) { \
+    size_t *_src = assert_malloc(((A_rows) + (A_cols)) * sizeof(size_t)); \
+    size_t *_dst = _src + (A_rows); \
+    transpose_perm_tables(perm, A_rows, A_cols, _src, _dst); \
+    fn_tables(A, B, A_rows, A_cols, _src, _dst); \
+    free(_src); \
+}
+
+CPU_TARGET_AVX512
+void transpose_dbl_avx_intr_8x8_perm_tables(const double* restrict A,
+                                            double* restrict B,
+                                            size_t A_rows, size_t A_cols,
+                                            const size_t *src,
+                                            const size_t *dst)
+{
+    TRANSPOSE_AVX_INTR_PERM_TABLES(A, B, A_rows, A_cols, src, dst, 8,
+                                   transpose_dbl_avx_intr_8x8_perm_blk,
+                                   transpose_dbl_avx_intr_8x8_perm_blk_nt,
+                                   transpose_dbl_avx_intr_8x8_perm_blk_part);
+}
+
+CPU_TARGET_AVX512
+void transpose_flt_avx_intr_16x16_perm_tables(const float* restrict A,
+                                              float* restrict B,
+                                              size_t A_rows, size_t A_cols,
+                                              const size_t *src,
+                                              const size_t *dst)
+{
+    TRANSPOSE_AVX_INTR_PERM_TABLES(A, B, A_rows, A_cols, src, dst, 16,
+                                   transpose_flt_avx_intr_16x16_perm_blk,
+                                   transpose_flt_avx_intr_16x16_perm_blk_nt,
+                                   transpose_flt_avx_intr_16x16_perm_blk_part);
+}
+
+CPU_TARGET_AVX512
+void transpose_flt_cmplx_avx_intr_8x8_perm_tables(const float complex* restrict A,
+                                                  float complex* restrict B,
+                                                  size_t A_rows, size_t A_cols,
+                                                  const size_t *src,
+                                                  const size_t *dst)
+{
+    transpose_dbl_avx_intr_8x8_perm_tables((const double*)A, (double*)B,
+                                           A_rows, A_cols, src, dst);
+}
+
+CPU_TARGET_AVX512
+void transpose_dbl_cmplx_avx_intr_4x4_perm_tables(const double complex* restrict A,
+                                                  double complex* restrict B,
+                                                  size_t A_rows, size_t A_cols,
+                                                  const size_t *src,
+                                                  const size_t *dst)
+{
+    TRANSPOSE_AVX_INTR_PERM_TABLES(A, B, A_rows, A_cols, src, dst, 4,
+                                   transpose_dbl_cmplx_avx_intr_4x4_perm_blk,
+                                   transpose_dbl_cmplx_avx_intr_4x4_perm_blk_nt,
+                                   transpose_dbl_cmplx_avx_intr_4x4_perm_blk_part);
+}
+
+CPU_TARGET_AVX512
+void transpose_dbl_avx_intr_8x8_perm(const double* restrict A,
+                                     double* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     const struct transpose_perm *perm)
+{
+    TRANSPOSE_AVX_INTR_PERM(A, B, A_rows, A_cols, perm,
+                            transpose_dbl_avx_intr_8x8_perm_tables);
+}
+
+CPU_TARGET_AVX512
+void transpose_flt_avx_intr_16x16_perm(const float* restrict A,
+                                       float* restrict B,
+                                       size_t A_rows, size_t A_cols,
+                                       const struct transpose_perm *perm)
+{
+    TRANSPOSE_AVX_INTR_PERM(A, B, A_rows, A_cols, perm,
+                            transpose_flt_avx_intr_16x16_perm_tables);
+}
+
+CPU_TARGET_AVX512
+void transpose_flt_cmplx_avx_intr_8x8_perm(const float complex* restrict A,
+                                           float complex* restrict B,
+                                           size_t A_rows, size_t A_cols,
+                                           const struct transpose_perm *perm)
+{
+    transpose_dbl_avx_intr_8x8_perm((const double*)A, (double*)B,
+                                    A_rows, A_cols, perm);
+}
+
+CPU_TARGET_AVX512
+void transpose_dbl_cmplx_avx_intr_4x4_perm(const double complex* restrict A,
+                                           double complex* restrict B,
+                                           size_t A_rows, size_t A_cols,
+                                           const struct transpose_perm *perm)
+{
+    TRANSPOSE_AVX_INTR_PERM(A, B, A_rows, A_cols, perm,
+                            transpose_dbl_cmplx_avx_intr_4x4_perm_tables);
+}
+
+// instantiate the skinny loop for each k so it unrolls
+#define AVX_INTR_SKINNY_CASE(bits, k, tbl, A, B, n, E, size, nt) \
+    case k: avx_intr_skinny_##bits(tbl, A, B, n, E, size, nt, k); break;
+#define AVX_INTR_SKINNY_CASES(bits, ...) \
+    AVX_INTR_SKINNY_CASE(bits, 2, __VA_ARGS__) \
+    AVX_INTR_SKINNY_CASE(bits, 3, __VA_ARGS__) \
+    AVX_INTR_SKINNY_CASE(bits, 4, __VA_ARGS__) \
+    AVX_INTR_SKINNY_CASE(bits, 5, __VA_ARGS__) \
+    AVX_INTR_SKINNY_CASE(bits, 6, __VA_ARGS__) \
+    AVX_INTR_SKINNY_CASE(bits, 7, __VA_ARGS__) \
+    AVX_INTR_SKINNY_CASE(bits, 8, __VA_ARGS__) \
+    AVX_INTR_SKINNY_CASE(bits, 9, __VA_ARGS__) \
+    AVX_INTR_SKINNY_CASE(bits, 10, __VA_ARGS__) \
+    AVX_INTR_SKINNY_CASE(bits, 11, __VA_ARGS__) \
+    AVX_INTR_SKINNY_CASE(bits, 12, __VA_ARGS__) \
+    AVX_INTR_SKINNY_CASE(bits, 13, __VA_ARGS__) \
+    AVX_INTR_SKINNY_CASE(bits, 14, __VA_ARGS__) \
+    AVX_INTR_SKINNY_CASE(bits, 15, __VA_ARGS__) \
+    AVX_INTR_SKINNY_CASE(bits, 16, __VA_ARGS__)
+
+/*
+ * Skinny transpose of elements of size bytes moved in lanes of bits bits:
+ * whole vectors of rows (tall) or columns (wide) at a time with the
+ * avx_intr_skinny_<bits>() kernel, then the ragged remainder element by
+ * element.  With a single row or column the transpose is a copy.
+ */
+#define TRANSPOSE_AVX_INTR_SKINNY(bits, A, B, A_rows, A_cols, size) { \
+    struct avx_intr_skinny_tbl_##bits _tbl; \
+    const char *_a = (const char *)(A); \
+    char *_b = (char *)(B); \
+    const size_t _w = (size) * 8 / (bits); \
+    const size_t _e = 512 / (bits) / _w; \
+    const int _tall = (A_cols) <= (A_rows); \
+    const size_t _k = _tall ? (A_cols) : (A_rows); \
+    const size_t _n = _tall ? (A_rows) : (A_cols); \
+    int _nt = transpose_nt_use((A_rows) * (A_cols) * (size)); \
+    size_t _i, _r, _c; \
+    if (_k == 1) { \
+        if (_nt) { \
+            avx_intr_stream_copy(_b, _a, _n * (size)); \
+            _mm_sfence(); \
+        } else { \
+            memcpy(_b, _a, _n * (size)); \
+        } \
+    } else { \
+        avx_intr_skinny_tbl_init_##bits(&_tbl, _k, _w, _tall); \
+        /* tall: B rows are n elements apart; wide: B is written in order */ \
+        _nt = _nt && (_tall ? avx_intr_can_stream(_b, _n * (size)) \
+                            : (uintptr_t)_b % 64 == 0); \
+        switch (_k) { \
+        AVX_INTR_SKINNY_CASES(bits, &_tbl, _a, _b, _n, _e, (size), _nt) \
+        } \
+        _i = _n / _e * _e; \
+        if (_nt) { \
+            _mm_sfence(); \
+        } \
+        for (_r = _tall ? _i : 0; _r < (A_rows); _r++) { \
+            for (_c = _tall ? 0 : _i; _c < (A_cols); _c++) { \
+                memcpy(&_b[(_c * (A_rows) + _r) * (size)], \
+                       &_a[(_r * (A_cols) + _c) * (size)], (size)); \
+            } \
+        } \
+    } \
+}
+
+// whether the skinny kernels take A, i.e., it has a row or column to spare
+#define TRANSPOSE_AVX_INTR_SKINNY_FITS(A_rows, A_cols) \
+    ((A_rows) <= AVX_INTR_SKINNY_MAX || (A_cols) <= AVX_INTR_SKINNY_MAX)
+
+/*
+ * Skinny variants for matrices with few rows or columns, e.g., channels x
+ * samples.  Others go to the tile kernel.
+ */
+CPU_TARGET_AVX512
+void transpose_flt_avx_intr_skinny(const float* restrict A, float* restrict B,
+                                   size_t A_rows, size_t A_cols)
+{
+    if (!TRANSPOSE_AVX_INTR_SKINNY_FITS(A_rows, A_cols)) {
+        transpose_flt_avx_intr_16x16(A, B, A_rows, A_cols);
+        return;
+    }
+    TRANSPOSE_AVX_INTR_SKINNY(32, A, B, A_rows, A_cols, sizeof(*A));
+}
+
+CPU_TARGET_AVX512
+void transpose_dbl_avx_intr_skinny(const double* restrict A, double* restrict B,
+                                   size_t A_rows, size_t A_cols)
+{
+    if (!TRANSPOSE_AVX_INTR_SKINNY_FITS(A_rows, A_cols)) {
+        transpose_dbl_avx_intr_8x8(A, B, A_rows, A_cols);
+        return;
+    }
+    TRANSPOSE_AVX_INTR_SKINNY(64, A, B, A_rows, A_cols, sizeof(*A));
+}
+
+CPU_TARGET_AVX512
+void transpose_flt_cmplx_avx_intr_skinny(const float complex* restrict A,
+                                         float complex* restrict B,
+                                         size_t A_rows, size_t A_cols)
+{
+    transpose_dbl_avx_intr_skinny((const double*)A, (double*)B,
+                                  A_rows, A_cols);
+}
+
+CPU_TARGET_AVX512
+void transpose_dbl_cmplx_avx_intr_skinny(const double complex* restrict A,
+                                         double complex* restrict B,
+                                         size_t A_rows, size_t A_cols)
+{
+    if (!TRANSPOSE_AVX_INTR_SKINNY_FITS(A_rows, A_cols)) {
+        transpose_dbl_cmplx_avx_intr_4x4(A, B, A_rows, A_cols);
+        return;
+    }
+    TRANSPOSE_AVX_INTR_SKINNY(64, A, B, A_rows, A_cols, sizeof(*A));
+}
+
+/*
+ * Unrolled double variants: each iteration transposes an 8x16, 16x8 or 16x16
+ * block, i.e., two or four 8x8 tiles whose loads and shuffle stages are
+ * interleaved.  Strips that do not fill a whole block use the 8x8 kernels.
+ */
+CPU_TARGET_AVX512
+void transpose_dbl_avx_intr_8x16(const double* restrict A, double* restrict B,
+                                 size_t A_rows, size_t A_cols)
+{
+    const int nt = transpose_nt_use(A_cols * A_rows * sizeof(*B));
+
+    TRANSPOSE_AVX_INTR_TILES_UNROLL(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                                    1, 2, NULL, nt,
+                                    transpose_dbl_avx_intr_unroll_blk,
+                                    transpose_dbl_avx_intr_8x8_blk,
+                                    transpose_dbl_avx_intr_8x8_blk_nt,
+                                    transpose_dbl_avx_intr_8x8_blk_part);
+}
+
+CPU_TARGET_AVX512
+void transpose_dbl_avx_intr_16x8(const double* restrict A, double* restrict B,
+                                 size_t A_rows, size_t A_cols)
+{
+    const int nt = transpose_nt_use(A_cols * A_rows * sizeof(*B));
+
+    TRANSPOSE_AVX_INTR_TILES_UNROLL(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                                    2, 1, NULL, nt,
+                                    transpose_dbl_avx_intr_unroll_blk,
+                                    transpose_dbl_avx_intr_8x8_blk,
+                                    transpose_dbl_avx_intr_8x8_blk_nt,
+                                    transpose_dbl_avx_intr_8x8_blk_part);
+}
+
+CPU_TARGET_AVX512
+void transpose_dbl_avx_intr_16x16(const double* restrict A, double* restrict B,
+                                  size_t A_rows, size_t A_cols)
+{
+    const int nt = transpose_nt_use(A_cols * A_rows * sizeof(*B));
+
+    TRANSPOSE_AVX_INTR_TILES_UNROLL(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                                    2, 2, NULL, nt,
+                                    transpose_dbl_avx_intr_unroll_blk,
+                                    transpose_dbl_avx_intr_8x8_blk,
+                                    transpose_dbl_avx_intr_8x8_blk_nt,
+                                    transpose_dbl_avx_intr_8x8_blk_part);
+}
+
+/*
+ * Strided variants: A has row stride lda and B has row stride ldb, and each
+ * output element is scaled by alpha.  Tiles are unaligned whenever lda or ldb
+ * is not a multiple of the tile width, which only costs the streaming stores.
+ */
+CPU_TARGET_AVX512
+void transpose_dbl_avx_intr_8x8_ld(const double* restrict A, size_t lda,
+                                   double* restrict B, size_t ldb,
+                                   size_t A_rows, size_t A_cols, double alpha)
+{
+    const int nt = transpose_nt_use(A_cols * ldb * sizeof(*B));
+
+    if (alpha == 1) {
+        TRANSPOSE_AVX_INTR_TILES_NT(A, lda, B, ldb, 0, A_rows, 0, A_cols,
+                                    8, NULL, nt, transpose_dbl_avx_intr_8x8_blk,
+                                    transpose_dbl_avx_intr_8x8_blk_nt,
+                                    transpose_dbl_avx_intr_8x8_blk_part);
+    } else {
+        TRANSPOSE_AVX_INTR_TILES_NT(A, lda, B, ldb, 0, A_rows, 0, A_cols,
+                                    8, &alpha, nt, transpose_dbl_avx_intr_8x8_blk,
+                                    transpose_dbl_avx_intr_8x8_blk_nt,
+                                    transpose_dbl_avx_intr_8x8_blk_part);
+    }
+}
+
+CPU_TARGET_AVX512
+void transpose_flt_avx_intr_16x16_ld(const float* restrict A, size_t lda,
+                                     float* restrict B, size_t ldb,
+                                     size_t A_rows, size_t A_cols, float alpha)
+{
+    const int nt = transpose_nt_use(A_cols * ldb * sizeof(*B));
+
+    if (alpha == 1) {
+        TRANSPOSE_AVX_INTR_TILES_NT(A, lda, B, ldb, 0, A_rows, 0, A_cols,
+                                    16, NULL, nt, transpose_flt_avx_intr_16x16_blk,
+                                    transpose_flt_avx_intr_16x16_blk_nt,
+                                    transpose_flt_avx_intr_16x16_blk_part);
+    } else {
+        TRANSPOSE_AVX_INTR_TILES_NT(A, lda, B, ldb, 0, A_rows, 0, A_cols,
+                                    16, &alpha, nt, transpose_flt_avx_intr_16x16_blk,
+                                    transpose_flt_avx_intr_16x16_blk_nt,
+                                    transpose_flt_avx_intr_16x16_blk_part);
+    }
+}
+
+CPU_TARGET_AVX512
+void transpose_flt_cmplx_avx_intr_8x8_ld(const float complex* restrict A,
+                                         size_t lda,
+                                         float complex* restrict B, size_t ldb,
+                                         size_t A_rows, size_t A_cols,
+                                         float complex alpha)
+{
+    const int nt = transpose_nt_use(A_cols * ldb * sizeof(*B));
+
+    if (alpha == 1) {
+        TRANSPOSE_AVX_INTR_TILES_NT(A, lda, B, ldb, 0, A_rows, 0, A_cols,
+                                    8, NULL, nt, transpose_flt_cmplx_avx_intr_8x8_blk,
+                                    transpose_flt_cmplx_avx_intr_8x8_blk_nt,
+                                    transpose_flt_cmplx_avx_intr_8x8_blk_part);
+    } else {
+        TRANSPOSE_AVX_INTR_TILES_NT(A, lda, B, ldb, 0, A_rows, 0, A_cols,
+                                    8, &alpha, nt, transpose_flt_cmplx_avx_intr_8x8_blk,
+                                    transpose_flt_cmplx_avx_intr_8x8_blk_nt,
+                                    transpose_flt_cmplx_avx_intr_8x8_blk_part);
+    }
+}
+
+CPU_TARGET_AVX512
+void transpose_dbl_cmplx_avx_intr_4x4_ld(const double complex* restrict A,
+                                         size_t lda,
+                                         double complex* restrict B, size_t ldb,
+                                         size_t A_rows, size_t A_cols,
+                                         double complex alpha)
+{
+    const int nt = transpose_nt_use(A_cols * ldb * sizeof(*B));
+
+    if (alpha == 1) {
+        TRANSPOSE_AVX_INTR_TILES_NT(A, lda, B, ldb, 0, A_rows, 0, A_cols,
+                                    4, NULL, nt, transpose_dbl_cmplx_avx_intr_4x4_blk,
+                                    transpose_dbl_cmplx_avx_intr_4x4_blk_nt,
+                                    transpose_dbl_cmplx_avx_intr_4x4_blk_part);
+    } else {
+        TRANSPOSE_AVX_INTR_TILES_NT(A, lda, B, ldb, 0, A_rows, 0, A_cols,
+                                    4, &alpha, nt, transpose_dbl_cmplx_avx_intr_4x4_blk,
+                                    transpose_dbl_cmplx_avx_intr_4x4_blk_nt,
+                                    transpose_dbl_cmplx_avx_intr_4x4_blk_part);
+    }
+}
+
+/*
+ * In-place transpose of a square n x n matrix of doubles: each 8x8 tile above
+ * the diagonal and its mirror below it are loaded, transposed in registers and
+ * stored in each other's place.
+ */
+CPU_TARGET_AVX512
+void transpose_dbl_avx_intr_8x8_inplace(double *A, size_t n)
+{
+    TRANSPOSE_AVX_INTR_INPLACE_TILES(A, n, 0, n, 8,
+                                     transpose_dbl_avx_intr_8x8_swap,
+                                     transpose_dbl_avx_intr_8x8_swap_part);
+}
+
+CPU_TARGET_AVX512
+void transpose_flt_cmplx_avx_intr_8x8_inplace(float complex *A, size_t n)
+{
+    transpose_dbl_avx_intr_8x8_inplace((double *)A, n);
+}
+
+/*
+ * Cache-oblivious variants: the recursion (or Z-order walk) works on base tiles
+ * of a few register tiles each, which are then transposed by the usual kernels,
+ * so no block size has to be chosen.  See transpose-order.h.
+ */
+
+CPU_TARGET_AVX512
+static void transpose_tile_dbl_avx_intr_8x8(const void* restrict A, size_t lda,
+                                            void* restrict B, size_t ldb,
+                                            size_t r_min, size_t r_max,
+                                            size_t c_min, size_t c_max)
+{
+    TRANSPOSE_AVX_INTR_TILES((const double *)A, lda, (double *)B, ldb,
+                             r_min, r_max, c_min, c_max, 8, NULL,
+                             transpose_dbl_avx_intr_8x8_blk,
+                             transpose_dbl_avx_intr_8x8_blk_part);
+}
+
+CPU_TARGET_AVX512
+static void transpose_tile_flt_avx_intr_16x16(const void* restrict A,
+                                              size_t lda,
+                                              void* restrict B, size_t ldb,
+                                              size_t r_min, size_t r_max,
+                                              size_t c_min, size_t c_max)
+{
+    TRANSPOSE_AVX_INTR_TILES((const float *)A, lda, (float *)B, ldb,
+                             r_min, r_max, c_min, c_max, 16, NULL,
+                             transpose_flt_avx_intr_16x16_blk,
+                             transpose_flt_avx_intr_16x16_blk_part);
+}
+
+CPU_TARGET_AVX512
+static void transpose_tile_flt_cmplx_avx_intr_8x8(const void* restrict A,
+                                                  size_t lda,
+                                                  void* restrict B, size_t ldb,
+                                                  size_t r_min, size_t r_max,
+                                                  size_t c_min, size_t c_max)
+{
+    TRANSPOSE_AVX_INTR_TILES((const float complex *)A, lda,
+                             (float complex *)B, ldb,
+                             r_min, r_max, c_min, c_max, 8, NULL,
+                             transpose_flt_cmplx_avx_intr_8x8_blk,
+                             transpose_flt_cmplx_avx_intr_8x8_blk_part);
+}
+
+CPU_TARGET_AVX512
+static void transpose_tile_dbl_cmplx_avx_intr_4x4(const void* restrict A,
+                                                  size_t lda,
+                                                  void* restrict B, size_t ldb,
+                                                  size_t r_min, size_t r_max,
+                                                  size_t c_min, size_t c_max)
+{
+    TRANSPOSE_AVX_INTR_TILES((const double complex *)A, lda,
+                             (double complex *)B, ldb,
+                             r_min, r_max, c_min, c_max, 4, NULL,
+                             transpose_dbl_cmplx_avx_intr_4x4_blk,
+                             transpose_dbl_cmplx_avx_intr_4x4_blk_part);
+}
+
+CPU_TARGET_AVX512
+void transpose_dbl_avx_intr_8x8_recursive(const double* restrict A,
+                                          double* restrict B,
+                                          size_t A_rows, size_t A_cols)
+{
+    transpose_recursive_tiles(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                              TRANSPOSE_TILE_DBL,
+                              transpose_tile_dbl_avx_intr_8x8);
+}
+
+CPU_TARGET_AVX512
+void transpose_flt_avx_intr_16x16_recursive(const float* restrict A,
+                                            float* restrict B,
+                                            size_t A_rows, size_t A_cols)
+{
+    transpose_recursive_tiles(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                              TRANSPOSE_TILE_FLT,
+                              transpose_tile_flt_avx_intr_16x16);
+}
+
+CPU_TARGET_AVX512
+void transpose_flt_cmplx_avx_intr_8x8_recursive(const float complex* restrict A,
+                                                float complex* restrict B,
+                                                size_t A_rows, size_t A_cols)
+{
+    transpose_recursive_tiles(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                              TRANSPOSE_TILE_FLT_CMPLX,
+                              transpose_tile_flt_cmplx_avx_intr_8x8);
+}
+
+CPU_TARGET_AVX512
+void transpose_dbl_cmplx_avx_intr_4x4_recursive(const double complex* restrict A,
+                                                double complex* restrict B,
+                                                size_t A_rows, size_t A_cols)
+{
+    transpose_recursive_tiles(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                              TRANSPOSE_TILE_DBL_CMPLX,
+                              transpose_tile_dbl_cmplx_avx_intr_4x4);
+}
+
+CPU_TARGET_AVX512
+void transpose_dbl_avx_intr_8x8_morton(const double* restrict A,
+                                       double* restrict B,
+                                       size_t A_rows, size_t A_cols)
+{
+    transpose_morton_tiles(A, A_cols, B, A_rows, A_rows, A_cols,
+                           TRANSPOSE_TILE_DBL,
+                           transpose_tile_dbl_avx_intr_8x8);
+}
+
+CPU_TARGET_AVX512
+void transpose_flt_avx_intr_16x16_morton(const float* restrict A,
+                                         float* restrict B,
+                                         size_t A_rows, size_t A_cols)
+{
+    transpose_morton_tiles(A, A_cols, B, A_rows, A_rows, A_cols,
+                           TRANSPOSE_TILE_FLT,
+                           transpose_tile_flt_avx_intr_16x16);
+}
+
+CPU_TARGET_AVX512
+void transpose_flt_cmplx_avx_intr_8x8_morton(const float complex* restrict A,
+                                             float complex* restrict B,
+                                             size_t A_rows, size_t A_cols)
+{
+    transpose_morton_tiles(A, A_cols, B, A_rows, A_rows, A_cols,
+                           TRANSPOSE_TILE_FLT_CMPLX,
+                           transpose_tile_flt_cmplx_avx_intr_8x8);
+}
+
+CPU_TARGET_AVX512
+void transpose_dbl_cmplx_avx_intr_4x4_morton(const double complex* restrict A,
+                                             double complex* restrict B,
+                                             size_t A_rows, size_t A_cols)
+{
+    transpose_morton_tiles(A, A_cols, B, A_rows, A_rows, A_cols,
+                           TRANSPOSE_TILE_DBL_CMPLX,
+                           transpose_tile_dbl_cmplx_avx_intr_4x4);
+}
+
+/*
+ * Two-level blocked variants: outer tiles bound the DTLB footprint and the
+ * inner tiles, which should be multiples of the register tile, stay in L1.
+ */
+
+CPU_TARGET_AVX512
+void transpose_dbl_avx_intr_8x8_blocked2(const double* restrict A,
+                                         double* restrict B,
+                                         size_t A_rows, size_t A_cols,
+                                         size_t blk_rows, size_t blk_cols,
+                                         size_t sub_rows, size_t sub_cols)
+{
+    transpose_blocked2_tiles(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                             blk_rows, blk_cols, sub_rows, sub_cols,
+                             transpose_tile_dbl_avx_intr_8x8);
+}
+
+CPU_TARGET_AVX512
+void transpose_flt_avx_intr_16x16_blocked2(const float* restrict A,
+                                           float* restrict B,
+                                           size_t A_rows, size_t A_cols,
+                                           size_t blk_rows, size_t blk_cols,
+                                           size_t sub_rows, size_t sub_cols)
+{
+    transpose_blocked2_tiles(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                             blk_rows, blk_cols, sub_rows, sub_cols,
+                             transpose_tile_flt_avx_intr_16x16);
+}
+
+CPU_TARGET_AVX512
+void transpose_flt_cmplx_avx_intr_8x8_blocked2(const float complex* restrict A,
+                                               float complex* restrict B,
+                                               size_t A_rows, size_t A_cols,
+                                               size_t blk_rows, size_t blk_cols,
+                                               size_t sub_rows, size_t sub_cols)
+{
+    transpose_blocked2_tiles(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                             blk_rows, blk_cols, sub_rows, sub_cols,
+                             transpose_tile_flt_cmplx_avx_intr_8x8);
+}
+
+CPU_TARGET_AVX512
+void transpose_dbl_cmplx_avx_intr_4x4_blocked2(const double complex* restrict A,
+                                               double complex* restrict B,
+                                               size_t A_rows, size_t A_cols,
+                                               size_t blk_rows, size_t blk_cols,
+                                               size_t sub_rows, size_t sub_cols)
+{
+    transpose_blocked2_tiles(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                             blk_rows, blk_cols, sub_rows, sub_cols,
+                             transpose_tile_dbl_cmplx_avx_intr_4x4);
+}
+
+/*
+ * Prefetching variants.  Without a distance they fall back to the plain loop so
+ * that the prefetch bookkeeping is not measured.
+ */
+
+CPU_TARGET_AVX512
+void transpose_dbl_avx_intr_8x8_pf(const double* restrict A, double* restrict B,
+                                   size_t A_rows, size_t A_cols,
+                                   size_t pf_dist, enum transpose_pf_hint pf_hint)
+{
+    if (!pf_dist) {
+        transpose_dbl_avx_intr_8x8(A, B, A_rows, A_cols);
+        return;
+    }
+    TRANSPOSE_AVX_INTR_TILES_PF(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                                8, NULL, pf_dist, pf_hint,
+                                transpose_dbl_avx_intr_8x8_blk,
+                                transpose_dbl_avx_intr_8x8_blk_part);
+}
+
+CPU_TARGET_AVX512
+void transpose_flt_avx_intr_16x16_pf(const float* restrict A, float* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t pf_dist, enum transpose_pf_hint pf_hint)
+{
+    if (!pf_dist) {
+        transpose_flt_avx_intr_16x16(A, B, A_rows, A_cols);
+        return;
+    }
+    TRANSPOSE_AVX_INTR_TILES_PF(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                                16, NULL, pf_dist, pf_hint,
+                                transpose_flt_avx_intr_16x16_blk,
+                                transpose_flt_avx_intr_16x16_blk_part);
+}
+
+CPU_TARGET_AVX512
+void transpose_flt_cmplx_avx_intr_8x8_pf(const float complex* restrict A,
+                                         float complex* restrict B,
+                                         size_t A_rows, size_t A_cols,
+                                         size_t pf_dist, enum transpose_pf_hint pf_hint)
+{
+    if (!pf_dist) {
+        transpose_flt_cmplx_avx_intr_8x8(A, B, A_rows, A_cols);
+        return;
     }
+    TRANSPOSE_AVX_INTR_TILES_PF(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                                8, NULL, pf_dist, pf_hint,
+                                transpose_flt_cmplx_avx_intr_8x8_blk,
+                                transpose_flt_cmplx_avx_intr_8x8_blk_part);
+}
+
+CPU_TARGET_AVX512
+void transpose_dbl_cmplx_avx_intr_4x4_pf(const double complex* restrict A,
+                                         double complex* restrict B,
+                                         size_t A_rows, size_t A_cols,
+                                         size_t pf_dist, enum transpose_pf_hint pf_hint)
+{
+    if (!pf_dist) {
+        transpose_dbl_cmplx_avx_intr_4x4(A, B, A_rows, A_cols);
+        return;
+    }
+    TRANSPOSE_AVX_INTR_TILES_PF(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                                4, NULL, pf_dist, pf_hint,
+                                transpose_dbl_cmplx_avx_intr_4x4_blk,
+                                transpose_dbl_cmplx_avx_intr_4x4_blk_part);
+}
+
+/*
+ * Write-combining variants.  The staging buffer rows are TRANSPOSE_TILE_*
+ * elements, i.e., whole cache lines, so only the rows of B decide whether the
+ * flush can stream.
+ */
+
+CPU_TARGET_AVX512
+void transpose_dbl_avx_intr_8x8_wc(const double* restrict A, double* restrict B,
+                                   size_t A_rows, size_t A_cols)
+{
+    TRANSPOSE_AVX_INTR_WC_TILES(double, A, A_cols, B, A_rows,
+                                0, A_rows, 0, A_cols, TRANSPOSE_TILE_DBL, 8,
+                                transpose_dbl_avx_intr_8x8_blk,
+                                transpose_dbl_avx_intr_8x8_blk_part);
+}
+
+CPU_TARGET_AVX512
+void transpose_flt_avx_intr_16x16_wc(const float* restrict A, float* restrict B,
+                                     size_t A_rows, size_t A_cols)
+{
+    TRANSPOSE_AVX_INTR_WC_TILES(float, A, A_cols, B, A_rows,
+                                0, A_rows, 0, A_cols, TRANSPOSE_TILE_FLT, 16,
+                                transpose_flt_avx_intr_16x16_blk,
+                                transpose_flt_avx_intr_16x16_blk_part);
+}
+
+CPU_TARGET_AVX512
+void transpose_flt_cmplx_avx_intr_8x8_wc(const float complex* restrict A,
+                                         float complex* restrict B,
+                                         size_t A_rows, size_t A_cols)
+{
+    TRANSPOSE_AVX_INTR_WC_TILES(float complex, A, A_cols, B, A_rows,
+                                0, A_rows, 0, A_cols,
+                                TRANSPOSE_TILE_FLT_CMPLX, 8,
+                                transpose_flt_cmplx_avx_intr_8x8_blk,
+                                transpose_flt_cmplx_avx_intr_8x8_blk_part);
+}
+
+CPU_TARGET_AVX512
+void transpose_dbl_cmplx_avx_intr_4x4_wc(const double complex* restrict A,
+                                         double complex* restrict B,
+                                         size_t A_rows, size_t A_cols)
+{
+    TRANSPOSE_AVX_INTR_WC_TILES(double complex, A, A_cols, B, A_rows,
+                                0, A_rows, 0, A_cols,
+                                TRANSPOSE_TILE_DBL_CMPLX, 4,
+                                transpose_dbl_cmplx_avx_intr_4x4_blk,
+                                transpose_dbl_cmplx_avx_intr_4x4_blk_part);
 }
@@ -8,9 +8,343 @@
 #ifndef TRANSPOSE_AVX_H
 #define TRANSPOSE_AVX_H
 
+#include <complex.h>
+#include <stdint.h>
 #include <stdlib.h>
 
+#include "transpose-cvt.h"
+#include "transpose-epi.h"
+#include "transpose-iq.h"
+#include "transpose-perm.h"
+#include "transpose-prefetch.h"
+
 void transpose_dbl_avx_intr_8x8(const double* restrict A, double* restrict B,
                                 size_t A_rows, size_t A_cols);
 
+void transpose_flt_avx_intr_16x16(const float* restrict A, float* restrict B,
+                                  size_t A_rows, size_t A_cols);
+
+void transpose_flt_cmplx_avx_intr_8x8(const float complex* restrict A,
+                                      float complex* restrict B,
+                                      size_t A_rows, size_t A_cols);
+
+void transpose_dbl_cmplx_avx_intr_4x4(const double complex* restrict A,
+                                      double complex* restrict B,
+                                      size_t A_rows, size_t A_cols);
+
+/*
+ * 8- and 16-bit integer variants built on AVX-512BW byte and word unpacks,
+ * transposing 16x16 tiles four (bytes) or two (words) at a time.
+ */
+void transpose_u8_avx_intr_16x16(const uint8_t* restrict A, uint8_t* restrict B,
+                                 size_t A_rows, size_t A_cols);
+
+void transpose_i16_avx_intr_16x16(const int16_t* restrict A,
+                                  int16_t* restrict B,
+                                  size_t A_rows, size_t A_cols);
+
+/*
+ * Ingest variants that convert interleaved I/Q samples to float complex,
+ * scaled by scale, while transposing.  See transpose.h.
+ */
+void transpose_iq16_flt_cmplx_avx_intr_8x8(const transpose_iq16_t* restrict A,
+                                           float complex* restrict B,
+                                           size_t A_rows, size_t A_cols,
+                                           float scale);
+
+void transpose_iq12_flt_cmplx_avx_intr_8x8(const transpose_iq12_t* restrict A,
+                                           float complex* restrict B,
+                                           size_t A_rows, size_t A_cols,
+                                           float scale);
+
+/*
+ * Precision-converting variants that round to the narrower output type while
+ * transposing.  See transpose.h.  The bf16 variants use AVX512_BF16 when the
+ * CPU has it.
+ */
+void transpose_dbl_flt_avx_intr_16x16(const double* restrict A,
+                                      float* restrict B,
+                                      size_t A_rows, size_t A_cols);
+
+void transpose_dbl_cmplx_flt_cmplx_avx_intr_8x8(const double complex* restrict A,
+                                                float complex* restrict B,
+                                                size_t A_rows, size_t A_cols);
+
+void transpose_flt_fp16_avx_intr_16x16(const float* restrict A,
+                                       transpose_fp16_t* restrict B,
+                                       size_t A_rows, size_t A_cols);
+
+void transpose_flt_bf16_avx_intr_16x16(const float* restrict A,
+                                       transpose_bf16_t* restrict B,
+                                       size_t A_rows, size_t A_cols);
+
+void transpose_flt_cmplx_fp16_cmplx_avx_intr_8x8(const float complex* restrict A,
+                                                 transpose_fp16_cmplx_t* restrict B,
+                                                 size_t A_rows, size_t A_cols);
+
+void transpose_flt_cmplx_bf16_cmplx_avx_intr_8x8(const float complex* restrict A,
+                                                 transpose_bf16_cmplx_t* restrict B,
+                                                 size_t A_rows, size_t A_cols);
+
+/*
+ * Split-complex variants that (de)interleave real and imaginary planes while
+ * transposing.  See transpose.h.
+ */
+void transpose_flt_cmplx_split_avx_intr_16x16(const float complex* restrict A,
+                                              float* restrict B_re,
+                                              float* restrict B_im,
+                                              size_t A_rows, size_t A_cols);
+
+void transpose_dbl_cmplx_split_avx_intr_8x8(const double complex* restrict A,
+                                            double* restrict B_re,
+                                            double* restrict B_im,
+                                            size_t A_rows, size_t A_cols);
+
+void transpose_flt_split_cmplx_avx_intr_16x16(const float* restrict A_re,
+                                              const float* restrict A_im,
+                                              float complex* restrict B,
+                                              size_t A_rows, size_t A_cols);
+
+void transpose_dbl_split_cmplx_avx_intr_8x8(const double* restrict A_re,
+                                            const double* restrict A_im,
+                                            double complex* restrict B,
+                                            size_t A_rows, size_t A_cols);
+
+/*
+ * Epilogue variants that scale, conjugate, window and/or twiddle each element
+ * as described by epi while transposing.  See transpose-epi.h.
+ */
+void transpose_flt_cmplx_avx_intr_8x8_epi(const float complex* restrict A,
+                                          float complex* restrict B,
+                                          size_t A_rows, size_t A_cols,
+                                          const struct transpose_epi_flt_cmplx *epi);
+
+void transpose_dbl_cmplx_avx_intr_4x4_epi(const double complex* restrict A,
+                                          double complex* restrict B,
+                                          size_t A_rows, size_t A_cols,
+                                          const struct transpose_epi_dbl_cmplx *epi);
+
+/*
+ * Permuting variants that write element (r, c) of A to B[rows[c]][cols[r]].
+ * See transpose-perm.h.
+ *
+ * The SIMD kernels need perm in gather form, as built by
+ * transpose_perm_tables().  The *_perm variants allocate and build those
+ * tables on every call, which is fine for a one-off transpose.  Callers that
+ * reuse the same permutation, e.g., across the transposes of an FFT, should
+ * build src (A_rows entries) and dst (A_cols entries) once and call the
+ * *_perm_tables variants instead.
+ */
+void transpose_dbl_avx_intr_8x8_perm(const double* restrict A,
+                                     double* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     const struct transpose_perm *perm);
+
+void transpose_flt_avx_intr_16x16_perm(const float* restrict A,
+                                       float* restrict B,
+                                       size_t A_rows, size_t A_cols,
+                                       const struct transpose_perm *perm);
+
+void transpose_flt_cmplx_avx_intr_8x8_perm(const float complex* restrict A,
+                                           float complex* restrict B,
+                                           size_t A_rows, size_t A_cols,
+                                           const struct transpose_perm *perm);
+
+void transpose_dbl_cmplx_avx_intr_4x4_perm(const double complex* restrict A,
+                                           double complex* restrict B,
+                                           size_t A_rows, size_t A_cols,
+                                           const struct transpose_perm *perm);
+
+void transpose_dbl_avx_intr_8x8_perm_tables(const double* restrict A,
+                                            double* restrict B,
+                                            size_t A_rows, size_t A_cols,
+                                            const size_t *src,
+                                            const size_t *dst);
+
+void transpose_flt_avx_intr_16x16_perm_tables(const float* restrict A,
+                                              float* restrict B,
+                                              size_t A_rows, size_t A_cols,
+                                              const size_t *src,
+                                              const size_t *dst);
+
+void transpose_flt_cmplx_avx_intr_8x8_perm_tables(const float complex* restrict A,
+                                                  float complex* restrict B,
+                                                  size_t A_rows, size_t A_cols,
+                                                  const size_t *src,
+                                                  const size_t *dst);
+
+void transpose_dbl_cmplx_avx_intr_4x4_perm_tables(const double complex* restrict A,
+                                                  double complex* restrict B,
+                                                  size_t A_rows, size_t A_cols,
+                                                  const size_t *src,
+                                                  const size_t *dst);
+
+/*
+ * Skinny variants for matrices with at most 16 rows or columns, e.g., a few
+ * channels by many samples, which shuffle whole rows instead of transposing
+ * mostly empty tiles.  Larger matrices go to the tile kernel.
+ */
+void transpose_flt_avx_intr_skinny(const float* restrict A, float* restrict B,
+                                   size_t A_rows, size_t A_cols);
+
+void transpose_dbl_avx_intr_skinny(const double* restrict A, double* restrict B,
+                                   size_t A_rows, size_t A_cols);
+
+void transpose_flt_cmplx_avx_intr_skinny(const float complex* restrict A,
+                                         float complex* restrict B,
+                                         size_t A_rows, size_t A_cols);
+
+void transpose_dbl_cmplx_avx_intr_skinny(const double complex* restrict A,
+                                         double complex* restrict B,
+                                         size_t A_rows, size_t A_cols);
+
+/*
+ * Unrolled double variants that transpose two (8x16, 16x8) or four (16x16)
+ * adjacent 8x8 tiles per iteration.
+ */
+void transpose_dbl_avx_intr_8x16(const double* restrict A, double* restrict B,
+                                 size_t A_rows, size_t A_cols);
+
+void transpose_dbl_avx_intr_16x8(const double* restrict A, double* restrict B,
+                                 size_t A_rows, size_t A_cols);
+
+void transpose_dbl_avx_intr_16x16(const double* restrict A, double* restrict B,
+                                  size_t A_rows, size_t A_cols);
+
+/*
+ * Strided variants: A has row stride lda and B has row stride ldb, and each
+ * output element is scaled by alpha.  See transpose.h.
+ */
+void transpose_dbl_avx_intr_8x8_ld(const double* restrict A, size_t lda,
+                                   double* restrict B, size_t ldb,
+                                   size_t A_rows, size_t A_cols, double alpha);
+
+void transpose_flt_avx_intr_16x16_ld(const float* restrict A, size_t lda,
+                                     float* restrict B, size_t ldb,
+                                     size_t A_rows, size_t A_cols, float alpha);
+
+void transpose_flt_cmplx_avx_intr_8x8_ld(const float complex* restrict A,
+                                         size_t lda,
+                                         float complex* restrict B, size_t ldb,
+                                         size_t A_rows, size_t A_cols,
+                                         float complex alpha);
+
+void transpose_dbl_cmplx_avx_intr_4x4_ld(const double complex* restrict A,
+                                         size_t lda,
+                                         double complex* restrict B, size_t ldb,
+                                         size_t A_rows, size_t A_cols,
+                                         double complex alpha);
+
+/*
+ * In-place transposes of a square n x n matrix by swapping mirrored 8x8 tile
+ * pairs.  See transpose.h.
+ */
+void transpose_dbl_avx_intr_8x8_inplace(double *A, size_t n);
+
+void transpose_flt_cmplx_avx_intr_8x8_inplace(float complex *A, size_t n);
+
+/*
+ * Cache-oblivious variants that need no block size.  See transpose.h.
+ */
+void transpose_dbl_avx_intr_8x8_recursive(const double* restrict A,
+                                          double* restrict B,
+                                          size_t A_rows, size_t A_cols);
+
+void transpose_flt_avx_intr_16x16_recursive(const float* restrict A,
+                                            float* restrict B,
+                                            size_t A_rows, size_t A_cols);
+
+void transpose_flt_cmplx_avx_intr_8x8_recursive(const float complex* restrict A,
+                                                float complex* restrict B,
+                                                size_t A_rows, size_t A_cols);
+
+void transpose_dbl_cmplx_avx_intr_4x4_recursive(const double complex* restrict A,
+                                                double complex* restrict B,
+                                                size_t A_rows, size_t A_cols);
+
+void transpose_dbl_avx_intr_8x8_morton(const double* restrict A,
+                                       double* restrict B,
+                                       size_t A_rows, size_t A_cols);
+
+void transpose_flt_avx_intr_16x16_morton(const float* restrict A,
+                                         float* restrict B,
+                                         size_t A_rows, size_t A_cols);
+
+void transpose_flt_cmplx_avx_intr_8x8_morton(const float complex* restrict A,
+                                             float complex* restrict B,
+                                             size_t A_rows, size_t A_cols);
+
+void transpose_dbl_cmplx_avx_intr_4x4_morton(const double complex* restrict A,
+                                             double complex* restrict B,
+                                             size_t A_rows, size_t A_cols);
+
+/*
+ * Two-level blocked variants: the inner sub_rows x sub_cols tiles are walked
+ * by the register kernels.  See transpose.h.
+ */
+void transpose_dbl_avx_intr_8x8_blocked2(const double* restrict A,
+                                         double* restrict B,
+                                         size_t A_rows, size_t A_cols,
+                                         size_t blk_rows, size_t blk_cols,
+                                         size_t sub_rows, size_t sub_cols);
+
+void transpose_flt_avx_intr_16x16_blocked2(const float* restrict A,
+                                           float* restrict B,
+                                           size_t A_rows, size_t A_cols,
+                                           size_t blk_rows, size_t blk_cols,
+                                           size_t sub_rows, size_t sub_cols);
+
+void transpose_flt_cmplx_avx_intr_8x8_blocked2(const float complex* restrict A,
+                                               float complex* restrict B,
+                                               size_t A_rows, size_t A_cols,
+                                               size_t blk_rows, size_t blk_cols,
+                                               size_t sub_rows, size_t sub_cols);
+
+void transpose_dbl_cmplx_avx_intr_4x4_blocked2(const double complex* restrict A,
+                                               double complex* restrict B,
+                                               size_t A_rows, size_t A_cols,
+                                               size_t blk_rows, size_t blk_cols,
+                                               size_t sub_rows, size_t sub_cols);
+
+/*
+ * Prefetching variants: the register tile pf_dist tiles ahead is prefetched
+ * with pf_hint (pf_dist == 0 disables prefetching).  See transpose-prefetch.h.
+ */
+void transpose_dbl_avx_intr_8x8_pf(const double* restrict A, double* restrict B,
+                                   size_t A_rows, size_t A_cols,
+                                   size_t pf_dist, enum transpose_pf_hint pf_hint);
+
+void transpose_flt_avx_intr_16x16_pf(const float* restrict A, float* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t pf_dist, enum transpose_pf_hint pf_hint);
+
+void transpose_flt_cmplx_avx_intr_8x8_pf(const float complex* restrict A,
+                                         float complex* restrict B,
+                                         size_t A_rows, size_t A_cols,
+                                         size_t pf_dist, enum transpose_pf_hint pf_hint);
+
+void transpose_dbl_cmplx_avx_intr_4x4_pf(const double complex* restrict A,
+                                         double complex* restrict B,
+                                         size_t A_rows, size_t A_cols,
+                                         size_t pf_dist, enum transpose_pf_hint pf_hint);
+
+/*
+ * Write-combining variants: the register kernels transpose each tile into an
+ * L1-resident staging buffer that is streamed to B in whole cache lines.  See
+ * transpose-wc.h.
+ */
+void transpose_dbl_avx_intr_8x8_wc(const double* restrict A, double* restrict B,
+                                   size_t A_rows, size_t A_cols);
+
+void transpose_flt_avx_intr_16x16_wc(const float* restrict A, float* restrict B,
+                                     size_t A_rows, size_t A_cols);
+
+void transpose_flt_cmplx_avx_intr_8x8_wc(const float complex* restrict A,
+                                         float complex* restrict B,
+                                         size_t A_rows, size_t A_cols);
+
+void transpose_dbl_cmplx_avx_intr_4x4_wc(const double complex* restrict A,
+                                         double complex* restrict B,
+                                         size_t A_rows, size_t A_cols);
+
 #endif /* TRANSPOSE_AVX_H */
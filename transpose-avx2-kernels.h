@@ -0,0 +1,110 @@
+/**
+ * AVX2 register tile kernels shared by the serial and threaded transposes.
+ *
+ * Each kernel transposes one square tile that starts at A (row stride lda) and
+ * writes it to B (row stride ldb).
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_AVX2_KERNELS_H
+#define TRANSPOSE_AVX2_KERNELS_H
+
+#include <stdlib.h>
+
+// intrinsics
+#include <immintrin.h>
+
+#include "cpu-features.h"
+
+/*
+ * Transpose a 4x4 block of doubles.  Pairs of rows are interleaved within
+ * 128-bit lanes, then the lanes are exchanged.
+ */
+CPU_TARGET_AVX2
+static inline void transpose_dbl_avx2_intr_4x4_blk(const double* restrict A,
+                                                   double* restrict B,
+                                                   size_t lda, size_t ldb)
+{
+    __m256d r[4], s[4];
+
+    // read 4x4 block of read array
+    r[0] = _mm256_load_pd(&A[0]);
+    r[1] = _mm256_load_pd(&A[lda]);
+    r[2] = _mm256_load_pd(&A[2*lda]);
+    r[3] = _mm256_load_pd(&A[3*lda]);
+
+    // shuffle doubles within 128-bit lanes
+    s[0] = _mm256_unpacklo_pd(r[0], r[1]);
+    s[1] = _mm256_unpackhi_pd(r[0], r[1]);
+    s[2] = _mm256_unpacklo_pd(r[2], r[3]);
+    s[3] = _mm256_unpackhi_pd(r[2], r[3]);
+
+    // exchange 128-bit lanes
+    r[0] = _mm256_permute2f128_pd(s[0], s[2], 0x20);
+    r[1] = _mm256_permute2f128_pd(s[1], s[3], 0x20);
+    r[2] = _mm256_permute2f128_pd(s[0], s[2], 0x31);
+    r[3] = _mm256_permute2f128_pd(s[1], s[3], 0x31);
+
+    // write back 4x4 block of write array
+#if defined(USE_AVX_STREAMING_STORES)
+    _mm256_stream_pd(&B[0], r[0]);
+    _mm256_stream_pd(&B[ldb], r[1]);
+    _mm256_stream_pd(&B[2*ldb], r[2]);
+    _mm256_stream_pd(&B[3*ldb], r[3]);
+#else
+    _mm256_store_pd(&B[0], r[0]);
+    _mm256_store_pd(&B[ldb], r[1]);
+    _mm256_store_pd(&B[2*ldb], r[2]);
+    _mm256_store_pd(&B[3*ldb], r[3]);
+#endif
+}
+
+/*
+ * Transpose an 8x8 block of floats.  Rows are interleaved 32 and 64 bits at a
+ * time within 128-bit lanes, then the lanes are exchanged.
+ */
+CPU_TARGET_AVX2
+static inline void transpose_flt_avx2_intr_8x8_blk(const float* restrict A,
+                                                   float* restrict B,
+                                                   size_t lda, size_t ldb)
+{
+    __m256 r[8], s[8];
+    size_t i;
+
+    // read 8x8 block of read array
+    for (i = 0; i < 8; i++) {
+        r[i] = _mm256_load_ps(&A[i*lda]);
+    }
+
+    // interleave pairs of rows 32 bits at a time within 128-bit lanes
+    for (i = 0; i < 8; i += 2) {
+        s[i] = _mm256_unpacklo_ps(r[i], r[i+1]);
+        s[i+1] = _mm256_unpackhi_ps(r[i], r[i+1]);
+    }
+
+    // combine 64-bit pairs so each lane holds one column of four rows
+    for (i = 0; i < 8; i += 4) {
+        r[i] = _mm256_shuffle_ps(s[i], s[i+2], _MM_SHUFFLE(1, 0, 1, 0));
+        r[i+1] = _mm256_shuffle_ps(s[i], s[i+2], _MM_SHUFFLE(3, 2, 3, 2));
+        r[i+2] = _mm256_shuffle_ps(s[i+1], s[i+3], _MM_SHUFFLE(1, 0, 1, 0));
+        r[i+3] = _mm256_shuffle_ps(s[i+1], s[i+3], _MM_SHUFFLE(3, 2, 3, 2));
+    }
+
+    // exchange 128-bit lanes between the upper and lower four rows
+    for (i = 0; i < 4; i++) {
+        s[i] = _mm256_permute2f128_ps(r[i], r[4+i], 0x20);
+        s[4+i] = _mm256_permute2f128_ps(r[i], r[4+i], 0x31);
+    }
+
+    // write back 8x8 block of write array
+    for (i = 0; i < 8; i++) {
+#if defined(USE_AVX_STREAMING_STORES)
+        _mm256_stream_ps(&B[i*ldb], s[i]);
+#else
+        _mm256_store_ps(&B[i*ldb], s[i]);
+#endif
+    }
+}
+
+#endif /* TRANSPOSE_AVX2_KERNELS_H */
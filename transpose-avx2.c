@@ -0,0 +1,75 @@
+/**
+ * Transpose functions.
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @date 2026-10-17
+ */
+#include <assert.h>
+#include <stdlib.h>
+
+// intrinsics
+#include <immintrin.h>
+
+#include "cpu-features.h"
+#include "transpose-avx2.h"
+#include "transpose-avx2-kernels.h"
+
+/*
+ * This function uses AVX2 intrinsics to transpose a 4x4 block of doubles.  It
+ * will not work correctly unless both A_rows and A_cols are multiples of 4.
+ */
+CPU_TARGET_AVX2
+void transpose_dbl_avx2_intr_4x4(const double* restrict A, double* restrict B,
+                                 size_t A_rows, size_t A_cols)
+{
+    size_t i_min, j_min;
+    size_t num_row_blocks, num_col_blocks;
+    size_t rblk_num, cblk_num;
+
+    assert(A_rows % 4 == 0);
+    assert(A_cols % 4 == 0);
+
+    num_row_blocks = A_rows / 4;
+    num_col_blocks = A_cols / 4;
+
+    // perform transpose over all blocks
+    for (rblk_num = 0; rblk_num < num_row_blocks; rblk_num++) {
+        i_min = rblk_num * 4;
+        for (cblk_num = 0; cblk_num < num_col_blocks; cblk_num++) {
+            j_min = cblk_num * 4;
+            transpose_dbl_avx2_intr_4x4_blk(&A[i_min * A_cols + j_min],
+                                            &B[j_min * A_rows + i_min],
+                                            A_cols, A_rows);
+        }
+    }
+}
+
+/*
+ * This function uses AVX2 intrinsics to transpose an 8x8 block of floats.  It
+ * will not work correctly unless both A_rows and A_cols are multiples of 8.
+ */
+CPU_TARGET_AVX2
+void transpose_flt_avx2_intr_8x8(const float* restrict A, float* restrict B,
+                                 size_t A_rows, size_t A_cols)
+{
+    size_t i_min, j_min;
+    size_t num_row_blocks, num_col_blocks;
+    size_t rblk_num, cblk_num;
+
+    assert(A_rows % 8 == 0);
+    assert(A_cols % 8 == 0);
+
+    num_row_blocks = A_rows / 8;
+    num_col_blocks = A_cols / 8;
+
+    // perform transpose over all blocks
+    for (rblk_num = 0; rblk_num < num_row_blocks; rblk_num++) {
+        i_min = rblk_num * 8;
+        for (cblk_num = 0; cblk_num < num_col_blocks; cblk_num++) {
+            j_min = cblk_num * 8;
+            transpose_flt_avx2_intr_8x8_blk(&A[i_min * A_cols + j_min],
+                                            &B[j_min * A_rows + i_min],
+                                            A_cols, A_rows);
+        }
+    }
+}
@@ -0,0 +1,18 @@
+/**
+ * Transpose functions.
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_AVX2_H
+#define TRANSPOSE_AVX2_H
+
+#include <stdlib.h>
+
+void transpose_dbl_avx2_intr_4x4(const double* restrict A, double* restrict B,
+                                 size_t A_rows, size_t A_cols);
+
+void transpose_flt_avx2_intr_8x8(const float* restrict A, float* restrict B,
+                                 size_t A_rows, size_t A_cols);
+
+#endif /* TRANSPOSE_AVX2_H */
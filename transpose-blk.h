@@ -0,0 +1,281 @@
+/**
+ * Scalar tile kernels shared by the naive, blocked and threaded transposes.
+ *
+ * Moving an element only depends on its width, so the unscaled kernels are
+ * generated once per element width (1, 2, 4, 8, 16 and 32 bytes) and serve
+ * every data type of that width.  They are static inline and take no function
+ * pointers, so each tile loop is inlined into its caller and vectorized there.
+ * Only scaling by alpha needs the element type, see TRANSPOSE_BLK_LD.
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_BLK_H
+#define TRANSPOSE_BLK_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "transpose-nt.h"
+#include "transpose-perm.h"
+
+/*
+ * Element types of each width.  They may alias any type, so a float complex
+ * matrix can be moved as 8-byte words without breaking strict aliasing.
+ */
+typedef uint8_t __attribute__((__may_alias__)) transpose_w1_t;
+typedef uint16_t __attribute__((__may_alias__)) transpose_w2_t;
+typedef uint32_t __attribute__((__may_alias__)) transpose_w4_t;
+typedef uint64_t __attribute__((__may_alias__)) transpose_w8_t;
+typedef struct __attribute__((__may_alias__)) {
+    uint64_t v[2];
+} transpose_w16_t;
+typedef struct __attribute__((__may_alias__)) {
+    uint64_t v[4];
+} transpose_w32_t;
+
+/*
+ * Transpose rows [r_min, r_max) and columns [c_min, c_max) of A (row stride
+ * lda) into B (row stride ldb), scaling by alpha.  A constant alpha of 1 is
+ * folded away by the compiler.
+ */
+#define TRANSPOSE_BLK_LD(A, lda, B, ldb, alpha, r_min, c_min, r_max, c_max) { \
+    size_t r, c; \
+    for (r = (r_min); r < (r_max); r++) { \
+        for (c = (c_min); c < (c_max); c++) { \
+            (B)[(c) * (ldb) + (r)] = (alpha) * (A)[(r) * (lda) + (c)]; \
+        } \
+    } \
+}
+
+/*
+ * TRANSPOSE_BLK_LD with streaming stores through fn_store.  The loops are
+ * swapped so that each row of B is written contiguously, letting the
+ * write-combining buffers fill whole cache lines.
+ */
+#define TRANSPOSE_BLK_LD_NT(A, lda, B, ldb, alpha, r_min, c_min, r_max, c_max, \
+                            fn_store) { \
+    size_t r, c; \
+    for (c = (c_min); c < (c_max); c++) { \
+        for (r = (r_min); r < (r_max); r++) { \
+            fn_store(&(B)[(c) * (ldb) + (r)], \
+                     (alpha) * (A)[(r) * (lda) + (c)]); \
+        } \
+    } \
+}
+
+/*
+ * Transpose rows [r_min, r_max) and columns [c_min, c_max) of the interleaved
+ * complex A (row stride lda) into the real and imaginary planes B_re and B_im
+ * (row stride ldb), taking the parts apart with fn_re and fn_im.
+ */
+#define TRANSPOSE_TO_SPLIT_BLK(A, lda, B_re, B_im, ldb, r_min, c_min, r_max, \
+                               c_max, fn_re, fn_im) { \
+    size_t r, c; \
+    for (r = (r_min); r < (r_max); r++) { \
+        for (c = (c_min); c < (c_max); c++) { \
+            (B_re)[(c) * (ldb) + (r)] = fn_re((A)[(r) * (lda) + (c)]); \
+            (B_im)[(c) * (ldb) + (r)] = fn_im((A)[(r) * (lda) + (c)]); \
+        } \
+    } \
+}
+
+// the reverse, joining the parts with fn_cmplx
+#define TRANSPOSE_FROM_SPLIT_BLK(A_re, A_im, lda, B, ldb, r_min, c_min, r_max, \
+                                 c_max, fn_cmplx) { \
+    size_t r, c; \
+    for (r = (r_min); r < (r_max); r++) { \
+        for (c = (c_min); c < (c_max); c++) { \
+            (B)[(c) * (ldb) + (r)] = fn_cmplx((A_re)[(r) * (lda) + (c)], \
+                                              (A_im)[(r) * (lda) + (c)]); \
+        } \
+    } \
+}
+
+/*
+ * Swap the tile covering rows [r_min, r_max) and columns [c_min, c_max) of the
+ * n x n matrix A with its mirror tile across the diagonal.  A diagonal tile
+ * (r_min == c_min) is its own mirror, so only its upper triangle is swapped.
+ */
+#define TRANSPOSE_SWAP_BLK(datatype, A, n, r_min, c_min, r_max, c_max) { \
+    size_t r, c; \
+    datatype tmp; \
+    for (r = (r_min); r < (r_max); r++) { \
+        for (c = (r_min) == (c_min) ? r + 1 : (c_min); c < (c_max); c++) { \
+            tmp = (A)[r * (n) + c]; \
+            (A)[r * (n) + c] = (A)[c * (n) + r]; \
+            (A)[c * (n) + r] = tmp; \
+        } \
+    } \
+}
+
+/*
+ * Streaming stores of one element of each width.  There are none narrower than
+ * 4 bytes, so those are regular stores; wider elements take several movnti.
+ */
+static inline void transpose_nt_store_w1(transpose_w1_t *p, transpose_w1_t v)
+{
+    *p = v;
+}
+
+static inline void transpose_nt_store_w2(transpose_w2_t *p, transpose_w2_t v)
+{
+    *p = v;
+}
+
+static inline void transpose_nt_store_w4(transpose_w4_t *p, transpose_w4_t v)
+{
+#if defined(__SSE2__)
+    _mm_stream_si32((int *)p, (int)v);
+#else
+    *p = v;
+#endif
+}
+
+static inline void transpose_nt_store_w8(transpose_w8_t *p, transpose_w8_t v)
+{
+#if defined(__SSE2__) && defined(__x86_64__)
+    _mm_stream_si64((long long *)p, (long long)v);
+#else
+    *p = v;
+#endif
+}
+
+static inline void transpose_nt_store_w16(transpose_w16_t *p,
+                                          transpose_w16_t v)
+{
+    transpose_nt_store_w8((transpose_w8_t *)p, v.v[0]);
+    transpose_nt_store_w8((transpose_w8_t *)p + 1, v.v[1]);
+}
+
+static inline void transpose_nt_store_w32(transpose_w32_t *p,
+                                          transpose_w32_t v)
+{
+    size_t i;
+    for (i = 0; i < 4; i++) {
+        transpose_nt_store_w8((transpose_w8_t *)p + i, v.v[i]);
+    }
+}
+
+/*
+ * For element width w, define:
+ * - transpose_blk_w<w>(), an unscaled TRANSPOSE_BLK_LD over void pointers;
+ * - transpose_blk_w<w>_nt(), the same with streaming stores;
+ * - transpose_tile_w<w>(), transpose_blk_w<w>() as an fn_transpose_tile (see
+ *   transpose-order.h), i.e., with the ranges in that order;
+ * - transpose_blocked_w<w>(), a blocked transpose of A_rows x A_cols elements
+ *   in blk_rows x blk_cols blocks (ragged ones at the bottom and right edges),
+ *   streaming, and fencing, when nt is set;
+ * - transpose_blk_w<w>_perm() and transpose_blocked_w<w>_perm(), the same
+ *   without streaming, writing each element to its permuted position in B
+ *   (see transpose-perm.h).
+ */
+#define TRANSPOSE_BLK_W_DEFINE(w) \
+static inline void transpose_blk_w##w(const void* restrict A, size_t lda, \
+                                      void* restrict B, size_t ldb, \
+                                      size_t r_min, size_t c_min, \
+                                      size_t r_max, size_t c_max) \
+{ \
+    const transpose_w##w##_t* restrict _A = A; \
+    transpose_w##w##_t* restrict _B = B; \
+    size_t r, c; \
+    for (r = r_min; r < r_max; r++) { \
+        for (c = c_min; c < c_max; c++) { \
+            _B[c * ldb + r] = _A[r * lda + c]; \
+        } \
+    } \
+} \
+\
+static inline void transpose_blk_w##w##_nt(const void* restrict A, size_t lda, \
+                                           void* restrict B, size_t ldb, \
+                                           size_t r_min, size_t c_min, \
+                                           size_t r_max, size_t c_max) \
+{ \
+    const transpose_w##w##_t* restrict _A = A; \
+    transpose_w##w##_t* restrict _B = B; \
+    size_t r, c; \
+    for (c = c_min; c < c_max; c++) { \
+        for (r = r_min; r < r_max; r++) { \
+            transpose_nt_store_w##w(&_B[c * ldb + r], _A[r * lda + c]); \
+        } \
+    } \
+} \
+\
+static inline void transpose_tile_w##w(const void* restrict A, size_t lda, \
+                                       void* restrict B, size_t ldb, \
+                                       size_t r_min, size_t r_max, \
+                                       size_t c_min, size_t c_max) \
+{ \
+    transpose_blk_w##w(A, lda, B, ldb, r_min, c_min, r_max, c_max); \
+} \
+\
+static inline void transpose_blocked_w##w(const void* restrict A, size_t lda, \
+                                          void* restrict B, size_t ldb, \
+                                          size_t A_rows, size_t A_cols, \
+                                          size_t blk_rows, size_t blk_cols, \
+                                          int nt) \
+{ \
+    size_t r, c, r_max, c_max; \
+    for (r = 0; r < A_rows; r += blk_rows) { \
+        r_max = A_rows - r < blk_rows ? A_rows : r + blk_rows; \
+        for (c = 0; c < A_cols; c += blk_cols) { \
+            c_max = A_cols - c < blk_cols ? A_cols : c + blk_cols; \
+            if (nt) { \
+                transpose_blk_w##w##_nt(A, lda, B, ldb, r, c, r_max, c_max); \
+            } else { \
+                transpose_blk_w##w(A, lda, B, ldb, r, c, r_max, c_max); \
+            } \
+        } \
+    } \
+    if (nt) { \
+        transpose_nt_fence(); \
+    } \
+} \
+\
+static inline void transpose_blk_w##w##_perm(const void* restrict A, \
+                                             size_t lda, \
+                                             void* restrict B, size_t ldb, \
+                                             size_t r_min, size_t c_min, \
+                                             size_t r_max, size_t c_max, \
+                                             const struct transpose_perm *perm) \
+{ \
+    const transpose_w##w##_t* restrict _A = A; \
+    transpose_w##w##_t* restrict _B = B; \
+    const size_t *rows = perm->rows; \
+    size_t r, c, b_c; \
+    for (r = r_min; r < r_max; r++) { \
+        b_c = TRANSPOSE_PERM_IDX(perm->cols, r); \
+        for (c = c_min; c < c_max; c++) { \
+            _B[TRANSPOSE_PERM_IDX(rows, c) * ldb + b_c] = _A[r * lda + c]; \
+        } \
+    } \
+} \
+\
+static inline void transpose_blocked_w##w##_perm(const void* restrict A, \
+                                                 size_t lda, \
+                                                 void* restrict B, size_t ldb, \
+                                                 size_t A_rows, size_t A_cols, \
+                                                 size_t blk_rows, \
+                                                 size_t blk_cols, \
+                                                 const struct transpose_perm *perm) \
+{ \
+    size_t r, c, r_max, c_max; \
+    for (r = 0; r < A_rows; r += blk_rows) { \
+        r_max = A_rows - r < blk_rows ? A_rows : r + blk_rows; \
+        for (c = 0; c < A_cols; c += blk_cols) { \
+            c_max = A_cols - c < blk_cols ? A_cols : c + blk_cols; \
+            transpose_blk_w##w##_perm(A, lda, B, ldb, r, c, r_max, c_max, \
+                                      perm); \
+        } \
+    } \
+}
+
+TRANSPOSE_BLK_W_DEFINE(1)
+TRANSPOSE_BLK_W_DEFINE(2)
+TRANSPOSE_BLK_W_DEFINE(4)
+TRANSPOSE_BLK_W_DEFINE(8)
+TRANSPOSE_BLK_W_DEFINE(16)
+TRANSPOSE_BLK_W_DEFINE(32)
+
+#endif /* TRANSPOSE_BLK_H */
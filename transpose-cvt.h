@@ -0,0 +1,168 @@
+/**
+ * Storage formats of the precision-converting transposes, and the scalar
+ * conversions to and from them.
+ *
+ * fp16 is IEEE 754 binary16 and bf16 the upper half of a binary32, both kept
+ * as raw 16-bit patterns.  Conversions round to nearest even, like the AVX-512
+ * conversion instructions under the default MXCSR; NaNs stay (quiet) NaNs.
+ * Conversions to bf16 also flush float subnormals to a signed zero, as
+ * vcvtneps2bf16 does regardless of MXCSR, so that bf16 output is the same
+ * whether or not the CPU has AVX512_BF16.
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_CVT_H
+#define TRANSPOSE_CVT_H
+
+#include <complex.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef uint16_t transpose_fp16_t;
+typedef uint16_t transpose_bf16_t;
+
+// complex values as (re, im) pairs, like float complex
+typedef struct {
+    transpose_fp16_t re;
+    transpose_fp16_t im;
+} transpose_fp16_cmplx_t;
+
+typedef struct {
+    transpose_bf16_t re;
+    transpose_bf16_t im;
+} transpose_bf16_cmplx_t;
+
+static inline transpose_fp16_t transpose_flt_to_fp16(float f)
+{
+    uint32_t x, y;
+    uint32_t sign, ax;
+    float g;
+    memcpy(&x, &f, sizeof(x));
+    sign = (x >> 16) & 0x8000;
+    ax = x & 0x7fffffff;
+    if (ax >= 0x7f800000) {
+        // Inf stays Inf, NaN becomes a quiet NaN
+        return (transpose_fp16_t)(sign | 0x7c00 |
+                                  (ax > 0x7f800000 ?
+                                   0x200 | ((ax >> 13) & 0x3ff) : 0));
+    }
+    if (ax >= 0x477ff000) {
+        // at least 65520, which rounds to Inf
+        return (transpose_fp16_t)(sign | 0x7c00);
+    }
+    if (ax < 0x38800000) {
+        // subnormal result: adding 0.5 leaves exactly the fp16 subnormal
+        // mantissa, rounded by the FPU, in the low bits
+        memcpy(&g, &ax, sizeof(g));
+        g += 0.5f;
+        memcpy(&y, &g, sizeof(y));
+        return (transpose_fp16_t)(sign | (y - 0x3f000000));
+    }
+    // rebias the exponent and round the mantissa to nearest even
+    ax += 0xc8000fff + ((ax >> 13) & 1);
+    return (transpose_fp16_t)(sign | (ax >> 13));
+}
+
+static inline float transpose_fp16_to_flt(transpose_fp16_t h)
+{
+    uint32_t x = (uint32_t)(h & 0x7fff) << 13;
+    uint32_t exp = x & 0x0f800000;
+    float f;
+    x += (uint32_t)(127 - 15) << 23;
+    if (exp == 0x0f800000) {
+        // Inf or NaN
+        x += (uint32_t)(128 - 16) << 23;
+    } else if (exp == 0) {
+        // subnormal: renormalize through the FPU
+        const uint32_t magic = (uint32_t)113 << 23;
+        float m;
+        x += 1 << 23;
+        memcpy(&f, &x, sizeof(f));
+        memcpy(&m, &magic, sizeof(m));
+        f -= m;
+        memcpy(&x, &f, sizeof(x));
+    }
+    x |= (uint32_t)(h & 0x8000) << 16;
+    memcpy(&f, &x, sizeof(f));
+    return f;
+}
+
+static inline transpose_bf16_t transpose_flt_to_bf16(float f)
+{
+    uint32_t x;
+    memcpy(&x, &f, sizeof(x));
+    if ((x & 0x7fffffff) > 0x7f800000) {
+        return (transpose_bf16_t)((x >> 16) | 0x40);
+    }
+    if (!(x & 0x7f800000)) {
+        // zero or subnormal
+        return (transpose_bf16_t)((x >> 16) & 0x8000);
+    }
+    return (transpose_bf16_t)((x + 0x7fff + ((x >> 16) & 1)) >> 16);
+}
+
+static inline float transpose_bf16_to_flt(transpose_bf16_t b)
+{
+    uint32_t x = (uint32_t)b << 16;
+    float f;
+    memcpy(&f, &x, sizeof(f));
+    return f;
+}
+
+static inline transpose_fp16_cmplx_t
+transpose_flt_cmplx_to_fp16_cmplx(float complex v)
+{
+    transpose_fp16_cmplx_t h = {
+        transpose_flt_to_fp16(crealf(v)), transpose_flt_to_fp16(cimagf(v))
+    };
+    return h;
+}
+
+static inline float complex
+transpose_fp16_cmplx_to_flt_cmplx(transpose_fp16_cmplx_t h)
+{
+    return CMPLXF(transpose_fp16_to_flt(h.re), transpose_fp16_to_flt(h.im));
+}
+
+static inline transpose_bf16_cmplx_t
+transpose_flt_cmplx_to_bf16_cmplx(float complex v)
+{
+    transpose_bf16_cmplx_t b = {
+        transpose_flt_to_bf16(crealf(v)), transpose_flt_to_bf16(cimagf(v))
+    };
+    return b;
+}
+
+static inline float complex
+transpose_bf16_cmplx_to_flt_cmplx(transpose_bf16_cmplx_t b)
+{
+    return CMPLXF(transpose_bf16_to_flt(b.re), transpose_bf16_to_flt(b.im));
+}
+
+static inline float transpose_dbl_to_flt(double v)
+{
+    return (float)v;
+}
+
+static inline float complex transpose_dbl_cmplx_to_flt_cmplx(double complex v)
+{
+    return (float complex)v;
+}
+
+/*
+ * Convert rows [r_min, r_max) and columns [c_min, c_max) of A (row stride lda)
+ * with fn_cvt and write them transposed to B (row stride ldb).
+ */
+#define TRANSPOSE_CVT_BLK(A, lda, B, ldb, r_min, c_min, r_max, c_max, \
+                          fn_cvt) { \
+    size_t r, c; \
+    for (r = (r_min); r < (r_max); r++) { \
+        for (c = (c_min); c < (c_max); c++) { \
+            (B)[(c) * (ldb) + (r)] = fn_cvt((A)[(r) * (lda) + (c)]); \
+        } \
+    } \
+}
+
+#endif /* TRANSPOSE_CVT_H */
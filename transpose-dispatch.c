@@ -0,0 +1,236 @@
+/**
+ * Transpose functions that select the best kernel for the host at run time.
+ *
+ * Each entry point tries the kernels from the detected ISA downwards and uses
+ * the first one that supports the matrix shape, ending with the portable
+ * blocked or threaded scalar code.  The AVX-512 kernels handle any shape; the
+ * AVX2 kernels need the tile size to divide the matrix.  Matrices with only a
+ * few rows or columns, e.g., channels x samples, take the AVX-512 skinny
+ * kernels up to the size where the tile kernels catch up.
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @date 2026-10-17
+ */
+#include <complex.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+#include "cpu-features.h"
+#include "transpose.h"
+#include "transpose-avx.h"
+#include "transpose-avx2.h"
+#include "transpose-dispatch.h"
+#include "transpose-threads.h"
+#include "transpose-threads-avx.h"
+#include "transpose-threads-avx2.h"
+
+// block size for the scalar fallback
+#define DISPATCH_BLK 32
+
+static pthread_once_t isa_once = PTHREAD_ONCE_INIT;
+static enum cpu_isa isa = CPU_ISA_SCALAR;
+
+static void isa_init(void)
+{
+    const char *env = getenv("TRANSPOSE_ISA");
+    enum cpu_isa env_isa;
+    isa = cpu_isa_detect();
+    if (env) {
+        if (cpu_isa_from_name(env, &env_isa)) {
+            fprintf(stderr, "TRANSPOSE_ISA: unknown ISA: %s\n", env);
+        } else if (env_isa < isa) {
+            isa = env_isa;
+        }
+    }
+}
+
+enum cpu_isa transpose_dispatch_isa(void)
+{
+    pthread_once(&isa_once, isa_init);
+    return isa;
+}
+
+#define IS_TILED(A_rows, A_cols, blk) ((A_rows) % (blk) == 0 && (A_cols) % (blk) == 0)
+#define IS_SKINNY(A_rows, A_cols, k) ((A_rows) <= (k) || (A_cols) <= (k))
+
+// widest skinny matrices the skinny kernels beat the tile kernels on (SKX)
+#define DISPATCH_SKINNY_FLT 4
+#define DISPATCH_SKINNY_DBL 8
+#define DISPATCH_SKINNY_DBL_CMPLX 2
+
+void transpose_flt_dispatch(const float* restrict A, float* restrict B,
+                            size_t A_rows, size_t A_cols)
+{
+    switch (transpose_dispatch_isa()) {
+    case CPU_ISA_AVX512:
+        if (IS_SKINNY(A_rows, A_cols, DISPATCH_SKINNY_FLT)) {
+            transpose_flt_avx_intr_skinny(A, B, A_rows, A_cols);
+        } else {
+            transpose_flt_avx_intr_16x16(A, B, A_rows, A_cols);
+        }
+        return;
+    case CPU_ISA_AVX2:
+        if (IS_TILED(A_rows, A_cols, 8)) {
+            transpose_flt_avx2_intr_8x8(A, B, A_rows, A_cols);
+            return;
+        }
+        // fall through
+    default:
+        transpose_flt_blocked(A, B, A_rows, A_cols, DISPATCH_BLK, DISPATCH_BLK);
+    }
+}
+
+void transpose_dbl_dispatch(const double* restrict A, double* restrict B,
+                            size_t A_rows, size_t A_cols)
+{
+    switch (transpose_dispatch_isa()) {
+    case CPU_ISA_AVX512:
+        if (IS_SKINNY(A_rows, A_cols, DISPATCH_SKINNY_DBL)) {
+            transpose_dbl_avx_intr_skinny(A, B, A_rows, A_cols);
+        } else {
+            transpose_dbl_avx_intr_8x8(A, B, A_rows, A_cols);
+        }
+        return;
+    case CPU_ISA_AVX2:
+        if (IS_TILED(A_rows, A_cols, 4)) {
+            transpose_dbl_avx2_intr_4x4(A, B, A_rows, A_cols);
+            return;
+        }
+        // fall through
+    default:
+        transpose_dbl_blocked(A, B, A_rows, A_cols, DISPATCH_BLK, DISPATCH_BLK);
+    }
+}
+
+void transpose_flt_cmplx_dispatch(const float complex* restrict A,
+                                  float complex* restrict B,
+                                  size_t A_rows, size_t A_cols)
+{
+    switch (transpose_dispatch_isa()) {
+    case CPU_ISA_AVX512:
+        if (IS_SKINNY(A_rows, A_cols, DISPATCH_SKINNY_DBL)) {
+            transpose_flt_cmplx_avx_intr_skinny(A, B, A_rows, A_cols);
+        } else {
+            transpose_flt_cmplx_avx_intr_8x8(A, B, A_rows, A_cols);
+        }
+        return;
+    case CPU_ISA_AVX2:
+        // 8-byte elements, so the double kernel moves them unchanged
+        if (IS_TILED(A_rows, A_cols, 4)) {
+            transpose_dbl_avx2_intr_4x4((const double*)A, (double*)B,
+                                        A_rows, A_cols);
+            return;
+        }
+        // fall through
+    default:
+        transpose_flt_cmplx_blocked(A, B, A_rows, A_cols,
+                                    DISPATCH_BLK, DISPATCH_BLK);
+    }
+}
+
+void transpose_dbl_cmplx_dispatch(const double complex* restrict A,
+                                  double complex* restrict B,
+                                  size_t A_rows, size_t A_cols)
+{
+    switch (transpose_dispatch_isa()) {
+    case CPU_ISA_AVX512:
+        if (IS_SKINNY(A_rows, A_cols, DISPATCH_SKINNY_DBL_CMPLX)) {
+            transpose_dbl_cmplx_avx_intr_skinny(A, B, A_rows, A_cols);
+        } else {
+            transpose_dbl_cmplx_avx_intr_4x4(A, B, A_rows, A_cols);
+        }
+        return;
+    default:
+        transpose_dbl_cmplx_blocked(A, B, A_rows, A_cols,
+                                    DISPATCH_BLK, DISPATCH_BLK);
+    }
+}
+
+void transpose_flt_threads_dispatch_row(const float* restrict A,
+                                        float* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t num_thr)
+{
+    switch (transpose_dispatch_isa()) {
+    case CPU_ISA_AVX512:
+        transpose_flt_threads_avx_intr_16x16_row(A, B, A_rows, A_cols,
+                                                 num_thr);
+        return;
+    case CPU_ISA_AVX2:
+        if (IS_TILED(A_rows, A_cols, 8)) {
+            transpose_flt_threads_avx2_intr_8x8_row(A, B, A_rows, A_cols,
+                                                    num_thr);
+            return;
+        }
+        // fall through
+    default:
+        transpose_flt_threads_row(A, B, A_rows, A_cols, num_thr);
+    }
+}
+
+void transpose_dbl_threads_dispatch_row(const double* restrict A,
+                                        double* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t num_thr)
+{
+    switch (transpose_dispatch_isa()) {
+    case CPU_ISA_AVX512:
+        transpose_dbl_threads_avx_intr_8x8_row(A, B, A_rows, A_cols,
+                                               num_thr);
+        return;
+    case CPU_ISA_AVX2:
+        if (IS_TILED(A_rows, A_cols, 4)) {
+            transpose_dbl_threads_avx2_intr_4x4_row(A, B, A_rows, A_cols,
+                                                    num_thr);
+            return;
+        }
+        // fall through
+    default:
+        transpose_dbl_threads_row(A, B, A_rows, A_cols, num_thr);
+    }
+}
+
+void transpose_flt_threads_dispatch_col(const float* restrict A,
+                                        float* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t num_thr)
+{
+    switch (transpose_dispatch_isa()) {
+    case CPU_ISA_AVX512:
+        transpose_flt_threads_avx_intr_16x16_col(A, B, A_rows, A_cols,
+                                                 num_thr);
+        return;
+    case CPU_ISA_AVX2:
+        if (IS_TILED(A_rows, A_cols, 8)) {
+            transpose_flt_threads_avx2_intr_8x8_col(A, B, A_rows, A_cols,
+                                                    num_thr);
+            return;
+        }
+        // fall through
+    default:
+        transpose_flt_threads_col(A, B, A_rows, A_cols, num_thr);
+    }
+}
+
+void transpose_dbl_threads_dispatch_col(const double* restrict A,
+                                        double* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t num_thr)
+{
+    switch (transpose_dispatch_isa()) {
+    case CPU_ISA_AVX512:
+        transpose_dbl_threads_avx_intr_8x8_col(A, B, A_rows, A_cols,
+                                               num_thr);
+        return;
+    case CPU_ISA_AVX2:
+        if (IS_TILED(A_rows, A_cols, 4)) {
+            transpose_dbl_threads_avx2_intr_4x4_col(A, B, A_rows, A_cols,
+                                                    num_thr);
+            return;
+        }
+        // fall through
+    default:
+        transpose_dbl_threads_col(A, B, A_rows, A_cols, num_thr);
+    }
+}
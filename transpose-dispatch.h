@@ -0,0 +1,50 @@
+/**
+ * Transpose functions that select the best kernel for the host at run time.
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_DISPATCH_H
+#define TRANSPOSE_DISPATCH_H
+
+#include <complex.h>
+#include <stdlib.h>
+
+#include "cpu-features.h"
+
+/*
+ * The ISA is detected once, on first use.  Setting the environment variable
+ * TRANSPOSE_ISA to "scalar", "avx2" or "avx512" caps the selection, e.g., to
+ * compare kernels on the same host.
+ */
+enum cpu_isa transpose_dispatch_isa(void);
+
+void transpose_flt_dispatch(const float* restrict A, float* restrict B,
+                            size_t A_rows, size_t A_cols);
+void transpose_dbl_dispatch(const double* restrict A, double* restrict B,
+                            size_t A_rows, size_t A_cols);
+void transpose_flt_cmplx_dispatch(const float complex* restrict A,
+                                  float complex* restrict B,
+                                  size_t A_rows, size_t A_cols);
+void transpose_dbl_cmplx_dispatch(const double complex* restrict A,
+                                  double complex* restrict B,
+                                  size_t A_rows, size_t A_cols);
+
+void transpose_flt_threads_dispatch_row(const float* restrict A,
+                                        float* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t num_thr);
+void transpose_dbl_threads_dispatch_row(const double* restrict A,
+                                        double* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t num_thr);
+void transpose_flt_threads_dispatch_col(const float* restrict A,
+                                        float* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t num_thr);
+void transpose_dbl_threads_dispatch_col(const double* restrict A,
+                                        double* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t num_thr);
+
+#endif /* TRANSPOSE_DISPATCH_H */
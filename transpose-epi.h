@@ -0,0 +1,81 @@
+/**
+ * Elementwise epilogues applied by the *_epi transposes on the way through.
+ *
+ * Element (r, c) of the A_rows x A_cols matrix A leaves as element (c, r) of B:
+ *
+ *   B[c][r] = alpha * row_win[r] * col_win[c] * twiddle[r][c] * A'[r][c]
+ *
+ * where A' is A, or its conjugate when conj is set (so conj with alpha 1 is the
+ * Hermitian transpose).  The windows are real; twiddle is a complex table laid
+ * out like A, e.g., the w^(r*c) factors between the two stages of a four-step
+ * FFT.  NULL windows and tables are skipped.
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_EPI_H
+#define TRANSPOSE_EPI_H
+
+#include <complex.h>
+#include <stdlib.h>
+
+struct transpose_epi_flt_cmplx {
+    float complex alpha;
+    int conj;
+    // A_rows and A_cols entries
+    const float *row_win;
+    const float *col_win;
+    // A_rows x A_cols entries, row stride A_cols
+    const float complex *twiddle;
+};
+
+struct transpose_epi_dbl_cmplx {
+    double complex alpha;
+    int conj;
+    const double *row_win;
+    const double *col_win;
+    const double complex *twiddle;
+};
+
+/*
+ * The epilogue of element (r, c) of an A_rows x A_cols matrix, applying the
+ * factors in the same order as the AVX-512 kernels: real ones first, alpha
+ * last.
+ */
+static inline float complex
+transpose_epi_flt_cmplx_apply(const struct transpose_epi_flt_cmplx *epi,
+                              float complex a, size_t r, size_t c,
+                              size_t A_cols)
+{
+    float complex v = epi->conj ? conjf(a) : a;
+    if (epi->row_win) {
+        v *= epi->row_win[r];
+    }
+    if (epi->col_win) {
+        v *= epi->col_win[c];
+    }
+    if (epi->twiddle) {
+        v *= epi->twiddle[r * A_cols + c];
+    }
+    return v * epi->alpha;
+}
+
+static inline double complex
+transpose_epi_dbl_cmplx_apply(const struct transpose_epi_dbl_cmplx *epi,
+                              double complex a, size_t r, size_t c,
+                              size_t A_cols)
+{
+    double complex v = epi->conj ? conj(a) : a;
+    if (epi->row_win) {
+        v *= epi->row_win[r];
+    }
+    if (epi->col_win) {
+        v *= epi->col_win[c];
+    }
+    if (epi->twiddle) {
+        v *= epi->twiddle[r * A_cols + c];
+    }
+    return v * epi->alpha;
+}
+
+#endif /* TRANSPOSE_EPI_H */
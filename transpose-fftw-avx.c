@@ -0,0 +1,37 @@
+/**
+ * Transpose functions.
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @date 2026-10-17
+ */
+#include <complex.h>
+#include <stdlib.h>
+
+#include <fftw3.h>
+
+#include "transpose-avx.h"
+#include "transpose-threads-avx.h"
+#include "transpose-fftw-avx.h"
+
+void transpose_fftw_complex_avx_intr_4x4(const fftw_complex* restrict A,
+                                         fftw_complex* restrict B,
+                                         size_t A_rows, size_t A_cols)
+{
+    transpose_dbl_cmplx_avx_intr_4x4(A, B, A_rows, A_cols);
+}
+
+void transpose_fftw_complex_threads_avx_intr_4x4_row(const fftw_complex* restrict A,
+                                                     fftw_complex* restrict B,
+                                                     size_t A_rows, size_t A_cols,
+                                                     size_t num_thr)
+{
+    transpose_dbl_cmplx_threads_avx_intr_4x4_row(A, B, A_rows, A_cols, num_thr);
+}
+
+void transpose_fftw_complex_threads_avx_intr_4x4_col(const fftw_complex* restrict A,
+                                                     fftw_complex* restrict B,
+                                                     size_t A_rows, size_t A_cols,
+                                                     size_t num_thr)
+{
+    transpose_dbl_cmplx_threads_avx_intr_4x4_col(A, B, A_rows, A_cols, num_thr);
+}
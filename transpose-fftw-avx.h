@@ -0,0 +1,29 @@
+/**
+ * Transpose functions.
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_FFTW_AVX_H
+#define TRANSPOSE_FFTW_AVX_H
+
+#include <complex.h>
+#include <stdlib.h>
+
+#include <fftw3.h>
+
+void transpose_fftw_complex_avx_intr_4x4(const fftw_complex* restrict A,
+                                         fftw_complex* restrict B,
+                                         size_t A_rows, size_t A_cols);
+
+void transpose_fftw_complex_threads_avx_intr_4x4_row(const fftw_complex* restrict A,
+                                                     fftw_complex* restrict B,
+                                                     size_t A_rows, size_t A_cols,
+                                                     size_t num_thr);
+
+void transpose_fftw_complex_threads_avx_intr_4x4_col(const fftw_complex* restrict A,
+                                                     fftw_complex* restrict B,
+                                                     size_t A_rows, size_t A_cols,
+                                                     size_t num_thr);
+
+#endif /* TRANSPOSE_FFTW_AVX_H */
@@ -0,0 +1,20 @@
+/**
+ * Transpose functions.
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @date 2026-10-17
+ */
+#include <complex.h>
+#include <stdlib.h>
+
+#include <fftw3.h>
+
+#include "transpose-dispatch.h"
+#include "transpose-fftw-dispatch.h"
+
+void transpose_fftw_complex_dispatch(const fftw_complex* restrict A,
+                                     fftw_complex* restrict B,
+                                     size_t A_rows, size_t A_cols)
+{
+    transpose_dbl_cmplx_dispatch(A, B, A_rows, A_cols);
+}
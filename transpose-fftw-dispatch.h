@@ -0,0 +1,19 @@
+/**
+ * Transpose functions.
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_FFTW_DISPATCH_H
+#define TRANSPOSE_FFTW_DISPATCH_H
+
+#include <complex.h>
+#include <stdlib.h>
+
+#include <fftw3.h>
+
+void transpose_fftw_complex_dispatch(const fftw_complex* restrict A,
+                                     fftw_complex* restrict B,
+                                     size_t A_rows, size_t A_cols);
+
+#endif /* TRANSPOSE_FFTW_DISPATCH_H */
@@ -0,0 +1,20 @@
+/**
+ * Transpose functions.
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @date 2026-10-17
+ */
+#include <complex.h>
+#include <stdlib.h>
+
+#include <fftw3.h>
+
+#include "transpose-threads.h"
+#include "transpose-fftw-threads.h"
+
+void transpose_fftw_complex_threads_cycles_inplace(fftw_complex *A,
+                                                   size_t A_rows, size_t A_cols,
+                                                   size_t num_thr)
+{
+    transpose_dbl_cmplx_threads_cycles_inplace(A, A_rows, A_cols, num_thr);
+}
@@ -0,0 +1,19 @@
+/**
+ * Transpose functions.
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_FFTW_THREADS_H
+#define TRANSPOSE_FFTW_THREADS_H
+
+#include <complex.h>
+#include <stdlib.h>
+
+#include <fftw3.h>
+
+void transpose_fftw_complex_threads_cycles_inplace(fftw_complex *A,
+                                                   size_t A_rows, size_t A_cols,
+                                                   size_t num_thr);
+
+#endif /* TRANSPOSE_FFTW_THREADS_H */
@@ -26,3 +26,9 @@ void transpose_fftw_complex_blocked(const fftw_complex* restrict A,
 {
     transpose_dbl_cmplx_blocked(A, B, A_rows, A_cols, blk_rows, blk_cols);
 }
+
+void transpose_fftw_complex_cycles_inplace(fftw_complex *A,
+                                           size_t A_rows, size_t A_cols)
+{
+    transpose_dbl_cmplx_cycles_inplace(A, A_rows, A_cols);
+}
@@ -21,4 +21,7 @@ void transpose_fftw_complex_blocked(const fftw_complex* restrict A,
                                     size_t A_rows, size_t A_cols,
                                     size_t blk_rows, size_t blk_cols);
 
+void transpose_fftw_complex_cycles_inplace(fftw_complex *A,
+                                           size_t A_rows, size_t A_cols);
+
 #endif /* TRANSPOSE_FFTW_H */
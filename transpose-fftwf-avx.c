@@ -0,0 +1,37 @@
+/**
+ * Transpose functions.
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @date 2026-10-17
+ */
+#include <complex.h>
+#include <stdlib.h>
+
+#include <fftw3.h>
+
+#include "transpose-avx.h"
+#include "transpose-threads-avx.h"
+#include "transpose-fftwf-avx.h"
+
+void transpose_fftwf_complex_avx_intr_8x8(const fftwf_complex* restrict A,
+                                          fftwf_complex* restrict B,
+                                          size_t A_rows, size_t A_cols)
+{
+    transpose_flt_cmplx_avx_intr_8x8(A, B, A_rows, A_cols);
+}
+
+void transpose_fftwf_complex_threads_avx_intr_8x8_row(const fftwf_complex* restrict A,
+                                                      fftwf_complex* restrict B,
+                                                      size_t A_rows, size_t A_cols,
+                                                      size_t num_thr)
+{
+    transpose_flt_cmplx_threads_avx_intr_8x8_row(A, B, A_rows, A_cols, num_thr);
+}
+
+void transpose_fftwf_complex_threads_avx_intr_8x8_col(const fftwf_complex* restrict A,
+                                                      fftwf_complex* restrict B,
+                                                      size_t A_rows, size_t A_cols,
+                                                      size_t num_thr)
+{
+    transpose_flt_cmplx_threads_avx_intr_8x8_col(A, B, A_rows, A_cols, num_thr);
+}
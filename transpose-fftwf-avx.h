@@ -0,0 +1,29 @@
+/**
+ * Transpose functions.
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_FFTWF_AVX_H
+#define TRANSPOSE_FFTWF_AVX_H
+
+#include <complex.h>
+#include <stdlib.h>
+
+#include <fftw3.h>
+
+void transpose_fftwf_complex_avx_intr_8x8(const fftwf_complex* restrict A,
+                                          fftwf_complex* restrict B,
+                                          size_t A_rows, size_t A_cols);
+
+void transpose_fftwf_complex_threads_avx_intr_8x8_row(const fftwf_complex* restrict A,
+                                                      fftwf_complex* restrict B,
+                                                      size_t A_rows, size_t A_cols,
+                                                      size_t num_thr);
+
+void transpose_fftwf_complex_threads_avx_intr_8x8_col(const fftwf_complex* restrict A,
+                                                      fftwf_complex* restrict B,
+                                                      size_t A_rows, size_t A_cols,
+                                                      size_t num_thr);
+
+#endif /* TRANSPOSE_FFTWF_AVX_H */
@@ -0,0 +1,19 @@
+/**
+ * Transpose functions.
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_FFTWF_DISPATCH_H
+#define TRANSPOSE_FFTWF_DISPATCH_H
+
+#include <complex.h>
+#include <stdlib.h>
+
+#include <fftw3.h>
+
+void transpose_fftwf_complex_dispatch(const fftwf_complex* restrict A,
+                                      fftwf_complex* restrict B,
+                                      size_t A_rows, size_t A_cols);
+
+#endif /* TRANSPOSE_FFTWF_DISPATCH_H */
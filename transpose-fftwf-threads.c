@@ -0,0 +1,20 @@
+/**
+ * Transpose functions.
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @date 2026-10-17
+ */
+#include <complex.h>
+#include <stdlib.h>
+
+#include <fftw3.h>
+
+#include "transpose-threads.h"
+#include "transpose-fftwf-threads.h"
+
+void transpose_fftwf_complex_threads_cycles_inplace(fftwf_complex *A,
+                                                    size_t A_rows, size_t A_cols,
+                                                    size_t num_thr)
+{
+    transpose_flt_cmplx_threads_cycles_inplace(A, A_rows, A_cols, num_thr);
+}
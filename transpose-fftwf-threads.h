@@ -0,0 +1,19 @@
+/**
+ * Transpose functions.
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_FFTWF_THREADS_H
+#define TRANSPOSE_FFTWF_THREADS_H
+
+#include <complex.h>
+#include <stdlib.h>
+
+#include <fftw3.h>
+
+void transpose_fftwf_complex_threads_cycles_inplace(fftwf_complex *A,
+                                                    size_t A_rows, size_t A_cols,
+                                                    size_t num_thr);
+
+#endif /* TRANSPOSE_FFTWF_THREADS_H */
@@ -26,3 +26,9 @@ void transpose_fftwf_complex_blocked(const fftwf_complex* restrict A,
 {
     transpose_flt_cmplx_blocked(A, B, A_rows, A_cols, blk_rows, blk_cols);
 }
+
+void transpose_fftwf_complex_cycles_inplace(fftwf_complex *A,
+                                            size_t A_rows, size_t A_cols)
+{
+    transpose_flt_cmplx_cycles_inplace(A, A_rows, A_cols);
+}
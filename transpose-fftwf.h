@@ -21,4 +21,7 @@ void transpose_fftwf_complex_blocked(const fftwf_complex* restrict A,
                                      size_t A_rows, size_t A_cols,
                                      size_t blk_rows, size_t blk_cols);
 
+void transpose_fftwf_complex_cycles_inplace(fftwf_complex *A,
+                                            size_t A_rows, size_t A_cols);
+
 #endif /* TRANSPOSE_FFTWF_H */
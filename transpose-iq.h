@@ -0,0 +1,86 @@
+/**
+ * Interleaved I/Q samples as delivered by the ADC front ends, and the scalar
+ * conversion to complex float used by the ingest transposes.
+ *
+ * An iq16 sample is a 16-bit I followed by a 16-bit Q.  An iq12 sample packs
+ * a 12-bit I and a 12-bit Q, both two's complement, into three bytes: read as
+ * a little-endian 24-bit word, I is in bits 0-11 and Q in bits 12-23.
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_IQ_H
+#define TRANSPOSE_IQ_H
+
+#include <complex.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+typedef struct {
+    int16_t i;
+    int16_t q;
+} transpose_iq16_t;
+
+typedef struct {
+    uint8_t b[3];
+} transpose_iq12_t;
+
+// scale factors that map the full range of each format to [-1, 1)
+#define TRANSPOSE_IQ16_FULL_SCALE (1.0f / 32768)
+#define TRANSPOSE_IQ12_FULL_SCALE (1.0f / 2048)
+
+static inline int16_t transpose_iq12_i(transpose_iq12_t v)
+{
+    int16_t i = (int16_t)(v.b[0] | (v.b[1] & 0x0f) << 8);
+    return (int16_t)(i << 4) >> 4;
+}
+
+static inline int16_t transpose_iq12_q(transpose_iq12_t v)
+{
+    int16_t q = (int16_t)(v.b[1] >> 4 | v.b[2] << 4);
+    return (int16_t)(q << 4) >> 4;
+}
+
+static inline float complex transpose_iq16_to_flt_cmplx(transpose_iq16_t v,
+                                                        float scale)
+{
+    return CMPLXF(v.i * scale, v.q * scale);
+}
+
+static inline float complex transpose_iq12_to_flt_cmplx(transpose_iq12_t v,
+                                                        float scale)
+{
+    return CMPLXF(transpose_iq12_i(v) * scale, transpose_iq12_q(v) * scale);
+}
+
+/*
+ * Convert rows [r_min, r_max) and columns [c_min, c_max) of the samples in A
+ * (row stride lda) with fn_cvt and scale, and write them transposed to B (row
+ * stride ldb).
+ */
+#define TRANSPOSE_IQ_BLK(A, lda, B, ldb, scale, r_min, c_min, r_max, c_max, \
+                         fn_cvt) { \
+    size_t r, c; \
+    for (r = (r_min); r < (r_max); r++) { \
+        for (c = (c_min); c < (c_max); c++) { \
+            (B)[(c) * (ldb) + (r)] = fn_cvt((A)[(r) * (lda) + (c)], (scale)); \
+        } \
+    } \
+}
+
+/*
+ * TRANSPOSE_IQ_BLK with streaming stores through fn_store, writing each row
+ * of B contiguously (see TRANSPOSE_BLK_LD_NT).
+ */
+#define TRANSPOSE_IQ_BLK_NT(A, lda, B, ldb, scale, r_min, c_min, r_max, c_max, \
+                            fn_cvt, fn_store) { \
+    size_t r, c; \
+    for (c = (c_min); c < (c_max); c++) { \
+        for (r = (r_min); r < (r_max); r++) { \
+            fn_store(&(B)[(c) * (ldb) + (r)], \
+                     fn_cvt((A)[(r) * (lda) + (c)], (scale))); \
+        } \
+    } \
+}
+
+#endif /* TRANSPOSE_IQ_H */
@@ -0,0 +1,49 @@
+/**
+ * Run-time choice between regular and non-temporal (streaming) stores.
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @date 2026-10-17
+ */
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cpu-features.h"
+#include "transpose-nt.h"
+
+// 0 until the first call; "always" is stored as 1 so it is never 0
+static atomic_size_t nt_threshold;
+
+static size_t nt_threshold_init(void)
+{
+    const char *env = getenv("TRANSPOSE_NT");
+    size_t llc;
+    if (env && !strcmp(env, "always")) {
+        return 1;
+    }
+    if (env && !strcmp(env, "never")) {
+        return SIZE_MAX;
+    }
+    if (env && strcmp(env, "auto")) {
+        fprintf(stderr, "TRANSPOSE_NT: unknown policy: %s\n", env);
+    }
+    llc = cpu_llc_size();
+    if (!llc) {
+        llc = TRANSPOSE_NT_LLC_DEFAULT;
+    }
+    // the input takes as much of the LLC as the output
+    return llc / 2;
+}
+
+size_t transpose_nt_threshold(void)
+{
+    size_t t = atomic_load_explicit(&nt_threshold, memory_order_relaxed);
+    if (!t) {
+        // racing threads compute the same value
+        t = nt_threshold_init();
+        atomic_store_explicit(&nt_threshold, t, memory_order_relaxed);
+    }
+    return t;
+}
@@ -0,0 +1,124 @@
+/**
+ * Run-time choice between regular and non-temporal (streaming) stores.
+ *
+ * Streaming stores bypass the caches: they pay off once the output would be
+ * evicted before anyone reads it again, and hurt when it would still be in the
+ * last-level cache.  Since a transpose reads as many bytes as it writes, the
+ * policy streams when input and output together do not fit in the LLC.
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_NT_H
+#define TRANSPOSE_NT_H
+
+#include <complex.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// assumed when the LLC size cannot be detected
+#define TRANSPOSE_NT_LLC_DEFAULT (32UL * 1024 * 1024)
+
+/*
+ * Output size in bytes above which streaming stores are used.  Detected once;
+ * the environment variable TRANSPOSE_NT set to "always" or "never" overrides
+ * the LLC-based default ("auto").
+ */
+size_t transpose_nt_threshold(void);
+
+static inline int transpose_nt_use(size_t out_bytes)
+{
+    return out_bytes > transpose_nt_threshold();
+}
+
+/*
+ * Scalar streaming stores (movnti) for the portable kernels.  Without SSE2 they
+ * are regular stores.
+ */
+static inline void transpose_nt_store_flt(float *p, float v)
+{
+#if defined(__SSE2__)
+    int i;
+    memcpy(&i, &v, sizeof(i));
+    _mm_stream_si32((int *)p, i);
+#else
+    *p = v;
+#endif
+}
+
+static inline void transpose_nt_store_dbl(double *p, double v)
+{
+#if defined(__SSE2__) && defined(__x86_64__)
+    long long i;
+    memcpy(&i, &v, sizeof(i));
+    _mm_stream_si64((long long *)p, i);
+#else
+    *p = v;
+#endif
+}
+
+static inline void transpose_nt_store_flt_cmplx(float complex *p,
+                                                float complex v)
+{
+#if defined(__SSE2__) && defined(__x86_64__)
+    long long i;
+    memcpy(&i, &v, sizeof(i));
+    _mm_stream_si64((long long *)p, i);
+#else
+    *p = v;
+#endif
+}
+
+static inline void transpose_nt_store_dbl_cmplx(double complex *p,
+                                                double complex v)
+{
+    transpose_nt_store_dbl((double *)p, creal(v));
+    transpose_nt_store_dbl((double *)p + 1, cimag(v));
+}
+
+/*
+ * Copy bytes from src to dst, writing the cache lines of dst that are covered
+ * completely with streaming stores and the partial lines at either end with
+ * regular ones.  src needs no particular alignment.
+ */
+static inline void transpose_nt_copy(void *dst, const void *src, size_t bytes)
+{
+#if defined(__SSE2__)
+    char *d = (char *)dst;
+    const char *s = (const char *)src;
+    size_t head = (64 - (uintptr_t)d % 64) % 64;
+    size_t i;
+    if (head > bytes) {
+        head = bytes;
+    }
+    memcpy(d, s, head);
+    for (i = head; i + 64 <= bytes; i += 64) {
+        _mm_stream_si128((__m128i *)&d[i],
+                         _mm_loadu_si128((const __m128i *)&s[i]));
+        _mm_stream_si128((__m128i *)&d[i + 16],
+                         _mm_loadu_si128((const __m128i *)&s[i + 16]));
+        _mm_stream_si128((__m128i *)&d[i + 32],
+                         _mm_loadu_si128((const __m128i *)&s[i + 32]));
+        _mm_stream_si128((__m128i *)&d[i + 48],
+                         _mm_loadu_si128((const __m128i *)&s[i + 48]));
+    }
+    memcpy(&d[i], &s[i], bytes - i);
+#else
+    memcpy(dst, src, bytes);
+#endif
+}
+
+// order streaming stores before anything that follows, e.g., a thread exit
+static inline void transpose_nt_fence(void)
+{
+#if defined(__SSE2__)
+    _mm_sfence();
+#endif
+}
+
+#endif /* TRANSPOSE_NT_H */
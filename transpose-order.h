@@ -0,0 +1,157 @@
+/**
+ * Tile traversal orders shared by the scalar, AVX-512 and threaded transposes.
+ *
+ * A tile function transposes rows [r_min, r_max) and columns [c_min, c_max) of
+ * A (row stride lda) into B (row stride ldb).  The traversals below only
+ * decide the order in which tiles are visited, so no block size has to be
+ * tuned for a particular cache.
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_ORDER_H
+#define TRANSPOSE_ORDER_H
+
+#include <stdlib.h>
+
+/*
+ * Base tile edge lengths, about 4 KiB of input per tile.  They are multiples of
+ * the AVX-512 register tiles, so only edge tiles need masking.
+ */
+#define TRANSPOSE_TILE_FLT 32
+#define TRANSPOSE_TILE_DBL 32
+#define TRANSPOSE_TILE_FLT_CMPLX 32
+#define TRANSPOSE_TILE_DBL_CMPLX 16
+
+typedef void (fn_transpose_tile)(const void* restrict A, size_t lda,
+                                 void* restrict B, size_t ldb,
+                                 size_t r_min, size_t r_max,
+                                 size_t c_min, size_t c_max);
+
+/*
+ * Pick the split point of an extent of n > base elements starting at min: the
+ * first half gets about half of the whole base-sized tiles, so every leaf
+ * except those at the bottom and right edges is a full base x base tile.
+ */
+static inline size_t transpose_recursive_mid(size_t min, size_t n, size_t base)
+{
+    return min + (n / base + 1) / 2 * base;
+}
+
+/*
+ * Cache-oblivious transpose: halve the larger dimension until the sub-matrix
+ * fits in a base x base tile.  Each level halves the working set, so some level
+ * fits every cache size without tuning.
+ */
+static inline void transpose_recursive_tiles(const void* restrict A, size_t lda,
+                                             void* restrict B, size_t ldb,
+                                             size_t r_min, size_t r_max,
+                                             size_t c_min, size_t c_max,
+                                             size_t base,
+                                             fn_transpose_tile *fn_tile)
+{
+    size_t rows = r_max - r_min;
+    size_t cols = c_max - c_min;
+    size_t mid;
+    if (rows <= base && cols <= base) {
+        fn_tile(A, lda, B, ldb, r_min, r_max, c_min, c_max);
+    } else if (rows >= cols) {
+        mid = transpose_recursive_mid(r_min, rows, base);
+        transpose_recursive_tiles(A, lda, B, ldb, r_min, mid, c_min, c_max,
+                                  base, fn_tile);
+        transpose_recursive_tiles(A, lda, B, ldb, mid, r_max, c_min, c_max,
+                                  base, fn_tile);
+    } else {
+        mid = transpose_recursive_mid(c_min, cols, base);
+        transpose_recursive_tiles(A, lda, B, ldb, r_min, r_max, c_min, mid,
+                                  base, fn_tile);
+        transpose_recursive_tiles(A, lda, B, ldb, r_min, r_max, mid, c_max,
+                                  base, fn_tile);
+    }
+}
+
+/*
+ * Two-level blocking of rows [r_min, r_max) and columns [c_min, c_max): outer
+ * blk_rows x blk_cols tiles bound the pages in use at once, which is about
+ * blk_rows pages of A plus blk_cols pages of B for wide matrices, so their sum
+ * should stay within the DTLB.  Each outer tile is cut into sub_rows x sub_cols
+ * micro-tiles that fit in registers or L1 and are handed to fn_tile.
+ */
+static inline void transpose_blocked2_tiles(const void* restrict A, size_t lda,
+                                            void* restrict B, size_t ldb,
+                                            size_t r_min, size_t r_max,
+                                            size_t c_min, size_t c_max,
+                                            size_t blk_rows, size_t blk_cols,
+                                            size_t sub_rows, size_t sub_cols,
+                                            fn_transpose_tile *fn_tile)
+{
+    size_t rb, cb, rb_max, cb_max, r, c;
+    for (rb = r_min; rb < r_max; rb += blk_rows) {
+        rb_max = r_max - rb < blk_rows ? r_max : rb + blk_rows;
+        for (cb = c_min; cb < c_max; cb += blk_cols) {
+            cb_max = c_max - cb < blk_cols ? c_max : cb + blk_cols;
+            for (r = rb; r < rb_max; r += sub_rows) {
+                for (c = cb; c < cb_max; c += sub_cols) {
+                    fn_tile(A, lda, B, ldb,
+                            r, rb_max - r < sub_rows ? rb_max : r + sub_rows,
+                            c, cb_max - c < sub_cols ? cb_max : c + sub_cols);
+                }
+            }
+        }
+    }
+}
+
+/*
+ * Gather the even bits of z into the low half, i.e., one coordinate of a
+ * Morton (Z-order) index.
+ */
+static inline size_t morton_compact(size_t z)
+{
+    unsigned long long x = z & 0x5555555555555555ULL;
+    x = (x | (x >> 1)) & 0x3333333333333333ULL;
+    x = (x | (x >> 2)) & 0x0f0f0f0f0f0f0f0fULL;
+    x = (x | (x >> 4)) & 0x00ff00ff00ff00ffULL;
+    x = (x | (x >> 8)) & 0x0000ffff0000ffffULL;
+    x = (x | (x >> 16)) & 0x00000000ffffffffULL;
+    return (size_t)x;
+}
+
+/*
+ * Visit the base x base tiles of an A_rows x A_cols matrix in Morton order.
+ * The tile grid is cut into squares of s x s tiles, s being the shorter tile
+ * dimension rounded up to a power of two, so a long, thin matrix does not walk
+ * a mostly empty Z curve; tiles past the matrix edge are skipped.
+ */
+static inline void transpose_morton_tiles(const void* restrict A, size_t lda,
+                                          void* restrict B, size_t ldb,
+                                          size_t A_rows, size_t A_cols,
+                                          size_t base,
+                                          fn_transpose_tile *fn_tile)
+{
+    const size_t nt_r = (A_rows + base - 1) / base;
+    const size_t nt_c = (A_cols + base - 1) / base;
+    const size_t nt_min = nt_r < nt_c ? nt_r : nt_c;
+    size_t s, sq, z, ti, tj, r_min, c_min;
+    for (s = 1; s < nt_min; s *= 2);
+    for (sq = 0; sq * s < (nt_r > nt_c ? nt_r : nt_c); sq++) {
+        for (z = 0; z < s * s; z++) {
+            ti = morton_compact(z >> 1);
+            tj = morton_compact(z);
+            if (nt_r > nt_c) {
+                ti += sq * s;
+            } else {
+                tj += sq * s;
+            }
+            if (ti >= nt_r || tj >= nt_c) {
+                continue;
+            }
+            r_min = ti * base;
+            c_min = tj * base;
+            fn_tile(A, lda, B, ldb, r_min,
+                    A_rows - r_min < base ? A_rows : r_min + base,
+                    c_min, A_cols - c_min < base ? A_cols : c_min + base);
+        }
+    }
+}
+
+#endif /* TRANSPOSE_ORDER_H */
@@ -0,0 +1,146 @@
+/**
+ * Output permutations applied by the *_perm transposes while writing B.
+ *
+ * Element (r, c) of the A_rows x A_cols matrix A leaves as element
+ *
+ *   B[rows[c]][cols[r]]
+ *
+ * so rows permutes the rows of B and cols its columns.  Either table may be
+ * NULL, which leaves that dimension in order.  The builders below fill the
+ * tables for the common cases: circular shifts (fftshift moves the zero
+ * frequency bin to the middle, ifftshift undoes it) and bit-reversal.
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_PERM_H
+#define TRANSPOSE_PERM_H
+
+#include <stdlib.h>
+#include <string.h>
+
+struct transpose_perm {
+    // row of B for each column of A (A_cols entries)
+    const size_t *rows;
+    // column of B for each row of A (A_rows entries)
+    const size_t *cols;
+};
+
+// entry i of table p, or i itself when there is no table
+#define TRANSPOSE_PERM_IDX(p, i) ((p) ? (p)[i] : (i))
+
+// p[i] = (i + shift) mod n
+static inline void transpose_perm_shift(size_t *p, size_t n, size_t shift)
+{
+    size_t i;
+    shift %= n;
+    for (i = 0; i < n; i++) {
+        p[i] = i < n - shift ? i + shift : i + shift - n;
+    }
+}
+
+static inline void transpose_perm_fftshift(size_t *p, size_t n)
+{
+    transpose_perm_shift(p, n, n / 2);
+}
+
+static inline void transpose_perm_ifftshift(size_t *p, size_t n)
+{
+    transpose_perm_shift(p, n, n - n / 2);
+}
+
+// bit-reversal of the log2(n) index bits; fails unless n is a power of two
+static inline int transpose_perm_bitrev(size_t *p, size_t n)
+{
+    size_t i, j, bit;
+    if (!n || (n & (n - 1))) {
+        return -1;
+    }
+    for (i = 0, j = 0; i < n; i++) {
+        p[i] = j;
+        // increment j with the carry running from the top bit down
+        for (bit = n >> 1; bit && (j & bit); bit >>= 1) {
+            j ^= bit;
+        }
+        j |= bit;
+    }
+    return 0;
+}
+
+// inv[p[i]] = i
+static inline void transpose_perm_invert(size_t *inv, const size_t *p,
+                                         size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++) {
+        inv[p[i]] = i;
+    }
+}
+
+/*
+ * The gather form of perm used by the SIMD transposes: src[j] is the row of A
+ * that lands in column j of B (A_rows entries) and dst[c] the row of B that
+ * column c of A lands in (A_cols entries).  Building them takes a pass over
+ * both tables, so a caller reusing perm builds them once and passes them to
+ * the *_perm_tables transposes (see transpose-avx.h).
+ */
+static inline void transpose_perm_tables(const struct transpose_perm *perm,
+                                         size_t A_rows, size_t A_cols,
+                                         size_t *src, size_t *dst)
+{
+    size_t i;
+    if (perm->cols) {
+        transpose_perm_invert(src, perm->cols, A_rows);
+    } else {
+        for (i = 0; i < A_rows; i++) {
+            src[i] = i;
+        }
+    }
+    if (perm->rows) {
+        memcpy(dst, perm->rows, A_cols * sizeof(*dst));
+    } else {
+        for (i = 0; i < A_cols; i++) {
+            dst[i] = i;
+        }
+    }
+}
+
+/*
+ * Fill p with the permutation of n entries called name: "fftshift",
+ * "ifftshift", "bitrev", "rand" (a random table, e.g., for testing) or a
+ * signed integer circular shift.
+ */
+static inline int transpose_perm_from_name(size_t *p, size_t n,
+                                           const char *name)
+{
+    char *end;
+    long shift;
+    size_t i, j, t;
+    if (!strcmp(name, "fftshift")) {
+        transpose_perm_fftshift(p, n);
+    } else if (!strcmp(name, "ifftshift")) {
+        transpose_perm_ifftshift(p, n);
+    } else if (!strcmp(name, "bitrev")) {
+        return transpose_perm_bitrev(p, n);
+    } else if (!strcmp(name, "rand")) {
+        for (i = 0; i < n; i++) {
+            p[i] = i;
+        }
+        for (i = n; i > 1; i--) {
+            j = (size_t)rand() % i;
+            t = p[i - 1];
+            p[i - 1] = p[j];
+            p[j] = t;
+        }
+    } else {
+        shift = strtol(name, &end, 0);
+        if (end == name || *end != '\0') {
+            return -1;
+        }
+        transpose_perm_shift(p, n, shift < 0 ? n - (size_t)-shift % n
+                                             : (size_t)shift);
+    }
+    return 0;
+}
+
+#endif /* TRANSPOSE_PERM_H */
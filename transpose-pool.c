@@ -0,0 +1,218 @@
+/**
+ * Persistent worker threads for the threaded transposes.
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @date 2026-10-17
+ */
+// for _SC_NPROCESSORS_ONLN
+#define _GNU_SOURCE
+#include <errno.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "transpose-pool.h"
+#include "util.h"
+
+static struct {
+    // held from transpose_pool_begin() to the end of transpose_pool_run()
+    pthread_mutex_t call_lock;
+    // protects the sleeps on wake and done
+    pthread_mutex_t lock;
+    pthread_cond_t wake, done;
+    // a count bumped once per call above the call's thread count; a worker
+    // takes part in a call when it sees a new value whose count includes it
+    atomic_uint_fast64_t gen;
+    // workers of the current call that have not finished yet
+    atomic_size_t pending;
+    // workers asleep on wake, and whether the caller is asleep on done
+    atomic_size_t sleeping;
+    atomic_int done_waiting;
+    // the current call, written before gen is bumped
+    void *(*start_routine)(void *);
+    char *args;
+    size_t num_thr, arg_size, args_cap;
+    // workers started so far, numbered from 1 (the caller is slot 0)
+    size_t num_workers;
+    unsigned long spin;
+    // calls on more threads than this never spin
+    size_t ncpu;
+} pool = {
+    .call_lock = PTHREAD_MUTEX_INITIALIZER,
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .wake = PTHREAD_COND_INITIALIZER,
+    .done = PTHREAD_COND_INITIALIZER,
+};
+
+// low bits of gen holding the thread count of the call
+#define POOL_THR_BITS 24
+#define POOL_THR_MASK ((UINT64_C(1) << POOL_THR_BITS) - 1)
+
+// a new worker's slot and the generation it was started in
+struct pool_start {
+    size_t id;
+    uint_fast64_t gen;
+};
+
+// spinning only pays off while every thread of the call has a CPU to itself
+static inline unsigned long pool_spin(size_t num_thr)
+{
+    return num_thr <= pool.ncpu ? pool.spin : 0;
+}
+
+static inline void cpu_relax(void)
+{
+#if defined(__SSE2__)
+    _mm_pause();
+#endif
+}
+
+static void *pool_worker(void *arg)
+{
+    struct pool_start *start = (struct pool_start *)arg;
+    const size_t id = start->id;
+    uint_fast64_t seen = start->gen, gen;
+    unsigned long spins, spin;
+    free(start);
+
+    for (;;) {
+        // spin, then sleep until the next call, the last one being a hint of
+        // how busy the CPUs are
+        spin = pool_spin(seen & POOL_THR_MASK);
+        for (spins = 0; (gen = atomic_load(&pool.gen)) == seen; spins++) {
+            if (spins < spin) {
+                cpu_relax();
+                continue;
+            }
+            pthread_mutex_lock(&pool.lock);
+            atomic_fetch_add(&pool.sleeping, 1);
+            while ((gen = atomic_load(&pool.gen)) == seen) {
+                pthread_cond_wait(&pool.wake, &pool.lock);
+            }
+            atomic_fetch_sub(&pool.sleeping, 1);
+            pthread_mutex_unlock(&pool.lock);
+            break;
+        }
+        seen = gen;
+        // calls on fewer threads leave the higher slots idle; they are not
+        // waited for, so must not look at anything else of the call
+        if (id >= (gen & POOL_THR_MASK)) {
+            continue;
+        }
+        pool.start_routine(&pool.args[id * pool.arg_size]);
+        if (atomic_fetch_sub(&pool.pending, 1) == 1 &&
+            atomic_load(&pool.done_waiting)) {
+            pthread_mutex_lock(&pool.lock);
+            pthread_cond_signal(&pool.done);
+            pthread_mutex_unlock(&pool.lock);
+        }
+    }
+    return NULL;
+}
+
+static void pool_spin_init(void)
+{
+    const char *env = getenv("TRANSPOSE_POOL_SPIN");
+    const long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+    char *end;
+    pool.ncpu = ncpu > 0 ? (size_t)ncpu : 1;
+    pool.spin = TRANSPOSE_POOL_SPIN_DEFAULT;
+    if (env) {
+        pool.spin = strtoul(env, &end, 0);
+        if (end == env || *end != '\0') {
+            fprintf(stderr, "TRANSPOSE_POOL_SPIN: bad count: %s\n", env);
+            pool.spin = TRANSPOSE_POOL_SPIN_DEFAULT;
+        }
+    }
+}
+
+static void pool_grow(size_t num_workers)
+{
+    pthread_attr_t attr;
+    pthread_t thread;
+    struct pool_start *start;
+
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    while (pool.num_workers < num_workers) {
+        start = assert_malloc(sizeof(*start));
+        start->id = pool.num_workers + 1;
+        start->gen = atomic_load(&pool.gen);
+        errno = pthread_create(&thread, &attr, pool_worker, start);
+        if (errno) {
+            perror("pthread_create");
+            exit(errno);
+        }
+        pool.num_workers++;
+    }
+    pthread_attr_destroy(&attr);
+}
+
+void *transpose_pool_begin(size_t num_thr, size_t arg_size)
+{
+    static pthread_once_t spin_once = PTHREAD_ONCE_INIT;
+    pthread_once(&spin_once, pool_spin_init);
+
+    if (num_thr > POOL_THR_MASK) {
+        fprintf(stderr, "transpose_pool_begin: too many threads: %zu\n",
+                num_thr);
+        exit(EINVAL);
+    }
+    pthread_mutex_lock(&pool.call_lock);
+    if (num_thr > pool.num_workers + 1) {
+        pool_grow(num_thr - 1);
+    }
+    if (num_thr * arg_size > pool.args_cap) {
+        free(pool.args);
+        pool.args_cap = num_thr * arg_size;
+        pool.args = assert_malloc(pool.args_cap);
+    }
+    pool.num_thr = num_thr;
+    pool.arg_size = arg_size;
+    return pool.args;
+}
+
+void transpose_pool_run(void *(*start_routine)(void *))
+{
+    const unsigned long spin = pool_spin(pool.num_thr);
+    uint_fast64_t gen;
+    unsigned long spins;
+
+    if (pool.num_thr > 1) {
+        pool.start_routine = start_routine;
+        atomic_store(&pool.pending, pool.num_thr - 1);
+        gen = (atomic_load(&pool.gen) >> POOL_THR_BITS) + 1;
+        atomic_store(&pool.gen, gen << POOL_THR_BITS | pool.num_thr);
+        if (atomic_load(&pool.sleeping)) {
+            pthread_mutex_lock(&pool.lock);
+            pthread_cond_broadcast(&pool.wake);
+            pthread_mutex_unlock(&pool.lock);
+        }
+    }
+
+    start_routine(pool.args);
+
+    // spin, then sleep until the workers are done
+    for (spins = 0; atomic_load(&pool.pending); spins++) {
+        if (spins < spin) {
+            cpu_relax();
+            continue;
+        }
+        pthread_mutex_lock(&pool.lock);
+        atomic_store(&pool.done_waiting, 1);
+        while (atomic_load(&pool.pending)) {
+            pthread_cond_wait(&pool.done, &pool.lock);
+        }
+        atomic_store(&pool.done_waiting, 0);
+        pthread_mutex_unlock(&pool.lock);
+        break;
+    }
+    pthread_mutex_unlock(&pool.call_lock);
+}
@@ -0,0 +1,49 @@
+/**
+ * Persistent worker threads for the threaded transposes.
+ *
+ * Creating and joining a thread per call costs tens of microseconds each,
+ * which dominates small and medium transposes.  Instead, the pool starts its
+ * workers on first use and keeps them waiting between calls: a worker spins
+ * for a while, so back-to-back calls wake it within a microsecond or so, then
+ * sleeps on a condition variable so an idle pool costs no CPU.  Calls on more
+ * threads than there are online CPUs sleep right away, since a spinning thread
+ * would hold up the others.  The calling thread runs the first slot itself.
+ *
+ * A call looks like:
+ *
+ *   struct tr_thread_arg *args = transpose_pool_begin(num_thr, sizeof(*args));
+ *   // fill in args[0] .. args[num_thr - 1]
+ *   transpose_pool_run(start_routine);
+ *
+ * The argument slots belong to the pool and are only reallocated when a call
+ * needs more of them.  Calls from different threads take turns; a routine
+ * running on the pool must not call into the pool itself.
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_POOL_H
+#define TRANSPOSE_POOL_H
+
+#include <stdlib.h>
+
+/*
+ * Busy-wait iterations before a waiting thread goes to sleep.  The environment
+ * variable TRANSPOSE_POOL_SPIN overrides it, e.g., 0 to always sleep on a
+ * shared host.
+ */
+#define TRANSPOSE_POOL_SPIN_DEFAULT 20000
+
+/*
+ * Lock the pool for a call on num_thr threads (including the caller) and return
+ * num_thr argument slots of arg_size bytes each.
+ */
+void *transpose_pool_begin(size_t num_thr, size_t arg_size);
+
+/*
+ * Run start_routine on each argument slot, slot 0 on the calling thread, wait
+ * for all of them and unlock the pool.
+ */
+void transpose_pool_run(void *(*start_routine)(void *));
+
+#endif /* TRANSPOSE_POOL_H */
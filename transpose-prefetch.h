@@ -0,0 +1,134 @@
+/**
+ * Software prefetching for the blocked and AVX-512 transposes.
+ *
+ * While one tile is transposed, the source rows and destination lines of the
+ * tile pf_dist tiles further along the traversal are prefetched, so they are
+ * (ideally) in cache by the time the loop reaches them.
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_PREFETCH_H
+#define TRANSPOSE_PREFETCH_H
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "transpose-order.h"
+
+#define TRANSPOSE_PF_LINE 64
+
+enum transpose_pf_hint {
+    // prefetcht0: source and destination into all cache levels
+    TRANSPOSE_PF_T0 = 0,
+    // prefetchnta: bypass the outer caches as far as the CPU allows
+    TRANSPOSE_PF_NTA,
+    // prefetcht0 for the source, prefetchw (exclusive) for the destination
+    TRANSPOSE_PF_W,
+};
+
+static inline int transpose_pf_hint_from_name(const char *name,
+                                              enum transpose_pf_hint *hint)
+{
+    if (!strcmp(name, "t0")) {
+        *hint = TRANSPOSE_PF_T0;
+    } else if (!strcmp(name, "nta")) {
+        *hint = TRANSPOSE_PF_NTA;
+    } else if (!strcmp(name, "w")) {
+        *hint = TRANSPOSE_PF_W;
+    } else {
+        return -1;
+    }
+    return 0;
+}
+
+// __builtin_prefetch needs compile-time constant arguments, hence the branches
+#if defined(__GNUC__)
+#define TRANSPOSE_PF_READ(p, hint) \
+    ((hint) == TRANSPOSE_PF_NTA ? __builtin_prefetch((p), 0, 0) : \
+                                  __builtin_prefetch((p), 0, 3))
+#define TRANSPOSE_PF_WRITE(p, hint) \
+    ((hint) == TRANSPOSE_PF_NTA ? __builtin_prefetch((p), 0, 0) : \
+     (hint) == TRANSPOSE_PF_W ? __builtin_prefetch((p), 1, 3) : \
+                                __builtin_prefetch((p), 0, 3))
+#else
+#define TRANSPOSE_PF_READ(p, hint) ((void)(p), (void)(hint))
+#define TRANSPOSE_PF_WRITE(p, hint) ((void)(p), (void)(hint))
+#endif
+
+/*
+ * Prefetch rows [r_min, r_max), columns [c_min, c_max) of A (row stride lda)
+ * and the lines of B (row stride ldb) they will be written to.  size is the
+ * element size in bytes.
+ */
+static inline void transpose_prefetch_tile(const void *A, size_t lda,
+                                           const void *B, size_t ldb,
+                                           size_t size,
+                                           size_t r_min, size_t r_max,
+                                           size_t c_min, size_t c_max,
+                                           enum transpose_pf_hint hint)
+{
+    const char *a = (const char *)A;
+    const char *b = (const char *)B;
+    size_t r, c, off;
+    for (r = r_min; r < r_max; r++) {
+        for (off = 0; off < (c_max - c_min) * size; off += TRANSPOSE_PF_LINE) {
+            TRANSPOSE_PF_READ(&a[(r * lda + c_min) * size + off], hint);
+        }
+    }
+    for (c = c_min; c < c_max; c++) {
+        for (off = 0; off < (r_max - r_min) * size; off += TRANSPOSE_PF_LINE) {
+            TRANSPOSE_PF_WRITE(&b[(c * ldb + r_min) * size + off], hint);
+        }
+    }
+}
+
+/*
+ * Blocked traversal of rows [r_min, r_max) and columns [c_min, c_max) in row
+ * major tile order, prefetching the tile pf_dist tiles ahead (pf_dist == 0
+ * disables prefetching).  The prefetch position is advanced incrementally
+ * rather than recomputed from the tile index.
+ */
+static inline void transpose_blocked_pf_tiles(const void* restrict A,
+                                              size_t lda,
+                                              void* restrict B, size_t ldb,
+                                              size_t size,
+                                              size_t r_min, size_t r_max,
+                                              size_t c_min, size_t c_max,
+                                              size_t blk_rows, size_t blk_cols,
+                                              size_t pf_dist,
+                                              enum transpose_pf_hint hint,
+                                              fn_transpose_tile *fn_tile)
+{
+    const size_t n_cblks = (c_max - c_min + blk_cols - 1) / blk_cols;
+    size_t r, c, r_end, c_end, pf_r, pf_c;
+    // a thread may be left with an empty range
+    if (!n_cblks) {
+        return;
+    }
+    pf_r = r_min + pf_dist / n_cblks * blk_rows;
+    pf_c = c_min + pf_dist % n_cblks * blk_cols;
+    for (r = r_min; r < r_max; r += blk_rows) {
+        r_end = r_max - r < blk_rows ? r_max : r + blk_rows;
+        for (c = c_min; c < c_max; c += blk_cols) {
+            c_end = c_max - c < blk_cols ? c_max : c + blk_cols;
+            if (pf_dist && pf_r < r_max) {
+                transpose_prefetch_tile(A, lda, B, ldb, size, pf_r,
+                                        r_max - pf_r < blk_rows ?
+                                            r_max : pf_r + blk_rows,
+                                        pf_c,
+                                        c_max - pf_c < blk_cols ?
+                                            c_max : pf_c + blk_cols,
+                                        hint);
+                pf_c += blk_cols;
+                if (pf_c >= c_max) {
+                    pf_c = c_min;
+                    pf_r += blk_rows;
+                }
+            }
+            fn_tile(A, lda, B, ldb, r, r_end, c, c_end);
+        }
+    }
+}
+
+#endif /* TRANSPOSE_PREFETCH_H */
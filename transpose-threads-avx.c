@@ -4,34 +4,43 @@
  * @author Kaushik Datta <kdatta@isi.edu>
  * @date 2019-08-15
  */
-#include <errno.h>
-#include <assert.h>
+#include <complex.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
-#include <pthread.h>
 
 // intrinsics
 #include <immintrin.h>
 
+#include "cpu-features.h"
 #include "transpose-threads-avx.h"
-#include "util.h"
+#include "transpose-avx-kernels.h"
+#include "transpose-nt.h"
+#include "transpose-pool.h"
 
 struct tr_thread_arg {
     const void* restrict A;
     void* restrict B;
-    size_t A_rows, A_cols, r_min, r_max, c_min, c_max, thr_num;
+    // alpha points to a scale factor of the element type, or is NULL for none;
+    // the split-complex workers take the imaginary plane through it instead,
+    // and the epilogue workers their struct transpose_epi_*
+    const void *alpha;
+    size_t lda, ldb, r_min, r_max, c_min, c_max, thr_num;
+    // elements in all of B, which decides between streaming and regular stores
+    size_t out_elems;
 };
 
 static void tt_arg_init(struct tr_thread_arg *tt_arg,
-                        const void* restrict A, void* restrict B,
-                        size_t A_rows, size_t A_cols,
+                        const void* restrict A, size_t lda,
+                        void* restrict B, size_t ldb, const void *alpha,
                         size_t r_min, size_t r_max, size_t c_min, size_t c_max,
                         size_t thr_num)
 {
     tt_arg->A = A;
     tt_arg->B = B;
-    tt_arg->A_rows = A_rows;
-    tt_arg->A_cols = A_cols;
+    tt_arg->alpha = alpha;
+    tt_arg->lda = lda;
+    tt_arg->ldb = ldb;
     tt_arg->r_min = r_min;
     tt_arg->r_max = r_max;
     tt_arg->c_min = c_min;
@@ -39,160 +48,406 @@ static void tt_arg_init(struct tr_thread_arg *tt_arg,
     tt_arg->thr_num = thr_num;
 }
 
+CPU_TARGET_AVX512
 static void *transpose_thread_blocked_dbl(void *args) {
     struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
     const double* restrict A = tt_arg->A;
     double* restrict B = tt_arg->B;
-    const double *A_block;
-    double *B_block;
-    size_t start_row_block_num, end_row_block_num, row_block_num;
-    size_t start_col_block_num, end_col_block_num, col_block_num;
-    size_t r_min, c_min;
-    // alternate the reads and writes between the r and s vector registers, all
-    // of which hold matrix rows
-    __m512d r[8], s[8];
-
-    // used for swapping 2x2 blocks using _mm512_permutex2var_pd()
-    static const __m512i idx_2x2_0 = {
-        0x0000, 0x0001, 0x0008, 0x0009, 0x0004, 0x0005, 0x000c, 0x000d
-    };
-    static const __m512i idx_2x2_1 = {
-        0x000a, 0x000b, 0x0002, 0x0003, 0x000e, 0x000f, 0x0006, 0x0007
-    };
-    // used for swapping 4x4 blocks using _mm512_permutex2var_pd()
-    static const __m512i idx_4x4_0 = {
-        0x0000, 0x0001, 0x0002, 0x0003, 0x0008, 0x0009, 0x000a, 0x000b
-    };
-    static const __m512i idx_4x4_1 = {
-        0x000c, 0x000d, 0x000e, 0x000f, 0x0004, 0x0005, 0x0006, 0x0007
-    };
-
-    assert(tt_arg->A_rows % 8 == 0);
-    assert(tt_arg->A_cols % 8 == 0);
-
-    start_row_block_num = tt_arg->r_min / 8;
-    end_row_block_num = tt_arg->r_max / 8;
-    start_col_block_num = tt_arg->c_min / 8;
-    end_col_block_num = tt_arg->c_max / 8;
-
-    for (row_block_num = start_row_block_num; row_block_num < end_row_block_num; row_block_num++) {
-        r_min = row_block_num * 8;
-        for (col_block_num = start_col_block_num; col_block_num < end_col_block_num; col_block_num++) {
-            c_min = col_block_num * 8;
-
-            A_block = &A[r_min * tt_arg->A_cols + c_min];
-            B_block = &B[c_min * tt_arg->A_rows + r_min];
-
-            // read 8x8 block of read array
-            r[0] = _mm512_load_pd(&A_block[0]);
-            r[1] = _mm512_load_pd(&A_block[tt_arg->A_cols]);
-            r[2] = _mm512_load_pd(&A_block[2*tt_arg->A_cols]);
-            r[3] = _mm512_load_pd(&A_block[3*tt_arg->A_cols]);
-            r[4] = _mm512_load_pd(&A_block[4*tt_arg->A_cols]);
-            r[5] = _mm512_load_pd(&A_block[5*tt_arg->A_cols]);
-            r[6] = _mm512_load_pd(&A_block[6*tt_arg->A_cols]);
-            r[7] = _mm512_load_pd(&A_block[7*tt_arg->A_cols]);
-
-            // shuffle doubles within 128-bit lanes
-            s[0] = _mm512_unpacklo_pd(r[0], r[1]);
-            s[1] = _mm512_unpackhi_pd(r[0], r[1]);
-            s[2] = _mm512_unpacklo_pd(r[2], r[3]);
-            s[3] = _mm512_unpackhi_pd(r[2], r[3]);
-            s[4] = _mm512_unpacklo_pd(r[4], r[5]);
-            s[5] = _mm512_unpackhi_pd(r[4], r[5]);
-            s[6] = _mm512_unpacklo_pd(r[6], r[7]);
-            s[7] = _mm512_unpackhi_pd(r[6], r[7]);
-
-            // shuffle 2x2 blocks of doubles
-            r[0] = _mm512_permutex2var_pd(s[0], idx_2x2_0, s[2]);
-            r[1] = _mm512_permutex2var_pd(s[1], idx_2x2_0, s[3]);
-            r[2] = _mm512_permutex2var_pd(s[2], idx_2x2_1, s[0]);
-            r[3] = _mm512_permutex2var_pd(s[3], idx_2x2_1, s[1]);
-            r[4] = _mm512_permutex2var_pd(s[4], idx_2x2_0, s[6]);
-            r[5] = _mm512_permutex2var_pd(s[5], idx_2x2_0, s[7]);
-            r[6] = _mm512_permutex2var_pd(s[6], idx_2x2_1, s[4]);
-            r[7] = _mm512_permutex2var_pd(s[7], idx_2x2_1, s[5]);
-
-            // shuffle 4x4 blocks of doubles
-            s[0] = _mm512_permutex2var_pd(r[0], idx_4x4_0, r[4]);
-            s[1] = _mm512_permutex2var_pd(r[1], idx_4x4_0, r[5]);
-            s[2] = _mm512_permutex2var_pd(r[2], idx_4x4_0, r[6]);
-            s[3] = _mm512_permutex2var_pd(r[3], idx_4x4_0, r[7]);
-            s[4] = _mm512_permutex2var_pd(r[4], idx_4x4_1, r[0]);
-            s[5] = _mm512_permutex2var_pd(r[5], idx_4x4_1, r[1]);
-            s[6] = _mm512_permutex2var_pd(r[6], idx_4x4_1, r[2]);
-            s[7] = _mm512_permutex2var_pd(r[7], idx_4x4_1, r[3]);
-
-            // write back 8x8 block of write array
-#if defined(USE_AVX_STREAMING_STORES)
-            _mm512_stream_pd(&B_block[0], s[0]);
-            _mm512_stream_pd(&B_block[tt_arg->A_rows], s[1]);
-            _mm512_stream_pd(&B_block[2*tt_arg->A_rows], s[2]);
-            _mm512_stream_pd(&B_block[3*tt_arg->A_rows], s[3]);
-            _mm512_stream_pd(&B_block[4*tt_arg->A_rows], s[4]);
-            _mm512_stream_pd(&B_block[5*tt_arg->A_rows], s[5]);
-            _mm512_stream_pd(&B_block[6*tt_arg->A_rows], s[6]);
-            _mm512_stream_pd(&B_block[7*tt_arg->A_rows], s[7]);
+    const int nt = transpose_nt_use(tt_arg->out_elems * sizeof(*B));
+
+    if (tt_arg->alpha) {
+        TRANSPOSE_AVX_INTR_TILES_NT(A, tt_arg->lda, B, tt_arg->ldb,
+                                    tt_arg->r_min, tt_arg->r_max,
+                                    tt_arg->c_min, tt_arg->c_max, 8,
+                                    (const double *)tt_arg->alpha, nt,
+                                    transpose_dbl_avx_intr_8x8_blk,
+                                    transpose_dbl_avx_intr_8x8_blk_nt,
+                                    transpose_dbl_avx_intr_8x8_blk_part);
+    } else {
+        TRANSPOSE_AVX_INTR_TILES_NT(A, tt_arg->lda, B, tt_arg->ldb,
+                                    tt_arg->r_min, tt_arg->r_max,
+                                    tt_arg->c_min, tt_arg->c_max, 8,
+                                    NULL, nt,
+                                    transpose_dbl_avx_intr_8x8_blk,
+                                    transpose_dbl_avx_intr_8x8_blk_nt,
+                                    transpose_dbl_avx_intr_8x8_blk_part);
+    }
+
+    return (void *)tt_arg->thr_num;
+}
+
+CPU_TARGET_AVX512
+static void *transpose_thread_blocked_flt(void *args) {
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    const float* restrict A = tt_arg->A;
+    float* restrict B = tt_arg->B;
+    const int nt = transpose_nt_use(tt_arg->out_elems * sizeof(*B));
+
+    if (tt_arg->alpha) {
+        TRANSPOSE_AVX_INTR_TILES_NT(A, tt_arg->lda, B, tt_arg->ldb,
+                                    tt_arg->r_min, tt_arg->r_max,
+                                    tt_arg->c_min, tt_arg->c_max, 16,
+                                    (const float *)tt_arg->alpha, nt,
+                                    transpose_flt_avx_intr_16x16_blk,
+                                    transpose_flt_avx_intr_16x16_blk_nt,
+                                    transpose_flt_avx_intr_16x16_blk_part);
+    } else {
+        TRANSPOSE_AVX_INTR_TILES_NT(A, tt_arg->lda, B, tt_arg->ldb,
+                                    tt_arg->r_min, tt_arg->r_max,
+                                    tt_arg->c_min, tt_arg->c_max, 16,
+                                    NULL, nt,
+                                    transpose_flt_avx_intr_16x16_blk,
+                                    transpose_flt_avx_intr_16x16_blk_nt,
+                                    transpose_flt_avx_intr_16x16_blk_part);
+    }
+
+    return (void *)tt_arg->thr_num;
+}
+
+CPU_TARGET_AVX512
+static void *transpose_thread_blocked_flt_cmplx(void *args) {
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    const float complex* restrict A = tt_arg->A;
+    float complex* restrict B = tt_arg->B;
+    const int nt = transpose_nt_use(tt_arg->out_elems * sizeof(*B));
+
+    if (tt_arg->alpha) {
+        TRANSPOSE_AVX_INTR_TILES_NT(A, tt_arg->lda, B, tt_arg->ldb,
+                                    tt_arg->r_min, tt_arg->r_max,
+                                    tt_arg->c_min, tt_arg->c_max, 8,
+                                    (const float complex *)tt_arg->alpha, nt,
+                                    transpose_flt_cmplx_avx_intr_8x8_blk,
+                                    transpose_flt_cmplx_avx_intr_8x8_blk_nt,
+                                    transpose_flt_cmplx_avx_intr_8x8_blk_part);
+    } else {
+        TRANSPOSE_AVX_INTR_TILES_NT(A, tt_arg->lda, B, tt_arg->ldb,
+                                    tt_arg->r_min, tt_arg->r_max,
+                                    tt_arg->c_min, tt_arg->c_max, 8,
+                                    NULL, nt,
+                                    transpose_flt_cmplx_avx_intr_8x8_blk,
+                                    transpose_flt_cmplx_avx_intr_8x8_blk_nt,
+                                    transpose_flt_cmplx_avx_intr_8x8_blk_part);
+    }
+
+    return (void *)tt_arg->thr_num;
+}
+
+CPU_TARGET_AVX512
+static void *transpose_thread_blocked_dbl_cmplx(void *args) {
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    const double complex* restrict A = tt_arg->A;
+    double complex* restrict B = tt_arg->B;
+    const int nt = transpose_nt_use(tt_arg->out_elems * sizeof(*B));
+
+    if (tt_arg->alpha) {
+        TRANSPOSE_AVX_INTR_TILES_NT(A, tt_arg->lda, B, tt_arg->ldb,
+                                    tt_arg->r_min, tt_arg->r_max,
+                                    tt_arg->c_min, tt_arg->c_max, 4,
+                                    (const double complex *)tt_arg->alpha, nt,
+                                    transpose_dbl_cmplx_avx_intr_4x4_blk,
+                                    transpose_dbl_cmplx_avx_intr_4x4_blk_nt,
+                                    transpose_dbl_cmplx_avx_intr_4x4_blk_part);
+    } else {
+        TRANSPOSE_AVX_INTR_TILES_NT(A, tt_arg->lda, B, tt_arg->ldb,
+                                    tt_arg->r_min, tt_arg->r_max,
+                                    tt_arg->c_min, tt_arg->c_max, 4,
+                                    NULL, nt,
+                                    transpose_dbl_cmplx_avx_intr_4x4_blk,
+                                    transpose_dbl_cmplx_avx_intr_4x4_blk_nt,
+                                    transpose_dbl_cmplx_avx_intr_4x4_blk_part);
+    }
+
+    return (void *)tt_arg->thr_num;
+}
+
+CPU_TARGET_AVX512
+static void *transpose_thread_blocked_u8(void *args) {
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    const uint8_t* restrict A = tt_arg->A;
+    uint8_t* restrict B = tt_arg->B;
+    const int nt = transpose_nt_use(tt_arg->out_elems * sizeof(*B));
+
+    TRANSPOSE_AVX_INTR_TILES_RECT_NT(A, tt_arg->lda, B, tt_arg->ldb,
+                                     tt_arg->r_min, tt_arg->r_max,
+                                     tt_arg->c_min, tt_arg->c_max, 16, 64, nt,
+                                     transpose_u8_avx_intr_16x16_blk,
+                                     transpose_u8_avx_intr_16x16_blk_nt,
+                                     transpose_u8_avx_intr_16x16_blk_part);
+
+    return (void *)tt_arg->thr_num;
+}
+
+CPU_TARGET_AVX512
+static void *transpose_thread_blocked_i16(void *args) {
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    const int16_t* restrict A = tt_arg->A;
+    int16_t* restrict B = tt_arg->B;
+    const int nt = transpose_nt_use(tt_arg->out_elems * sizeof(*B));
+
+    TRANSPOSE_AVX_INTR_TILES_RECT_NT(A, tt_arg->lda, B, tt_arg->ldb,
+                                     tt_arg->r_min, tt_arg->r_max,
+                                     tt_arg->c_min, tt_arg->c_max, 16, 32, nt,
+                                     transpose_i16_avx_intr_16x16_blk,
+                                     transpose_i16_avx_intr_16x16_blk_nt,
+                                     transpose_i16_avx_intr_16x16_blk_part);
+
+    return (void *)tt_arg->thr_num;
+}
+
+// alpha points to the float scale of the I/Q ingest transposes
+#define TRANSPOSE_THREAD_IQ_DEFINE(fmt) \
+CPU_TARGET_AVX512 \
+static void *transpose_thread_blocked_##fmt(void *args) { \
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args; \
+    const transpose_##fmt##_t* restrict A = tt_arg->A; \
+    float complex* restrict B = tt_arg->B; \
+    const float scale = *(const float *)tt_arg->alpha; \
+    const int nt = transpose_nt_use(tt_arg->out_elems * sizeof(*B)); \
+\
+    TRANSPOSE_AVX_INTR_TILES_NT(A, tt_arg->lda, B, tt_arg->ldb, \
+                                tt_arg->r_min, tt_arg->r_max, \
+                                tt_arg->c_min, tt_arg->c_max, 8, scale, nt, \
+                                transpose_##fmt##_flt_cmplx_avx_intr_8x8_blk, \
+                                transpose_##fmt##_flt_cmplx_avx_intr_8x8_blk_nt, \
+                                transpose_##fmt##_flt_cmplx_avx_intr_8x8_blk_part); \
+\
+    return (void *)tt_arg->thr_num; \
+}
+
+TRANSPOSE_THREAD_IQ_DEFINE(iq16)
+TRANSPOSE_THREAD_IQ_DEFINE(iq12)
+
+/*
+ * Worker for the precision-converting kernels name, whose n x n tiles take in_t
+ * to out_t.
+ */
+#define TRANSPOSE_THREAD_CVT_DEFINE(target, name, in_t, out_t, n) \
+target \
+static void *transpose_thread_blocked_##name(void *args) { \
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args; \
+    const in_t* restrict A = tt_arg->A; \
+    out_t* restrict B = tt_arg->B; \
+    const int nt = transpose_nt_use(tt_arg->out_elems * sizeof(*B)); \
+\
+    TRANSPOSE_AVX_INTR_TILES_RECT_NT(A, tt_arg->lda, B, tt_arg->ldb, \
+                                     tt_arg->r_min, tt_arg->r_max, \
+                                     tt_arg->c_min, tt_arg->c_max, n, n, nt, \
+                                     transpose_##name##_blk, \
+                                     transpose_##name##_blk_nt, \
+                                     transpose_##name##_blk_part); \
+\
+    return (void *)tt_arg->thr_num; \
+}
+
+TRANSPOSE_THREAD_CVT_DEFINE(CPU_TARGET_AVX512, dbl_flt_avx_intr_16x16,
+                            double, float, 16)
+TRANSPOSE_THREAD_CVT_DEFINE(CPU_TARGET_AVX512, dbl_cmplx_flt_cmplx_avx_intr_8x8,
+                            double complex, float complex, 8)
+TRANSPOSE_THREAD_CVT_DEFINE(CPU_TARGET_AVX512, flt_fp16_avx_intr_16x16,
+                            float, transpose_fp16_t, 16)
+TRANSPOSE_THREAD_CVT_DEFINE(CPU_TARGET_AVX512, flt_bf16_avx_intr_16x16,
+                            float, transpose_bf16_t, 16)
+TRANSPOSE_THREAD_CVT_DEFINE(CPU_TARGET_AVX512,
+                            flt_cmplx_fp16_cmplx_avx_intr_8x8,
+                            float complex, transpose_fp16_cmplx_t, 8)
+TRANSPOSE_THREAD_CVT_DEFINE(CPU_TARGET_AVX512,
+                            flt_cmplx_bf16_cmplx_avx_intr_8x8,
+                            float complex, transpose_bf16_cmplx_t, 8)
+
+// bf16 workers using AVX512_BF16, picked by the callers when the CPU has it
+#if defined(CPU_TARGET_AVX512_BF16)
+TRANSPOSE_THREAD_CVT_DEFINE(CPU_TARGET_AVX512_BF16,
+                            flt_bf16_avx_intr_16x16_native,
+                            float, transpose_bf16_t, 16)
+TRANSPOSE_THREAD_CVT_DEFINE(CPU_TARGET_AVX512_BF16,
+                            flt_cmplx_bf16_cmplx_avx_intr_8x8_native,
+                            float complex, transpose_bf16_cmplx_t, 8)
+#define TRANSPOSE_THREAD_BF16(name) \
+    (avx_intr_have_bf16() ? &transpose_thread_blocked_##name##_native \
+                          : &transpose_thread_blocked_##name)
 #else
-            _mm512_store_pd(&B_block[0], s[0]);
-            _mm512_store_pd(&B_block[tt_arg->A_rows], s[1]);
-            _mm512_store_pd(&B_block[2*tt_arg->A_rows], s[2]);
-            _mm512_store_pd(&B_block[3*tt_arg->A_rows], s[3]);
-            _mm512_store_pd(&B_block[4*tt_arg->A_rows], s[4]);
-            _mm512_store_pd(&B_block[5*tt_arg->A_rows], s[5]);
-            _mm512_store_pd(&B_block[6*tt_arg->A_rows], s[6]);
-            _mm512_store_pd(&B_block[7*tt_arg->A_rows], s[7]);
+#define TRANSPOSE_THREAD_BF16(name) (&transpose_thread_blocked_##name)
 #endif
-        }
-    }
 
-    pthread_exit((void *)tt_arg->thr_num);
+/*
+ * Workers for the split-complex kernels of real_t: B (TO_SPLIT) or A
+ * (FROM_SPLIT) is the real plane and alpha the imaginary one.
+ */
+#define TRANSPOSE_THREAD_SPLIT_DEFINE(name, real_t, cmplx_t, tile, n) \
+CPU_TARGET_AVX512 \
+static void *transpose_thread_blocked_##name##_cmplx_split(void *args) { \
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args; \
+    const cmplx_t* restrict A = tt_arg->A; \
+    real_t* restrict B_re = tt_arg->B; \
+    real_t* restrict B_im = (real_t *)tt_arg->alpha; \
+    const int nt = transpose_nt_use(2 * tt_arg->out_elems * sizeof(*B_re)); \
+\
+    TRANSPOSE_AVX_INTR_TO_SPLIT_TILES_NT(A, tt_arg->lda, B_re, B_im, \
+                                         tt_arg->ldb, \
+                                         tt_arg->r_min, tt_arg->r_max, \
+                                         tt_arg->c_min, tt_arg->c_max, n, nt, \
+                                         transpose_##name##_cmplx_split_avx_intr_##tile##_blk, \
+                                         transpose_##name##_cmplx_split_avx_intr_##tile##_blk_nt, \
+                                         transpose_##name##_cmplx_split_avx_intr_##tile##_blk_part); \
+\
+    return (void *)tt_arg->thr_num; \
+} \
+\
+CPU_TARGET_AVX512 \
+static void *transpose_thread_blocked_##name##_split_cmplx(void *args) { \
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args; \
+    const real_t* restrict A_re = tt_arg->A; \
+    const real_t* restrict A_im = tt_arg->alpha; \
+    cmplx_t* restrict B = tt_arg->B; \
+    const int nt = transpose_nt_use(tt_arg->out_elems * sizeof(*B)); \
+\
+    TRANSPOSE_AVX_INTR_FROM_SPLIT_TILES_NT(A_re, A_im, tt_arg->lda, B, \
+                                           tt_arg->ldb, \
+                                           tt_arg->r_min, tt_arg->r_max, \
+                                           tt_arg->c_min, tt_arg->c_max, n, \
+                                           nt, \
+                                           transpose_##name##_split_cmplx_avx_intr_##tile##_blk, \
+                                           transpose_##name##_split_cmplx_avx_intr_##tile##_blk_nt, \
+                                           transpose_##name##_split_cmplx_avx_intr_##tile##_blk_part); \
+\
+    return (void *)tt_arg->thr_num; \
 }
 
-void transpose_dbl_threads_avx_intr_8x8_row(const double* restrict A,
-                                            double* restrict B,
-                                            size_t A_rows, size_t A_cols,
-                                            size_t num_thr)
-{
-    pthread_attr_t attr;
-    size_t r_min, r_max, c_min, c_max, thr_num, rows_per_thr;
-    pthread_t *threads = assert_malloc(num_thr * sizeof(pthread_t));
-    struct tr_thread_arg *args = assert_malloc(num_thr * sizeof(struct tr_thread_arg));
+TRANSPOSE_THREAD_SPLIT_DEFINE(flt, float, float complex, 16x16, 16)
+TRANSPOSE_THREAD_SPLIT_DEFINE(dbl, double, double complex, 8x8, 8)
 
-    // initialize and set thread detached attribute
-    pthread_attr_init(&attr);
-    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+// workers for the epilogue kernels of the complex element type of name
+#define TRANSPOSE_THREAD_EPI_DEFINE(name, cmplx_t, tile, n) \
+CPU_TARGET_AVX512 \
+static void *transpose_thread_blocked_##name##_epi(void *args) { \
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args; \
+    const cmplx_t* restrict A = tt_arg->A; \
+    cmplx_t* restrict B = tt_arg->B; \
+    const struct transpose_epi_##name *epi = tt_arg->alpha; \
+    const int nt = transpose_nt_use(tt_arg->out_elems * sizeof(*B)); \
+\
+    TRANSPOSE_AVX_INTR_EPI_TILES_NT(A, tt_arg->lda, B, tt_arg->ldb, \
+                                    tt_arg->r_min, tt_arg->r_max, \
+                                    tt_arg->c_min, tt_arg->c_max, n, epi, nt, \
+                                    transpose_##name##_avx_intr_##tile##_epi_blk, \
+                                    transpose_##name##_avx_intr_##tile##_epi_blk_nt, \
+                                    transpose_##name##_avx_intr_##tile##_epi_blk_part); \
+\
+    return (void *)tt_arg->thr_num; \
+}
 
-    for (thr_num = 0; thr_num < num_thr; thr_num++) {
-        rows_per_thr = A_rows / num_thr;
-        r_min = thr_num * rows_per_thr;
-        r_max = r_min + rows_per_thr;
+TRANSPOSE_THREAD_EPI_DEFINE(flt_cmplx, float complex, 8x8, 8)
+TRANSPOSE_THREAD_EPI_DEFINE(dbl_cmplx, double complex, 4x4, 4)
 
-        c_min = 0;
-        c_max = A_cols;
+CPU_TARGET_AVX512
+static void *transpose_thread_wc_dbl(void *args) {
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    const double* restrict A = tt_arg->A;
+    double* restrict B = tt_arg->B;
 
-        tt_arg_init(&args[thr_num], A, B, A_rows, A_cols,
-                    r_min, r_max, c_min, c_max, thr_num);
-        errno = pthread_create(&threads[thr_num], &attr, &transpose_thread_blocked_dbl,
-                               &args[thr_num]);
-        if (errno) {
-                perror("pthread_create");
-                exit(errno);
-        }
+    TRANSPOSE_AVX_INTR_WC_TILES(double, A, tt_arg->lda, B, tt_arg->ldb,
+                                tt_arg->r_min, tt_arg->r_max,
+                                tt_arg->c_min, tt_arg->c_max,
+                                TRANSPOSE_TILE_DBL, 8,
+                                transpose_dbl_avx_intr_8x8_blk,
+                                transpose_dbl_avx_intr_8x8_blk_part);
+
+    return (void *)tt_arg->thr_num;
+}
+
+CPU_TARGET_AVX512
+static void *transpose_thread_wc_flt(void *args) {
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    const float* restrict A = tt_arg->A;
+    float* restrict B = tt_arg->B;
+
+    TRANSPOSE_AVX_INTR_WC_TILES(float, A, tt_arg->lda, B, tt_arg->ldb,
+                                tt_arg->r_min, tt_arg->r_max,
+                                tt_arg->c_min, tt_arg->c_max,
+                                TRANSPOSE_TILE_FLT, 16,
+                                transpose_flt_avx_intr_16x16_blk,
+                                transpose_flt_avx_intr_16x16_blk_part);
+
+    return (void *)tt_arg->thr_num;
+}
+
+CPU_TARGET_AVX512
+static void *transpose_thread_wc_dbl_cmplx(void *args) {
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    const double complex* restrict A = tt_arg->A;
+    double complex* restrict B = tt_arg->B;
+
+    TRANSPOSE_AVX_INTR_WC_TILES(double complex, A, tt_arg->lda, B, tt_arg->ldb,
+                                tt_arg->r_min, tt_arg->r_max,
+                                tt_arg->c_min, tt_arg->c_max,
+                                TRANSPOSE_TILE_DBL_CMPLX, 4,
+                                transpose_dbl_cmplx_avx_intr_4x4_blk,
+                                transpose_dbl_cmplx_avx_intr_4x4_blk_part);
+
+    return (void *)tt_arg->thr_num;
+}
+
+/*
+ * Divide the n elements, in blocks of size blk, as evenly as possible among the
+ * threads and return the element range [*min, *max) assigned to thread thr_num.
+ * The last block may be partial.
+ */
+static void thread_blk_range(size_t n, size_t blk, size_t num_thr,
+                             size_t thr_num, size_t *min, size_t *max)
+{
+    size_t n_blks = (n + blk - 1) / blk;
+    size_t num_thr_with_max_blks = n_blks % num_thr;
+    size_t min_blks_per_thread = n_blks / num_thr;
+    size_t max_blks_per_thread = min_blks_per_thread + 1;
+    size_t blk_min, blk_max;
+
+    if (thr_num < num_thr_with_max_blks) {
+        blk_min = thr_num * max_blks_per_thread;
+        blk_max = blk_min + max_blks_per_thread;
+    } else {
+        blk_min = num_thr_with_max_blks * max_blks_per_thread +
+                  (thr_num - num_thr_with_max_blks) * min_blks_per_thread;
+        blk_max = blk_min + min_blks_per_thread;
     }
+    *min = blk_min * blk < n ? blk_min * blk : n;
+    *max = blk_max * blk < n ? blk_max * blk : n;
+}
+
+static void transpose_threads(const void* restrict A, size_t lda,
+                              void* restrict B, size_t ldb,
+                              size_t A_rows, size_t A_cols, const void *alpha,
+                              size_t num_thr, size_t blk, int by_row,
+                              void *(*start_routine)(void *))
+{
+    size_t thr_num, r_min, r_max, c_min, c_max;
+    struct tr_thread_arg *args = transpose_pool_begin(num_thr, sizeof(*args));
 
-    // free attribute and wait for the other threads
-    pthread_attr_destroy(&attr);
-    for(thr_num = 0; thr_num < num_thr; thr_num++) {
-        errno = pthread_join(threads[thr_num], NULL);
-        if (errno) {
-            perror("pthread_join");
-            exit(errno);
+    for (thr_num = 0; thr_num < num_thr; thr_num++) {
+        // divide the row or column blocks as evenly as possible
+        if (by_row) {
+            thread_blk_range(A_rows, blk, num_thr, thr_num, &r_min, &r_max);
+            c_min = 0;
+            c_max = A_cols;
+        } else {
+            r_min = 0;
+            r_max = A_rows;
+            thread_blk_range(A_cols, blk, num_thr, thr_num, &c_min, &c_max);
         }
+        tt_arg_init(&args[thr_num], A, lda, B, ldb, alpha,
+                    r_min, r_max, c_min, c_max, thr_num);
+        args[thr_num].out_elems = A_cols * ldb;
     }
 
-    free(args);
-    free(threads);
+    transpose_pool_run(start_routine);
+}
+
+void transpose_dbl_threads_avx_intr_8x8_row(const double* restrict A,
+                                            double* restrict B,
+                                            size_t A_rows, size_t A_cols,
+                                            size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                      8, 1, &transpose_thread_blocked_dbl);
 }
 
 void transpose_dbl_threads_avx_intr_8x8_col(const double* restrict A,
@@ -200,44 +455,543 @@ void transpose_dbl_threads_avx_intr_8x8_col(const double* restrict A,
                                             size_t A_rows, size_t A_cols,
                                             size_t num_thr)
 {
-    pthread_attr_t attr;
-    size_t r_min, r_max, c_min, c_max, thr_num, cols_per_thr;
-    pthread_t *threads = assert_malloc(num_thr * sizeof(pthread_t));
-    struct tr_thread_arg *args = assert_malloc(num_thr * sizeof(struct tr_thread_arg));
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                      8, 0, &transpose_thread_blocked_dbl);
+}
 
-    // initialize and set thread detached attribute
-    pthread_attr_init(&attr);
-    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+void transpose_flt_threads_avx_intr_16x16_row(const float* restrict A,
+                                              float* restrict B,
+                                              size_t A_rows, size_t A_cols,
+                                              size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                      16, 1, &transpose_thread_blocked_flt);
+}
 
-    for (thr_num = 0; thr_num < num_thr; thr_num++) {
-        r_min = 0;
-        r_max = A_rows;
+void transpose_flt_threads_avx_intr_16x16_col(const float* restrict A,
+                                              float* restrict B,
+                                              size_t A_rows, size_t A_cols,
+                                              size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                      16, 0, &transpose_thread_blocked_flt);
+}
 
-        cols_per_thr = A_cols / num_thr;
-        c_min = thr_num * cols_per_thr;
-        c_max = c_min + cols_per_thr;
+// float complex elements are moved by the double kernel, see transpose-avx.c
 
-        tt_arg_init(&args[thr_num], A, B, A_rows, A_cols,
-                    r_min, r_max, c_min, c_max, thr_num);
-        errno = pthread_create(&threads[thr_num], &attr, &transpose_thread_blocked_dbl,
-                               &args[thr_num]);
+void transpose_flt_cmplx_threads_avx_intr_8x8_row(const float complex* restrict A,
+                                                  float complex* restrict B,
+                                                  size_t A_rows, size_t A_cols,
+                                                  size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                      8, 1, &transpose_thread_blocked_dbl);
+}
 
-        if (errno) {
-                perror("pthread_create");
-                exit(errno);
-        }
-    }
+void transpose_flt_cmplx_threads_avx_intr_8x8_col(const float complex* restrict A,
+                                                  float complex* restrict B,
+                                                  size_t A_rows, size_t A_cols,
+                                                  size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                      8, 0, &transpose_thread_blocked_dbl);
+}
 
-    // free attribute and wait for the other threads
-    pthread_attr_destroy(&attr);
-    for(thr_num = 0; thr_num < num_thr; thr_num++) {
-        errno = pthread_join(threads[thr_num], NULL);
-        if (errno) {
-            perror("pthread_join");
-            exit(errno);
-        }
-    }
+void transpose_dbl_cmplx_threads_avx_intr_4x4_row(const double complex* restrict A,
+                                                  double complex* restrict B,
+                                                  size_t A_rows, size_t A_cols,
+                                                  size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                      4, 1, &transpose_thread_blocked_dbl_cmplx);
+}
+
+void transpose_dbl_cmplx_threads_avx_intr_4x4_col(const double complex* restrict A,
+                                                  double complex* restrict B,
+                                                  size_t A_rows, size_t A_cols,
+                                                  size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                      4, 0, &transpose_thread_blocked_dbl_cmplx);
+}
+
+void transpose_u8_threads_avx_intr_16x16_row(const uint8_t* restrict A,
+                                             uint8_t* restrict B,
+                                             size_t A_rows, size_t A_cols,
+                                             size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                      16, 1, &transpose_thread_blocked_u8);
+}
+
+void transpose_u8_threads_avx_intr_16x16_col(const uint8_t* restrict A,
+                                             uint8_t* restrict B,
+                                             size_t A_rows, size_t A_cols,
+                                             size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                      64, 0, &transpose_thread_blocked_u8);
+}
+
+void transpose_i16_threads_avx_intr_16x16_row(const int16_t* restrict A,
+                                              int16_t* restrict B,
+                                              size_t A_rows, size_t A_cols,
+                                              size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                      16, 1, &transpose_thread_blocked_i16);
+}
+
+void transpose_i16_threads_avx_intr_16x16_col(const int16_t* restrict A,
+                                              int16_t* restrict B,
+                                              size_t A_rows, size_t A_cols,
+                                              size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                      32, 0, &transpose_thread_blocked_i16);
+}
+
+void transpose_iq16_flt_cmplx_threads_avx_intr_8x8_row(const transpose_iq16_t* restrict A,
+                                                       float complex* restrict B,
+                                                       size_t A_rows, size_t A_cols,
+                                                       float scale, size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, &scale, num_thr,
+                      8, 1, &transpose_thread_blocked_iq16);
+}
+
+void transpose_iq16_flt_cmplx_threads_avx_intr_8x8_col(const transpose_iq16_t* restrict A,
+                                                       float complex* restrict B,
+                                                       size_t A_rows, size_t A_cols,
+                                                       float scale, size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, &scale, num_thr,
+                      8, 0, &transpose_thread_blocked_iq16);
+}
+
+void transpose_iq12_flt_cmplx_threads_avx_intr_8x8_row(const transpose_iq12_t* restrict A,
+                                                       float complex* restrict B,
+                                                       size_t A_rows, size_t A_cols,
+                                                       float scale, size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, &scale, num_thr,
+                      8, 1, &transpose_thread_blocked_iq12);
+}
 
-    free(args);
-    free(threads);
+void transpose_iq12_flt_cmplx_threads_avx_intr_8x8_col(const transpose_iq12_t* restrict A,
+                                                       float complex* restrict B,
+                                                       size_t A_rows, size_t A_cols,
+                                                       float scale, size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, &scale, num_thr,
+                      8, 0, &transpose_thread_blocked_iq12);
+}
+
+void transpose_dbl_flt_threads_avx_intr_16x16_row(const double* restrict A,
+                                                  float* restrict B,
+                                                  size_t A_rows, size_t A_cols,
+                                                  size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                      16, 1, &transpose_thread_blocked_dbl_flt_avx_intr_16x16);
+}
+
+void transpose_dbl_flt_threads_avx_intr_16x16_col(const double* restrict A,
+                                                  float* restrict B,
+                                                  size_t A_rows, size_t A_cols,
+                                                  size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                      16, 0, &transpose_thread_blocked_dbl_flt_avx_intr_16x16);
+}
+
+void transpose_dbl_cmplx_flt_cmplx_threads_avx_intr_8x8_row(const double complex* restrict A,
+                                                            float complex* restrict B,
+                                                            size_t A_rows, size_t A_cols,
+                                                            size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                      8, 1, &transpose_thread_blocked_dbl_cmplx_flt_cmplx_avx_intr_8x8);
+}
+
+void transpose_dbl_cmplx_flt_cmplx_threads_avx_intr_8x8_col(const double complex* restrict A,
+                                                            float complex* restrict B,
+                                                            size_t A_rows, size_t A_cols,
+                                                            size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                      8, 0, &transpose_thread_blocked_dbl_cmplx_flt_cmplx_avx_intr_8x8);
+}
+
+void transpose_flt_fp16_threads_avx_intr_16x16_row(const float* restrict A,
+                                                   transpose_fp16_t* restrict B,
+                                                   size_t A_rows, size_t A_cols,
+                                                   size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                      16, 1, &transpose_thread_blocked_flt_fp16_avx_intr_16x16);
+}
+
+void transpose_flt_fp16_threads_avx_intr_16x16_col(const float* restrict A,
+                                                   transpose_fp16_t* restrict B,
+                                                   size_t A_rows, size_t A_cols,
+                                                   size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                      16, 0, &transpose_thread_blocked_flt_fp16_avx_intr_16x16);
+}
+
+void transpose_flt_bf16_threads_avx_intr_16x16_row(const float* restrict A,
+                                                   transpose_bf16_t* restrict B,
+                                                   size_t A_rows, size_t A_cols,
+                                                   size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                      16, 1, TRANSPOSE_THREAD_BF16(flt_bf16_avx_intr_16x16));
+}
+
+void transpose_flt_bf16_threads_avx_intr_16x16_col(const float* restrict A,
+                                                   transpose_bf16_t* restrict B,
+                                                   size_t A_rows, size_t A_cols,
+                                                   size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                      16, 0, TRANSPOSE_THREAD_BF16(flt_bf16_avx_intr_16x16));
+}
+
+void transpose_flt_cmplx_fp16_cmplx_threads_avx_intr_8x8_row(const float complex* restrict A,
+                                                             transpose_fp16_cmplx_t* restrict B,
+                                                             size_t A_rows, size_t A_cols,
+                                                             size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                      8, 1, &transpose_thread_blocked_flt_cmplx_fp16_cmplx_avx_intr_8x8);
+}
+
+void transpose_flt_cmplx_fp16_cmplx_threads_avx_intr_8x8_col(const float complex* restrict A,
+                                                             transpose_fp16_cmplx_t* restrict B,
+                                                             size_t A_rows, size_t A_cols,
+                                                             size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                      8, 0, &transpose_thread_blocked_flt_cmplx_fp16_cmplx_avx_intr_8x8);
+}
+
+void transpose_flt_cmplx_bf16_cmplx_threads_avx_intr_8x8_row(const float complex* restrict A,
+                                                             transpose_bf16_cmplx_t* restrict B,
+                                                             size_t A_rows, size_t A_cols,
+                                                             size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                      8, 1, TRANSPOSE_THREAD_BF16(flt_cmplx_bf16_cmplx_avx_intr_8x8));
+}
+
+void transpose_flt_cmplx_bf16_cmplx_threads_avx_intr_8x8_col(const float complex* restrict A,
+                                                             transpose_bf16_cmplx_t* restrict B,
+                                                             size_t A_rows, size_t A_cols,
+                                                             size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                      8, 0, TRANSPOSE_THREAD_BF16(flt_cmplx_bf16_cmplx_avx_intr_8x8));
+}
+
+void transpose_flt_cmplx_split_threads_avx_intr_16x16_row(const float complex* restrict A,
+                                                          float* restrict B_re,
+                                                          float* restrict B_im,
+                                                          size_t A_rows, size_t A_cols,
+                                                          size_t num_thr)
+{
+    transpose_threads(A, A_cols, B_re, A_rows, A_rows, A_cols, B_im, num_thr,
+                      16, 1, &transpose_thread_blocked_flt_cmplx_split);
+}
+
+void transpose_flt_cmplx_split_threads_avx_intr_16x16_col(const float complex* restrict A,
+                                                          float* restrict B_re,
+                                                          float* restrict B_im,
+                                                          size_t A_rows, size_t A_cols,
+                                                          size_t num_thr)
+{
+    transpose_threads(A, A_cols, B_re, A_rows, A_rows, A_cols, B_im, num_thr,
+                      16, 0, &transpose_thread_blocked_flt_cmplx_split);
+}
+
+void transpose_dbl_cmplx_split_threads_avx_intr_8x8_row(const double complex* restrict A,
+                                                        double* restrict B_re,
+                                                        double* restrict B_im,
+                                                        size_t A_rows, size_t A_cols,
+                                                        size_t num_thr)
+{
+    transpose_threads(A, A_cols, B_re, A_rows, A_rows, A_cols, B_im, num_thr,
+                      8, 1, &transpose_thread_blocked_dbl_cmplx_split);
+}
+
+void transpose_dbl_cmplx_split_threads_avx_intr_8x8_col(const double complex* restrict A,
+                                                        double* restrict B_re,
+                                                        double* restrict B_im,
+                                                        size_t A_rows, size_t A_cols,
+                                                        size_t num_thr)
+{
+    transpose_threads(A, A_cols, B_re, A_rows, A_rows, A_cols, B_im, num_thr,
+                      8, 0, &transpose_thread_blocked_dbl_cmplx_split);
+}
+
+void transpose_flt_split_cmplx_threads_avx_intr_16x16_row(const float* restrict A_re,
+                                                          const float* restrict A_im,
+                                                          float complex* restrict B,
+                                                          size_t A_rows, size_t A_cols,
+                                                          size_t num_thr)
+{
+    transpose_threads(A_re, A_cols, B, A_rows, A_rows, A_cols, A_im, num_thr,
+                      16, 1, &transpose_thread_blocked_flt_split_cmplx);
+}
+
+void transpose_flt_split_cmplx_threads_avx_intr_16x16_col(const float* restrict A_re,
+                                                          const float* restrict A_im,
+                                                          float complex* restrict B,
+                                                          size_t A_rows, size_t A_cols,
+                                                          size_t num_thr)
+{
+    transpose_threads(A_re, A_cols, B, A_rows, A_rows, A_cols, A_im, num_thr,
+                      16, 0, &transpose_thread_blocked_flt_split_cmplx);
+}
+
+void transpose_dbl_split_cmplx_threads_avx_intr_8x8_row(const double* restrict A_re,
+                                                        const double* restrict A_im,
+                                                        double complex* restrict B,
+                                                        size_t A_rows, size_t A_cols,
+                                                        size_t num_thr)
+{
+    transpose_threads(A_re, A_cols, B, A_rows, A_rows, A_cols, A_im, num_thr,
+                      8, 1, &transpose_thread_blocked_dbl_split_cmplx);
+}
+
+void transpose_dbl_split_cmplx_threads_avx_intr_8x8_col(const double* restrict A_re,
+                                                        const double* restrict A_im,
+                                                        double complex* restrict B,
+                                                        size_t A_rows, size_t A_cols,
+                                                        size_t num_thr)
+{
+    transpose_threads(A_re, A_cols, B, A_rows, A_rows, A_cols, A_im, num_thr,
+                      8, 0, &transpose_thread_blocked_dbl_split_cmplx);
+}
+
+void transpose_flt_cmplx_threads_avx_intr_8x8_row_epi(const float complex* restrict A,
+                                                      float complex* restrict B,
+                                                      size_t A_rows, size_t A_cols,
+                                                      const struct transpose_epi_flt_cmplx *epi,
+                                                      size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, epi, num_thr,
+                      8, 1, &transpose_thread_blocked_flt_cmplx_epi);
+}
+
+void transpose_flt_cmplx_threads_avx_intr_8x8_col_epi(const float complex* restrict A,
+                                                      float complex* restrict B,
+                                                      size_t A_rows, size_t A_cols,
+                                                      const struct transpose_epi_flt_cmplx *epi,
+                                                      size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, epi, num_thr,
+                      8, 0, &transpose_thread_blocked_flt_cmplx_epi);
+}
+
+void transpose_dbl_cmplx_threads_avx_intr_4x4_row_epi(const double complex* restrict A,
+                                                      double complex* restrict B,
+                                                      size_t A_rows, size_t A_cols,
+                                                      const struct transpose_epi_dbl_cmplx *epi,
+                                                      size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, epi, num_thr,
+                      4, 1, &transpose_thread_blocked_dbl_cmplx_epi);
+}
+
+void transpose_dbl_cmplx_threads_avx_intr_4x4_col_epi(const double complex* restrict A,
+                                                      double complex* restrict B,
+                                                      size_t A_rows, size_t A_cols,
+                                                      const struct transpose_epi_dbl_cmplx *epi,
+                                                      size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, epi, num_thr,
+                      4, 0, &transpose_thread_blocked_dbl_cmplx_epi);
+}
+
+void transpose_dbl_threads_avx_intr_8x8_row_ld(const double* restrict A,
+                                               size_t lda,
+                                               double* restrict B,
+                                               size_t ldb,
+                                               size_t A_rows, size_t A_cols,
+                                               double alpha, size_t num_thr)
+{
+    transpose_threads(A, lda, B, ldb, A_rows, A_cols,
+                      alpha == 1 ? NULL : &alpha, num_thr, 8, 1,
+                      &transpose_thread_blocked_dbl);
+}
+
+void transpose_dbl_threads_avx_intr_8x8_col_ld(const double* restrict A,
+                                               size_t lda,
+                                               double* restrict B,
+                                               size_t ldb,
+                                               size_t A_rows, size_t A_cols,
+                                               double alpha, size_t num_thr)
+{
+    transpose_threads(A, lda, B, ldb, A_rows, A_cols,
+                      alpha == 1 ? NULL : &alpha, num_thr, 8, 0,
+                      &transpose_thread_blocked_dbl);
+}
+
+void transpose_flt_threads_avx_intr_16x16_row_ld(const float* restrict A,
+                                                 size_t lda,
+                                                 float* restrict B,
+                                                 size_t ldb,
+                                                 size_t A_rows, size_t A_cols,
+                                                 float alpha, size_t num_thr)
+{
+    transpose_threads(A, lda, B, ldb, A_rows, A_cols,
+                      alpha == 1 ? NULL : &alpha, num_thr, 16, 1,
+                      &transpose_thread_blocked_flt);
+}
+
+void transpose_flt_threads_avx_intr_16x16_col_ld(const float* restrict A,
+                                                 size_t lda,
+                                                 float* restrict B,
+                                                 size_t ldb,
+                                                 size_t A_rows, size_t A_cols,
+                                                 float alpha, size_t num_thr)
+{
+    transpose_threads(A, lda, B, ldb, A_rows, A_cols,
+                      alpha == 1 ? NULL : &alpha, num_thr, 16, 0,
+                      &transpose_thread_blocked_flt);
+}
+
+void transpose_flt_cmplx_threads_avx_intr_8x8_row_ld(const float complex* restrict A,
+                                                     size_t lda,
+                                                     float complex* restrict B,
+                                                     size_t ldb,
+                                                     size_t A_rows,
+                                                     size_t A_cols,
+                                                     float complex alpha,
+                                                     size_t num_thr)
+{
+    transpose_threads(A, lda, B, ldb, A_rows, A_cols,
+                      alpha == 1 ? NULL : &alpha, num_thr, 8, 1,
+                      &transpose_thread_blocked_flt_cmplx);
+}
+
+void transpose_flt_cmplx_threads_avx_intr_8x8_col_ld(const float complex* restrict A,
+                                                     size_t lda,
+                                                     float complex* restrict B,
+                                                     size_t ldb,
+                                                     size_t A_rows,
+                                                     size_t A_cols,
+                                                     float complex alpha,
+                                                     size_t num_thr)
+{
+    transpose_threads(A, lda, B, ldb, A_rows, A_cols,
+                      alpha == 1 ? NULL : &alpha, num_thr, 8, 0,
+                      &transpose_thread_blocked_flt_cmplx);
+}
+
+void transpose_dbl_cmplx_threads_avx_intr_4x4_row_ld(const double complex* restrict A,
+                                                     size_t lda,
+                                                     double complex* restrict B,
+                                                     size_t ldb,
+                                                     size_t A_rows,
+                                                     size_t A_cols,
+                                                     double complex alpha,
+                                                     size_t num_thr)
+{
+    transpose_threads(A, lda, B, ldb, A_rows, A_cols,
+                      alpha == 1 ? NULL : &alpha, num_thr, 4, 1,
+                      &transpose_thread_blocked_dbl_cmplx);
+}
+
+void transpose_dbl_cmplx_threads_avx_intr_4x4_col_ld(const double complex* restrict A,
+                                                     size_t lda,
+                                                     double complex* restrict B,
+                                                     size_t ldb,
+                                                     size_t A_rows,
+                                                     size_t A_cols,
+                                                     double complex alpha,
+                                                     size_t num_thr)
+{
+    transpose_threads(A, lda, B, ldb, A_rows, A_cols,
+                      alpha == 1 ? NULL : &alpha, num_thr, 4, 0,
+                      &transpose_thread_blocked_dbl_cmplx);
+}
+
+/*
+ * Write-combining variants.  Threads get whole staging tiles, so every thread
+ * but the last starts its rows of B on a cache line.
+ */
+
+void transpose_dbl_threads_avx_intr_8x8_row_wc(const double* restrict A,
+                                               double* restrict B,
+                                               size_t A_rows, size_t A_cols,
+                                               size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                      TRANSPOSE_TILE_DBL, 1, &transpose_thread_wc_dbl);
+}
+
+void transpose_dbl_threads_avx_intr_8x8_col_wc(const double* restrict A,
+                                               double* restrict B,
+                                               size_t A_rows, size_t A_cols,
+                                               size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                      TRANSPOSE_TILE_DBL, 0, &transpose_thread_wc_dbl);
+}
+
+void transpose_flt_threads_avx_intr_16x16_row_wc(const float* restrict A,
+                                                 float* restrict B,
+                                                 size_t A_rows, size_t A_cols,
+                                                 size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                      TRANSPOSE_TILE_FLT, 1, &transpose_thread_wc_flt);
+}
+
+void transpose_flt_threads_avx_intr_16x16_col_wc(const float* restrict A,
+                                                 float* restrict B,
+                                                 size_t A_rows, size_t A_cols,
+                                                 size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                      TRANSPOSE_TILE_FLT, 0, &transpose_thread_wc_flt);
+}
+
+void transpose_flt_cmplx_threads_avx_intr_8x8_row_wc(const float complex* restrict A,
+                                                     float complex* restrict B,
+                                                     size_t A_rows, size_t A_cols,
+                                                     size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                      TRANSPOSE_TILE_FLT_CMPLX, 1, &transpose_thread_wc_dbl);
+}
+
+void transpose_flt_cmplx_threads_avx_intr_8x8_col_wc(const float complex* restrict A,
+                                                     float complex* restrict B,
+                                                     size_t A_rows, size_t A_cols,
+                                                     size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                      TRANSPOSE_TILE_FLT_CMPLX, 0, &transpose_thread_wc_dbl);
+}
+
+void transpose_dbl_cmplx_threads_avx_intr_4x4_row_wc(const double complex* restrict A,
+                                                     double complex* restrict B,
+                                                     size_t A_rows, size_t A_cols,
+                                                     size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                      TRANSPOSE_TILE_DBL_CMPLX, 1, &transpose_thread_wc_dbl_cmplx);
+}
+
+void transpose_dbl_cmplx_threads_avx_intr_4x4_col_wc(const double complex* restrict A,
+                                                     double complex* restrict B,
+                                                     size_t A_rows, size_t A_cols,
+                                                     size_t num_thr)
+{
+    transpose_threads(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                      TRANSPOSE_TILE_DBL_CMPLX, 0, &transpose_thread_wc_dbl_cmplx);
 }
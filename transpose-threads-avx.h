@@ -7,8 +7,14 @@
 #ifndef TRANSPOSE_THREADS_AVX_H
 #define TRANSPOSE_THREADS_AVX_H
 
+#include <complex.h>
+#include <stdint.h>
 #include <stdlib.h>
 
+#include "transpose-cvt.h"
+#include "transpose-epi.h"
+#include "transpose-iq.h"
+
 void transpose_dbl_threads_avx_intr_8x8_row(const double* restrict A,
                                             double* restrict B,
                                             size_t A_rows, size_t A_cols,
@@ -19,4 +25,346 @@ void transpose_dbl_threads_avx_intr_8x8_col(const double* restrict A,
                                             size_t A_rows, size_t A_cols,
                                             size_t num_thr);
 
+void transpose_flt_threads_avx_intr_16x16_row(const float* restrict A,
+                                              float* restrict B,
+                                              size_t A_rows, size_t A_cols,
+                                              size_t num_thr);
+
+void transpose_flt_threads_avx_intr_16x16_col(const float* restrict A,
+                                              float* restrict B,
+                                              size_t A_rows, size_t A_cols,
+                                              size_t num_thr);
+
+void transpose_flt_cmplx_threads_avx_intr_8x8_row(const float complex* restrict A,
+                                                  float complex* restrict B,
+                                                  size_t A_rows, size_t A_cols,
+                                                  size_t num_thr);
+
+void transpose_flt_cmplx_threads_avx_intr_8x8_col(const float complex* restrict A,
+                                                  float complex* restrict B,
+                                                  size_t A_rows, size_t A_cols,
+                                                  size_t num_thr);
+
+void transpose_dbl_cmplx_threads_avx_intr_4x4_row(const double complex* restrict A,
+                                                  double complex* restrict B,
+                                                  size_t A_rows, size_t A_cols,
+                                                  size_t num_thr);
+
+void transpose_dbl_cmplx_threads_avx_intr_4x4_col(const double complex* restrict A,
+                                                  double complex* restrict B,
+                                                  size_t A_rows, size_t A_cols,
+                                                  size_t num_thr);
+
+/*
+ * 8- and 16-bit integer variants.  Row-wise threads split A into 16-row
+ * strips; column-wise ones into whole vectors of 64 bytes or 32 words.
+ */
+void transpose_u8_threads_avx_intr_16x16_row(const uint8_t* restrict A,
+                                             uint8_t* restrict B,
+                                             size_t A_rows, size_t A_cols,
+                                             size_t num_thr);
+
+void transpose_u8_threads_avx_intr_16x16_col(const uint8_t* restrict A,
+                                             uint8_t* restrict B,
+                                             size_t A_rows, size_t A_cols,
+                                             size_t num_thr);
+
+void transpose_i16_threads_avx_intr_16x16_row(const int16_t* restrict A,
+                                              int16_t* restrict B,
+                                              size_t A_rows, size_t A_cols,
+                                              size_t num_thr);
+
+void transpose_i16_threads_avx_intr_16x16_col(const int16_t* restrict A,
+                                              int16_t* restrict B,
+                                              size_t A_rows, size_t A_cols,
+                                              size_t num_thr);
+
+/*
+ * Ingest variants that convert interleaved I/Q samples to float complex,
+ * scaled by scale, while transposing.  See transpose.h.
+ */
+void transpose_iq16_flt_cmplx_threads_avx_intr_8x8_row(const transpose_iq16_t* restrict A,
+                                                       float complex* restrict B,
+                                                       size_t A_rows, size_t A_cols,
+                                                       float scale, size_t num_thr);
+
+void transpose_iq16_flt_cmplx_threads_avx_intr_8x8_col(const transpose_iq16_t* restrict A,
+                                                       float complex* restrict B,
+                                                       size_t A_rows, size_t A_cols,
+                                                       float scale, size_t num_thr);
+
+void transpose_iq12_flt_cmplx_threads_avx_intr_8x8_row(const transpose_iq12_t* restrict A,
+                                                       float complex* restrict B,
+                                                       size_t A_rows, size_t A_cols,
+                                                       float scale, size_t num_thr);
+
+void transpose_iq12_flt_cmplx_threads_avx_intr_8x8_col(const transpose_iq12_t* restrict A,
+                                                       float complex* restrict B,
+                                                       size_t A_rows, size_t A_cols,
+                                                       float scale, size_t num_thr);
+
+/*
+ * Precision-converting variants that round to the narrower output type while
+ * transposing.  See transpose.h.
+ */
+void transpose_dbl_flt_threads_avx_intr_16x16_row(const double* restrict A,
+                                                  float* restrict B,
+                                                  size_t A_rows, size_t A_cols,
+                                                  size_t num_thr);
+
+void transpose_dbl_flt_threads_avx_intr_16x16_col(const double* restrict A,
+                                                  float* restrict B,
+                                                  size_t A_rows, size_t A_cols,
+                                                  size_t num_thr);
+
+void transpose_dbl_cmplx_flt_cmplx_threads_avx_intr_8x8_row(const double complex* restrict A,
+                                                            float complex* restrict B,
+                                                            size_t A_rows, size_t A_cols,
+                                                            size_t num_thr);
+
+void transpose_dbl_cmplx_flt_cmplx_threads_avx_intr_8x8_col(const double complex* restrict A,
+                                                            float complex* restrict B,
+                                                            size_t A_rows, size_t A_cols,
+                                                            size_t num_thr);
+
+void transpose_flt_fp16_threads_avx_intr_16x16_row(const float* restrict A,
+                                                   transpose_fp16_t* restrict B,
+                                                   size_t A_rows, size_t A_cols,
+                                                   size_t num_thr);
+
+void transpose_flt_fp16_threads_avx_intr_16x16_col(const float* restrict A,
+                                                   transpose_fp16_t* restrict B,
+                                                   size_t A_rows, size_t A_cols,
+                                                   size_t num_thr);
+
+void transpose_flt_bf16_threads_avx_intr_16x16_row(const float* restrict A,
+                                                   transpose_bf16_t* restrict B,
+                                                   size_t A_rows, size_t A_cols,
+                                                   size_t num_thr);
+
+void transpose_flt_bf16_threads_avx_intr_16x16_col(const float* restrict A,
+                                                   transpose_bf16_t* restrict B,
+                                                   size_t A_rows, size_t A_cols,
+                                                   size_t num_thr);
+
+void transpose_flt_cmplx_fp16_cmplx_threads_avx_intr_8x8_row(const float complex* restrict A,
+                                                             transpose_fp16_cmplx_t* restrict B,
+                                                             size_t A_rows, size_t A_cols,
+                                                             size_t num_thr);
+
+void transpose_flt_cmplx_fp16_cmplx_threads_avx_intr_8x8_col(const float complex* restrict A,
+                                                             transpose_fp16_cmplx_t* restrict B,
+                                                             size_t A_rows, size_t A_cols,
+                                                             size_t num_thr);
+
+void transpose_flt_cmplx_bf16_cmplx_threads_avx_intr_8x8_row(const float complex* restrict A,
+                                                             transpose_bf16_cmplx_t* restrict B,
+                                                             size_t A_rows, size_t A_cols,
+                                                             size_t num_thr);
+
+void transpose_flt_cmplx_bf16_cmplx_threads_avx_intr_8x8_col(const float complex* restrict A,
+                                                             transpose_bf16_cmplx_t* restrict B,
+                                                             size_t A_rows, size_t A_cols,
+                                                             size_t num_thr);
+
+/*
+ * Split-complex variants that (de)interleave real and imaginary planes while
+ * transposing.  See transpose.h.
+ */
+void transpose_flt_cmplx_split_threads_avx_intr_16x16_row(const float complex* restrict A,
+                                                          float* restrict B_re,
+                                                          float* restrict B_im,
+                                                          size_t A_rows, size_t A_cols,
+                                                          size_t num_thr);
+
+void transpose_flt_cmplx_split_threads_avx_intr_16x16_col(const float complex* restrict A,
+                                                          float* restrict B_re,
+                                                          float* restrict B_im,
+                                                          size_t A_rows, size_t A_cols,
+                                                          size_t num_thr);
+
+void transpose_dbl_cmplx_split_threads_avx_intr_8x8_row(const double complex* restrict A,
+                                                        double* restrict B_re,
+                                                        double* restrict B_im,
+                                                        size_t A_rows, size_t A_cols,
+                                                        size_t num_thr);
+
+void transpose_dbl_cmplx_split_threads_avx_intr_8x8_col(const double complex* restrict A,
+                                                        double* restrict B_re,
+                                                        double* restrict B_im,
+                                                        size_t A_rows, size_t A_cols,
+                                                        size_t num_thr);
+
+void transpose_flt_split_cmplx_threads_avx_intr_16x16_row(const float* restrict A_re,
+                                                          const float* restrict A_im,
+                                                          float complex* restrict B,
+                                                          size_t A_rows, size_t A_cols,
+                                                          size_t num_thr);
+
+void transpose_flt_split_cmplx_threads_avx_intr_16x16_col(const float* restrict A_re,
+                                                          const float* restrict A_im,
+                                                          float complex* restrict B,
+                                                          size_t A_rows, size_t A_cols,
+                                                          size_t num_thr);
+
+void transpose_dbl_split_cmplx_threads_avx_intr_8x8_row(const double* restrict A_re,
+                                                        const double* restrict A_im,
+                                                        double complex* restrict B,
+                                                        size_t A_rows, size_t A_cols,
+                                                        size_t num_thr);
+
+void transpose_dbl_split_cmplx_threads_avx_intr_8x8_col(const double* restrict A_re,
+                                                        const double* restrict A_im,
+                                                        double complex* restrict B,
+                                                        size_t A_rows, size_t A_cols,
+                                                        size_t num_thr);
+
+/*
+ * Epilogue variants that scale, conjugate, window and/or twiddle each element
+ * as described by epi while transposing.  See transpose-epi.h.
+ */
+void transpose_flt_cmplx_threads_avx_intr_8x8_row_epi(const float complex* restrict A,
+                                                      float complex* restrict B,
+                                                      size_t A_rows, size_t A_cols,
+                                                      const struct transpose_epi_flt_cmplx *epi,
+                                                      size_t num_thr);
+
+void transpose_flt_cmplx_threads_avx_intr_8x8_col_epi(const float complex* restrict A,
+                                                      float complex* restrict B,
+                                                      size_t A_rows, size_t A_cols,
+                                                      const struct transpose_epi_flt_cmplx *epi,
+                                                      size_t num_thr);
+
+void transpose_dbl_cmplx_threads_avx_intr_4x4_row_epi(const double complex* restrict A,
+                                                      double complex* restrict B,
+                                                      size_t A_rows, size_t A_cols,
+                                                      const struct transpose_epi_dbl_cmplx *epi,
+                                                      size_t num_thr);
+
+void transpose_dbl_cmplx_threads_avx_intr_4x4_col_epi(const double complex* restrict A,
+                                                      double complex* restrict B,
+                                                      size_t A_rows, size_t A_cols,
+                                                      const struct transpose_epi_dbl_cmplx *epi,
+                                                      size_t num_thr);
+
+/*
+ * Strided variants: A has row stride lda and B has row stride ldb, and each
+ * output element is scaled by alpha.  See transpose.h.
+ */
+void transpose_dbl_threads_avx_intr_8x8_row_ld(const double* restrict A,
+                                               size_t lda,
+                                               double* restrict B,
+                                               size_t ldb,
+                                               size_t A_rows,
+                                               size_t A_cols,
+                                               double alpha,
+                                               size_t num_thr);
+
+void transpose_dbl_threads_avx_intr_8x8_col_ld(const double* restrict A,
+                                               size_t lda,
+                                               double* restrict B,
+                                               size_t ldb,
+                                               size_t A_rows,
+                                               size_t A_cols,
+                                               double alpha,
+                                               size_t num_thr);
+
+void transpose_flt_threads_avx_intr_16x16_row_ld(const float* restrict A,
+                                                 size_t lda,
+                                                 float* restrict B,
+                                                 size_t ldb,
+                                                 size_t A_rows,
+                                                 size_t A_cols,
+                                                 float alpha,
+                                                 size_t num_thr);
+
+void transpose_flt_threads_avx_intr_16x16_col_ld(const float* restrict A,
+                                                 size_t lda,
+                                                 float* restrict B,
+                                                 size_t ldb,
+                                                 size_t A_rows,
+                                                 size_t A_cols,
+                                                 float alpha,
+                                                 size_t num_thr);
+
+void transpose_flt_cmplx_threads_avx_intr_8x8_row_ld(const float complex* restrict A,
+                                                     size_t lda,
+                                                     float complex* restrict B,
+                                                     size_t ldb,
+                                                     size_t A_rows,
+                                                     size_t A_cols,
+                                                     float complex alpha,
+                                                     size_t num_thr);
+
+void transpose_flt_cmplx_threads_avx_intr_8x8_col_ld(const float complex* restrict A,
+                                                     size_t lda,
+                                                     float complex* restrict B,
+                                                     size_t ldb,
+                                                     size_t A_rows,
+                                                     size_t A_cols,
+                                                     float complex alpha,
+                                                     size_t num_thr);
+
+void transpose_dbl_cmplx_threads_avx_intr_4x4_row_ld(const double complex* restrict A,
+                                                     size_t lda,
+                                                     double complex* restrict B,
+                                                     size_t ldb,
+                                                     size_t A_rows,
+                                                     size_t A_cols,
+                                                     double complex alpha,
+                                                     size_t num_thr);
+
+void transpose_dbl_cmplx_threads_avx_intr_4x4_col_ld(const double complex* restrict A,
+                                                     size_t lda,
+                                                     double complex* restrict B,
+                                                     size_t ldb,
+                                                     size_t A_rows,
+                                                     size_t A_cols,
+                                                     double complex alpha,
+                                                     size_t num_thr);
+
+/*
+ * Write-combining variants: each thread stages its tiles in a buffer of its own
+ * and streams whole cache lines to B.  See transpose-wc.h.
+ */
+void transpose_dbl_threads_avx_intr_8x8_row_wc(const double* restrict A,
+                                               double* restrict B,
+                                               size_t A_rows, size_t A_cols,
+                                               size_t num_thr);
+
+void transpose_dbl_threads_avx_intr_8x8_col_wc(const double* restrict A,
+                                               double* restrict B,
+                                               size_t A_rows, size_t A_cols,
+                                               size_t num_thr);
+
+void transpose_flt_threads_avx_intr_16x16_row_wc(const float* restrict A,
+                                                 float* restrict B,
+                                                 size_t A_rows, size_t A_cols,
+                                                 size_t num_thr);
+
+void transpose_flt_threads_avx_intr_16x16_col_wc(const float* restrict A,
+                                                 float* restrict B,
+                                                 size_t A_rows, size_t A_cols,
+                                                 size_t num_thr);
+
+void transpose_flt_cmplx_threads_avx_intr_8x8_row_wc(const float complex* restrict A,
+                                                     float complex* restrict B,
+                                                     size_t A_rows, size_t A_cols,
+                                                     size_t num_thr);
+
+void transpose_flt_cmplx_threads_avx_intr_8x8_col_wc(const float complex* restrict A,
+                                                     float complex* restrict B,
+                                                     size_t A_rows, size_t A_cols,
+                                                     size_t num_thr);
+
+void transpose_dbl_cmplx_threads_avx_intr_4x4_row_wc(const double complex* restrict A,
+                                                     double complex* restrict B,
+                                                     size_t A_rows, size_t A_cols,
+                                                     size_t num_thr);
+
+void transpose_dbl_cmplx_threads_avx_intr_4x4_col_wc(const double complex* restrict A,
+                                                     double complex* restrict B,
+                                                     size_t A_rows, size_t A_cols,
+                                                     size_t num_thr);
+
 #endif /* TRANSPOSE_THREADS_AVX_H */
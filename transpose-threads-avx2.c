@@ -0,0 +1,186 @@
+/**
+ * Transpose functions.
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @date 2026-10-17
+ */
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// intrinsics
+#include <immintrin.h>
+
+#include "cpu-features.h"
+#include "transpose-threads-avx2.h"
+#include "transpose-avx2-kernels.h"
+#include "transpose-pool.h"
+
+struct tr_thread_arg {
+    const void* restrict A;
+    void* restrict B;
+    size_t A_rows, A_cols, r_min, r_max, c_min, c_max, thr_num;
+};
+
+static void tt_arg_init(struct tr_thread_arg *tt_arg,
+                        const void* restrict A, void* restrict B,
+                        size_t A_rows, size_t A_cols,
+                        size_t r_min, size_t r_max, size_t c_min, size_t c_max,
+                        size_t thr_num)
+{
+    tt_arg->A = A;
+    tt_arg->B = B;
+    tt_arg->A_rows = A_rows;
+    tt_arg->A_cols = A_cols;
+    tt_arg->r_min = r_min;
+    tt_arg->r_max = r_max;
+    tt_arg->c_min = c_min;
+    tt_arg->c_max = c_max;
+    tt_arg->thr_num = thr_num;
+}
+
+CPU_TARGET_AVX2
+static void *transpose_thread_blocked_dbl(void *args) {
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    const double* restrict A = tt_arg->A;
+    double* restrict B = tt_arg->B;
+    size_t start_row_block_num, end_row_block_num, row_block_num;
+    size_t start_col_block_num, end_col_block_num, col_block_num;
+    size_t r_min, c_min;
+
+    assert(tt_arg->A_rows % 4 == 0);
+    assert(tt_arg->A_cols % 4 == 0);
+
+    start_row_block_num = tt_arg->r_min / 4;
+    end_row_block_num = tt_arg->r_max / 4;
+    start_col_block_num = tt_arg->c_min / 4;
+    end_col_block_num = tt_arg->c_max / 4;
+
+    for (row_block_num = start_row_block_num; row_block_num < end_row_block_num; row_block_num++) {
+        r_min = row_block_num * 4;
+        for (col_block_num = start_col_block_num; col_block_num < end_col_block_num; col_block_num++) {
+            c_min = col_block_num * 4;
+            transpose_dbl_avx2_intr_4x4_blk(&A[r_min * tt_arg->A_cols + c_min],
+                                           &B[c_min * tt_arg->A_rows + r_min],
+                                           tt_arg->A_cols, tt_arg->A_rows);
+        }
+    }
+
+    return (void *)tt_arg->thr_num;
+}
+
+CPU_TARGET_AVX2
+static void *transpose_thread_blocked_flt(void *args) {
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    const float* restrict A = tt_arg->A;
+    float* restrict B = tt_arg->B;
+    size_t start_row_block_num, end_row_block_num, row_block_num;
+    size_t start_col_block_num, end_col_block_num, col_block_num;
+    size_t r_min, c_min;
+
+    assert(tt_arg->A_rows % 8 == 0);
+    assert(tt_arg->A_cols % 8 == 0);
+
+    start_row_block_num = tt_arg->r_min / 8;
+    end_row_block_num = tt_arg->r_max / 8;
+    start_col_block_num = tt_arg->c_min / 8;
+    end_col_block_num = tt_arg->c_max / 8;
+
+    for (row_block_num = start_row_block_num; row_block_num < end_row_block_num; row_block_num++) {
+        r_min = row_block_num * 8;
+        for (col_block_num = start_col_block_num; col_block_num < end_col_block_num; col_block_num++) {
+            c_min = col_block_num * 8;
+            transpose_flt_avx2_intr_8x8_blk(&A[r_min * tt_arg->A_cols + c_min],
+                                           &B[c_min * tt_arg->A_rows + r_min],
+                                           tt_arg->A_cols, tt_arg->A_rows);
+        }
+    }
+
+    return (void *)tt_arg->thr_num;
+}
+
+/*
+ * Divide n_blks blocks of size blk as evenly as possible among the threads and
+ * return the element range [*min, *max) assigned to thread thr_num.
+ */
+static void thread_blk_range(size_t n_blks, size_t blk, size_t num_thr,
+                             size_t thr_num, size_t *min, size_t *max)
+{
+    size_t num_thr_with_max_blks = n_blks % num_thr;
+    size_t min_blks_per_thread = n_blks / num_thr;
+    size_t max_blks_per_thread = min_blks_per_thread + 1;
+    size_t blk_min, blk_max;
+
+    if (thr_num < num_thr_with_max_blks) {
+        blk_min = thr_num * max_blks_per_thread;
+        blk_max = blk_min + max_blks_per_thread;
+    } else {
+        blk_min = num_thr_with_max_blks * max_blks_per_thread +
+                  (thr_num - num_thr_with_max_blks) * min_blks_per_thread;
+        blk_max = blk_min + min_blks_per_thread;
+    }
+    *min = blk_min * blk;
+    *max = blk_max * blk;
+}
+
+static void transpose_threads(const void* restrict A, void* restrict B,
+                              size_t A_rows, size_t A_cols, size_t num_thr,
+                              size_t blk, int by_row,
+                              void *(*start_routine)(void *))
+{
+    size_t thr_num, r_min, r_max, c_min, c_max;
+    struct tr_thread_arg *args = transpose_pool_begin(num_thr, sizeof(*args));
+
+    for (thr_num = 0; thr_num < num_thr; thr_num++) {
+        // divide the row or column blocks as evenly as possible
+        if (by_row) {
+            thread_blk_range(A_rows / blk, blk, num_thr, thr_num, &r_min, &r_max);
+            c_min = 0;
+            c_max = A_cols;
+        } else {
+            r_min = 0;
+            r_max = A_rows;
+            thread_blk_range(A_cols / blk, blk, num_thr, thr_num, &c_min, &c_max);
+        }
+        tt_arg_init(&args[thr_num], A, B, A_rows, A_cols,
+                    r_min, r_max, c_min, c_max, thr_num);
+    }
+
+    transpose_pool_run(start_routine);
+}
+
+void transpose_dbl_threads_avx2_intr_4x4_row(const double* restrict A,
+                                             double* restrict B,
+                                             size_t A_rows, size_t A_cols,
+                                             size_t num_thr)
+{
+    transpose_threads(A, B, A_rows, A_cols, num_thr, 4, 1,
+                      &transpose_thread_blocked_dbl);
+}
+
+void transpose_dbl_threads_avx2_intr_4x4_col(const double* restrict A,
+                                             double* restrict B,
+                                             size_t A_rows, size_t A_cols,
+                                             size_t num_thr)
+{
+    transpose_threads(A, B, A_rows, A_cols, num_thr, 4, 0,
+                      &transpose_thread_blocked_dbl);
+}
+
+void transpose_flt_threads_avx2_intr_8x8_row(const float* restrict A,
+                                             float* restrict B,
+                                             size_t A_rows, size_t A_cols,
+                                             size_t num_thr)
+{
+    transpose_threads(A, B, A_rows, A_cols, num_thr, 8, 1,
+                      &transpose_thread_blocked_flt);
+}
+
+void transpose_flt_threads_avx2_intr_8x8_col(const float* restrict A,
+                                             float* restrict B,
+                                             size_t A_rows, size_t A_cols,
+                                             size_t num_thr)
+{
+    transpose_threads(A, B, A_rows, A_cols, num_thr, 8, 0,
+                      &transpose_thread_blocked_flt);
+}
@@ -0,0 +1,32 @@
+/**
+ * Transpose functions.
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_THREADS_AVX2_H
+#define TRANSPOSE_THREADS_AVX2_H
+
+#include <stdlib.h>
+
+void transpose_dbl_threads_avx2_intr_4x4_row(const double* restrict A,
+                                             double* restrict B,
+                                             size_t A_rows, size_t A_cols,
+                                             size_t num_thr);
+
+void transpose_dbl_threads_avx2_intr_4x4_col(const double* restrict A,
+                                             double* restrict B,
+                                             size_t A_rows, size_t A_cols,
+                                             size_t num_thr);
+
+void transpose_flt_threads_avx2_intr_8x8_row(const float* restrict A,
+                                             float* restrict B,
+                                             size_t A_rows, size_t A_cols,
+                                             size_t num_thr);
+
+void transpose_flt_threads_avx2_intr_8x8_col(const float* restrict A,
+                                             float* restrict B,
+                                             size_t A_rows, size_t A_cols,
+                                             size_t num_thr);
+
+#endif /* TRANSPOSE_THREADS_AVX2_H */
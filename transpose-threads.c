@@ -5,31 +5,49 @@
  * @author Connor Imes <cimes@isi.edu>
  * @date 2019-08-06
  */
-#include <errno.h>
+#include <complex.h>
 #include <stdio.h>
 #include <stdlib.h>
-#include <pthread.h>
 
+#include "transpose.h"
+#include "transpose-blk.h"
+#include "transpose-nt.h"
+#include "transpose-order.h"
+#include "transpose-pool.h"
+#include "transpose-prefetch.h"
 #include "transpose-threads.h"
-#include "util.h"
+#include "transpose-wc.h"
 
 struct tr_thread_arg {
     const void* restrict A;
     void* restrict B;
-    size_t A_rows, A_cols, r_min, r_max, c_min, c_max, blk_rows, blk_cols, thr_num;
+    // alpha points to a scale factor of the element type, or is NULL for none
+    const void *alpha;
+    size_t A_rows, A_cols, lda, ldb, r_min, r_max, c_min, c_max, blk_rows, blk_cols, thr_num;
+    // only used by the cycle-following and recursive transposes
+    size_t num_thr;
+    // inner tile size of the two-level blocked transposes
+    size_t sub_rows, sub_cols;
+    // only used by the prefetching transposes
+    size_t pf_dist;
+    enum transpose_pf_hint pf_hint;
 };
 
 static void tt_arg_init(struct tr_thread_arg *tt_arg,
-                        const void* restrict A, void* restrict B,
-                        size_t A_rows, size_t A_cols,
+                        const void* restrict A, size_t lda,
+                        void* restrict B, size_t ldb,
+                        size_t A_rows, size_t A_cols, const void *alpha,
                         size_t r_min, size_t r_max, size_t c_min, size_t c_max,
                         size_t blk_rows, size_t blk_cols,
                         size_t thr_num)
 {
     tt_arg->A = A;
     tt_arg->B = B;
+    tt_arg->alpha = alpha;
     tt_arg->A_rows = A_rows;
     tt_arg->A_cols = A_cols;
+    tt_arg->lda = lda;
+    tt_arg->ldb = ldb;
     tt_arg->r_min = r_min;
     tt_arg->r_max = r_max;
     tt_arg->c_min = c_min;
@@ -39,107 +57,326 @@ static void tt_arg_init(struct tr_thread_arg *tt_arg,
     tt_arg->thr_num = thr_num;
 }
 
-#define TRANSPOSE_BLK(A, B, A_rows, A_cols, r_min, c_min, r_max, c_max) { \
-    size_t r, c; \
-    for (r = (r_min); r < (r_max); r++) { \
-        for (c = (c_min); c < (c_max); c++) { \
-            (B)[(c) * (A_rows) + (r)] = (A)[(r) * (A_cols) + (c)]; \
+// scale by *tt_arg->alpha, or not at all with the width-generic kernel for w
+// byte elements; every thread reaches the same streaming store decision for
+// the whole output
+#define TRANSPOSE_BLK_ARG(datatype, w, fn_store, tt_arg, \
+                          r_min, c_min, r_max, c_max) { \
+    const datatype* restrict _A = (const datatype* restrict)(tt_arg)->A; \
+    datatype* restrict _B = (datatype* restrict)(tt_arg)->B; \
+    const int _nt = transpose_nt_use((tt_arg)->A_cols * (tt_arg)->ldb * \
+                                     sizeof(datatype)); \
+    if ((tt_arg)->alpha) { \
+        const datatype _alpha = *(const datatype *)(tt_arg)->alpha; \
+        if (_nt) { \
+            TRANSPOSE_BLK_LD_NT(_A, (tt_arg)->lda, _B, (tt_arg)->ldb, _alpha, \
+                                r_min, c_min, r_max, c_max, fn_store); \
+        } else { \
+            TRANSPOSE_BLK_LD(_A, (tt_arg)->lda, _B, (tt_arg)->ldb, _alpha, \
+                             r_min, c_min, r_max, c_max); \
         } \
+    } else if (_nt) { \
+        transpose_blk_w##w##_nt(_A, (tt_arg)->lda, _B, (tt_arg)->ldb, \
+                                r_min, c_min, r_max, c_max); \
+    } else { \
+        transpose_blk_w##w(_A, (tt_arg)->lda, _B, (tt_arg)->ldb, \
+                           r_min, c_min, r_max, c_max); \
     } \
 }
 
-static void *transpose_thread_flt(void *args)
+/*
+ * Define the thread routines transpose_thread_<suffix>(), which transposes the
+ * thread's whole range, and transpose_thread_blocked_<suffix>(), which walks
+ * it in blk_rows x blk_cols blocks, for a datatype that is w bytes wide.
+ */
+#define TRANSPOSE_THREAD_DEFINE(suffix, datatype, w, fn_store) \
+static void *transpose_thread_##suffix(void *args) \
+{ \
+    const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args; \
+    TRANSPOSE_BLK_ARG(datatype, w, fn_store, tt_arg, \
+                      tt_arg->r_min, tt_arg->c_min, \
+                      tt_arg->r_max, tt_arg->c_max); \
+    transpose_nt_fence(); \
+    return (void *)tt_arg->thr_num; \
+} \
+\
+static void *transpose_thread_blocked_##suffix(void *args) \
+{ \
+    const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args; \
+    const size_t br = tt_arg->blk_rows, bc = tt_arg->blk_cols; \
+    size_t rb, cb; \
+    /* a thread takes the blocks whose index falls in its range */ \
+    for (rb = tt_arg->r_min / br * br; rb < tt_arg->r_max / br * br; \
+         rb += br) { \
+        for (cb = tt_arg->c_min / bc * bc; cb < tt_arg->c_max / bc * bc; \
+             cb += bc) { \
+            TRANSPOSE_BLK_ARG(datatype, w, fn_store, tt_arg, rb, cb, \
+                              rb + br, cb + bc); \
+        } \
+    } \
+    transpose_nt_fence(); \
+    return (void *)tt_arg->thr_num; \
+}
+
+TRANSPOSE_THREAD_DEFINE(flt, float, 4, transpose_nt_store_flt)
+TRANSPOSE_THREAD_DEFINE(dbl, double, 8, transpose_nt_store_dbl)
+TRANSPOSE_THREAD_DEFINE(flt_cmplx, float complex, 8,
+                        transpose_nt_store_flt_cmplx)
+TRANSPOSE_THREAD_DEFINE(dbl_cmplx, double complex, 16,
+                        transpose_nt_store_dbl_cmplx)
+
+// swap every tile on or above the diagonal whose top-left corner lies in the
+// thread's row and column range with its mirror tile
+#define TRANSPOSE_SWAP_BLK_ARG(datatype, tt_arg) { \
+    datatype *_A = (datatype *)(tt_arg)->B; \
+    size_t _n = (tt_arg)->A_rows, _blk = (tt_arg)->blk_rows; \
+    size_t _r, _c; \
+    for (_r = (tt_arg)->r_min; _r < (tt_arg)->r_max; _r += _blk) { \
+        _c = _r > (tt_arg)->c_min ? _r : (tt_arg)->c_min; \
+        for (; _c < (tt_arg)->c_max; _c += _blk) { \
+            TRANSPOSE_SWAP_BLK(datatype, _A, _n, _r, _c, \
+                               _n - _r < _blk ? _n : _r + _blk, \
+                               _n - _c < _blk ? _n : _c + _blk); \
+        } \
+    } \
+}
+
+static void *transpose_thread_inplace_flt(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
+    TRANSPOSE_SWAP_BLK_ARG(float, tt_arg);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_inplace_dbl(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
+    TRANSPOSE_SWAP_BLK_ARG(double, tt_arg);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_inplace_flt_cmplx(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
+    TRANSPOSE_SWAP_BLK_ARG(float complex, tt_arg);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_inplace_dbl_cmplx(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
+    TRANSPOSE_SWAP_BLK_ARG(double complex, tt_arg);
+    return (void *)tt_arg->thr_num;
+}
+
+// cycle leaders are searched in chunks of this many start indices, dealt to
+// the threads round-robin
+#define CYCLES_CHUNK 1024
+
+/*
+ * Threaded form of the cycle-following transpose in transpose.c.  Instead of a
+ * shared bitmap, a cycle is rotated only by the thread that owns its smallest
+ * index (the leader): starting from s, the cycle is walked without touching A
+ * until it returns to s (s is the leader) or reaches a smaller index (it is
+ * not).  The cycles are disjoint, so threads never write the same element.
+ */
+#define TRANSPOSE_CYCLES_ARG(datatype, tt_arg) { \
+    datatype *_A = (datatype *)(tt_arg)->B; \
+    const size_t _cols = (tt_arg)->A_cols; \
+    const size_t _m = (tt_arg)->A_rows * _cols - 1; \
+    const size_t _stride = (tt_arg)->num_thr * CYCLES_CHUNK; \
+    size_t _c, _s, _k, _j; \
+    datatype tmp; \
+    for (_c = (tt_arg)->thr_num * CYCLES_CHUNK + 1; _c < _m; _c += _stride) { \
+        for (_s = _c; _s < _c + CYCLES_CHUNK && _s < _m; _s++) { \
+            for (_j = _s * _cols % _m; _j > _s; _j = _j * _cols % _m); \
+            if (_j < _s) { \
+                continue; \
+            } \
+            tmp = _A[_s]; \
+            _k = _s; \
+            for (_j = _k * _cols % _m; _j != _s; _j = _k * _cols % _m) { \
+                _A[_k] = _A[_j]; \
+                _k = _j; \
+            } \
+            _A[_k] = tmp; \
+        } \
+    } \
+}
+
+static void *transpose_thread_cycles_flt(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
+    TRANSPOSE_CYCLES_ARG(float, tt_arg);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_cycles_dbl(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
+    TRANSPOSE_CYCLES_ARG(double, tt_arg);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_cycles_flt_cmplx(void *args)
 {
     const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
-    TRANSPOSE_BLK((const float* restrict)tt_arg->A,
-                  (float* restrict )tt_arg->B,
-                  tt_arg->A_rows, tt_arg->A_cols,
-                  tt_arg->r_min, tt_arg->c_min, tt_arg->r_max, tt_arg->c_max);
-    pthread_exit((void *)tt_arg->thr_num);
+    TRANSPOSE_CYCLES_ARG(float complex, tt_arg);
+    return (void *)tt_arg->thr_num;
 }
 
-static void *transpose_thread_dbl(void *args)
+static void *transpose_thread_cycles_dbl_cmplx(void *args)
 {
     const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
-    TRANSPOSE_BLK((const double* restrict)tt_arg->A,
-                  (double* restrict )tt_arg->B,
-                  tt_arg->A_rows, tt_arg->A_cols,
-                  tt_arg->r_min, tt_arg->c_min, tt_arg->r_max, tt_arg->c_max);
-    pthread_exit((void *)tt_arg->thr_num);
-}
-
-static void *transpose_thread_blocked_flt(void *args) {
-    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
-    const float* restrict A = tt_arg->A;
-    float* restrict B = tt_arg->B;
-    size_t start_row_block_num, end_row_block_num, row_block_num;
-    size_t start_col_block_num, end_col_block_num, col_block_num;
-    size_t r_block_min, r_block_max, c_block_min, c_block_max;
-    size_t r, c;
-
-    start_row_block_num = tt_arg->r_min / tt_arg->blk_rows;
-    end_row_block_num = tt_arg->r_max / tt_arg->blk_rows;
-    start_col_block_num = tt_arg->c_min / tt_arg->blk_cols;
-    end_col_block_num = tt_arg->c_max / tt_arg->blk_cols;
-
-    for (row_block_num = start_row_block_num; row_block_num < end_row_block_num; row_block_num++) {
-        for (col_block_num = start_col_block_num; col_block_num < end_col_block_num; col_block_num++) {
-            r_block_min = row_block_num * tt_arg->blk_rows;
-            c_block_min = col_block_num * tt_arg->blk_cols;
-            r_block_max = r_block_min + tt_arg->blk_rows;
-            c_block_max = c_block_min + tt_arg->blk_cols;
-
-            for (r = r_block_min; r < r_block_max; r++) {
-                for (c = c_block_min; c < c_block_max; c++) {
-                    B[c * tt_arg->A_rows + r] = A[r * tt_arg->A_cols + c];
-                }
-            }
+    TRANSPOSE_CYCLES_ARG(double complex, tt_arg);
+    return (void *)tt_arg->thr_num;
+}
+
+/*
+ * Parallel cache-oblivious transpose.  While more than one thread is left, the
+ * matrix is cut across its larger dimension (in whole base tiles, in proportion
+ * to the thread counts on each side), the first part going to the first
+ * threads and the second part to the others, until each thread has its part in
+ * args.  Each thread finishes its part with the serial recursion.  Threads left
+ * over when a part cannot be cut further get an empty part.
+ */
+static void transpose_recursive_split(const struct tr_thread_arg *tt_arg,
+                                      struct tr_thread_arg *args)
+{
+    struct tr_thread_arg lo, hi;
+    const size_t base = tt_arg->blk_rows;
+    const size_t nt_r = (tt_arg->r_max - tt_arg->r_min + base - 1) / base;
+    const size_t nt_c = (tt_arg->c_max - tt_arg->c_min + base - 1) / base;
+    size_t nt_lo, thr_num;
+
+    if (tt_arg->num_thr < 2 || (nt_r < 2 && nt_c < 2)) {
+        args[tt_arg->thr_num] = *tt_arg;
+        for (thr_num = 1; thr_num < tt_arg->num_thr; thr_num++) {
+            args[tt_arg->thr_num + thr_num] = *tt_arg;
+            args[tt_arg->thr_num + thr_num].thr_num += thr_num;
+            args[tt_arg->thr_num + thr_num].r_max = tt_arg->r_min;
         }
+        return;
     }
 
-    pthread_exit((void *)tt_arg->thr_num);
-}
-
-static void *transpose_thread_blocked_dbl(void *args) {
-    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
-    const double* restrict A = tt_arg->A;
-    double* restrict B = tt_arg->B;
-    size_t start_row_block_num, end_row_block_num, row_block_num;
-    size_t start_col_block_num, end_col_block_num, col_block_num;
-    size_t r_block_min, r_block_max, c_block_min, c_block_max;
-    size_t r, c;
-
-    start_row_block_num = tt_arg->r_min / tt_arg->blk_rows;
-    end_row_block_num = tt_arg->r_max / tt_arg->blk_rows;
-    start_col_block_num = tt_arg->c_min / tt_arg->blk_cols;
-    end_col_block_num = tt_arg->c_max / tt_arg->blk_cols;
-
-    for (row_block_num = start_row_block_num; row_block_num < end_row_block_num; row_block_num++) {
-        for (col_block_num = start_col_block_num; col_block_num < end_col_block_num; col_block_num++) {
-            r_block_min = row_block_num * tt_arg->blk_rows;
-            c_block_min = col_block_num * tt_arg->blk_cols;
-            r_block_max = r_block_min + tt_arg->blk_rows;
-            c_block_max = c_block_min + tt_arg->blk_cols;
-
-            for (r = r_block_min; r < r_block_max; r++) {
-                for (c = c_block_min; c < c_block_max; c++) {
-                    B[c * tt_arg->A_rows + r] = A[r * tt_arg->A_cols + c];
-                }
-            }
-        }
+    lo = *tt_arg;
+    hi = *tt_arg;
+    lo.num_thr = tt_arg->num_thr / 2;
+    hi.num_thr = tt_arg->num_thr - lo.num_thr;
+    hi.thr_num = tt_arg->thr_num + lo.num_thr;
+    nt_lo = (nt_r >= nt_c ? nt_r : nt_c) * lo.num_thr / tt_arg->num_thr;
+    if (!nt_lo) {
+        nt_lo = 1;
+    }
+    if (nt_r >= nt_c) {
+        lo.r_max = tt_arg->r_min + nt_lo * base;
+        hi.r_min = lo.r_max;
+    } else {
+        lo.c_max = tt_arg->c_min + nt_lo * base;
+        hi.c_min = lo.c_max;
     }
 
-    pthread_exit((void *)tt_arg->thr_num);
+    transpose_recursive_split(&lo, args);
+    transpose_recursive_split(&hi, args);
 }
 
-static void transpose_threads_row(const void* restrict A, void* restrict B,
-                                  size_t A_rows, size_t A_cols, size_t num_thr,
+static void *transpose_thread_recursive_flt(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
+    transpose_recursive_tiles(tt_arg->A, tt_arg->lda, tt_arg->B, tt_arg->ldb,
+                              tt_arg->r_min, tt_arg->r_max,
+                              tt_arg->c_min, tt_arg->c_max,
+                              tt_arg->blk_rows, transpose_tile_w4);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_recursive_dbl(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
+    transpose_recursive_tiles(tt_arg->A, tt_arg->lda, tt_arg->B, tt_arg->ldb,
+                              tt_arg->r_min, tt_arg->r_max,
+                              tt_arg->c_min, tt_arg->c_max,
+                              tt_arg->blk_rows, transpose_tile_w8);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_blocked2_flt(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
+    transpose_blocked2_tiles(tt_arg->A, tt_arg->lda, tt_arg->B, tt_arg->ldb,
+                             tt_arg->r_min, tt_arg->r_max,
+                             tt_arg->c_min, tt_arg->c_max,
+                             tt_arg->blk_rows, tt_arg->blk_cols,
+                             tt_arg->sub_rows, tt_arg->sub_cols,
+                             transpose_tile_w4);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_blocked2_dbl(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
+    transpose_blocked2_tiles(tt_arg->A, tt_arg->lda, tt_arg->B, tt_arg->ldb,
+                             tt_arg->r_min, tt_arg->r_max,
+                             tt_arg->c_min, tt_arg->c_max,
+                             tt_arg->blk_rows, tt_arg->blk_cols,
+                             tt_arg->sub_rows, tt_arg->sub_cols,
+                             transpose_tile_w8);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_blocked_pf_flt(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
+    transpose_blocked_pf_tiles(tt_arg->A, tt_arg->lda, tt_arg->B, tt_arg->ldb,
+                               sizeof(float), tt_arg->r_min, tt_arg->r_max,
+                               tt_arg->c_min, tt_arg->c_max,
+                               tt_arg->blk_rows, tt_arg->blk_cols,
+                               tt_arg->pf_dist, tt_arg->pf_hint,
+                               transpose_tile_w4);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_blocked_pf_dbl(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
+    transpose_blocked_pf_tiles(tt_arg->A, tt_arg->lda, tt_arg->B, tt_arg->ldb,
+                               sizeof(double), tt_arg->r_min, tt_arg->r_max,
+                               tt_arg->c_min, tt_arg->c_max,
+                               tt_arg->blk_rows, tt_arg->blk_cols,
+                               tt_arg->pf_dist, tt_arg->pf_hint,
+                               transpose_tile_w8);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_wc_flt(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
+    TRANSPOSE_WC_TILES(float, (const float *)tt_arg->A, tt_arg->lda,
+                       (float *)tt_arg->B, tt_arg->ldb,
+                       tt_arg->r_min, tt_arg->r_max,
+                       tt_arg->c_min, tt_arg->c_max, TRANSPOSE_TILE_FLT);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_wc_dbl(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
+    TRANSPOSE_WC_TILES(double, (const double *)tt_arg->A, tt_arg->lda,
+                       (double *)tt_arg->B, tt_arg->ldb,
+                       tt_arg->r_min, tt_arg->r_max,
+                       tt_arg->c_min, tt_arg->c_max, TRANSPOSE_TILE_DBL);
+    return (void *)tt_arg->thr_num;
+}
+
+static void transpose_threads_row(const void* restrict A, size_t lda,
+                                  void* restrict B, size_t ldb,
+                                  size_t A_rows, size_t A_cols,
+                                  const void *alpha, size_t num_thr,
                                   void *(*start_routine)(void *))
 {
     size_t thr_num, r_min, r_max;
     size_t num_thr_with_max_rows, min_rows_per_thread, max_rows_per_thread;
-    pthread_t *threads = assert_malloc(num_thr * sizeof(pthread_t));
-    struct tr_thread_arg *args = assert_malloc(num_thr * sizeof(struct tr_thread_arg));
+    struct tr_thread_arg *args = transpose_pool_begin(num_thr, sizeof(*args));
 
     // divide the rows as evenly as possible among the threads
     num_thr_with_max_rows = A_rows % num_thr;
@@ -155,37 +392,22 @@ static void transpose_threads_row(const void* restrict A, void* restrict B,
                     (thr_num - num_thr_with_max_rows) * min_rows_per_thread;
             r_max = r_min + min_rows_per_thread;
         }
-        tt_arg_init(&args[thr_num], A, B, A_rows, A_cols,
+        tt_arg_init(&args[thr_num], A, lda, B, ldb, A_rows, A_cols, alpha,
                     r_min, r_max, 0, A_cols, 0, 0, thr_num);
-        errno = pthread_create(&threads[thr_num], NULL, start_routine,
-                               &args[thr_num]);
-        if (errno) {
-            perror("pthread_create");
-            exit(errno);
-        }
-    }
-
-    // wait for the other threads
-    for (thr_num = 0; thr_num < num_thr; thr_num++) {
-        errno = pthread_join(threads[thr_num], NULL);
-        if (errno) {
-            perror("pthread_join");
-            exit(errno);
-        }
     }
 
-    free(args);
-    free(threads);
+    transpose_pool_run(start_routine);
 }
 
-static void transpose_threads_col(const void* restrict A, void* restrict B,
-                                  size_t A_rows, size_t A_cols, size_t num_thr,
+static void transpose_threads_col(const void* restrict A, size_t lda,
+                                  void* restrict B, size_t ldb,
+                                  size_t A_rows, size_t A_cols,
+                                  const void *alpha, size_t num_thr,
                                   void *(*start_routine)(void *))
 {
     size_t thr_num, c_min, c_max;
     size_t num_thr_with_max_cols, min_cols_per_thread, max_cols_per_thread;
-    pthread_t *threads = assert_malloc(num_thr * sizeof(pthread_t));
-    struct tr_thread_arg *args = assert_malloc(num_thr * sizeof(struct tr_thread_arg));
+    struct tr_thread_arg *args = transpose_pool_begin(num_thr, sizeof(*args));
 
     // divide the columns as evenly as possible among the threads
     num_thr_with_max_cols = A_cols % num_thr;
@@ -201,55 +423,160 @@ static void transpose_threads_col(const void* restrict A, void* restrict B,
                     (thr_num - num_thr_with_max_cols) * min_cols_per_thread;
             c_max = c_min + min_cols_per_thread;
         }
-        tt_arg_init(&args[thr_num], A, B, A_rows, A_cols,
+        tt_arg_init(&args[thr_num], A, lda, B, ldb, A_rows, A_cols, alpha,
                     0, A_rows, c_min, c_max, 0, 0, thr_num);
-        errno = pthread_create(&threads[thr_num], NULL, start_routine,
-                               &args[thr_num]);
-        if (errno) {
-            perror("pthread_create");
-            exit(errno);
+    }
+
+    transpose_pool_run(start_routine);
+}
+
+static void transpose_threads_blocked2(const void* restrict A, size_t lda,
+                                       void* restrict B, size_t ldb,
+                                       size_t A_rows, size_t A_cols,
+                                       const void *alpha, size_t num_thr,
+                                       size_t blk_rows, size_t blk_cols,
+                                       size_t sub_rows, size_t sub_cols,
+                                       size_t pf_dist,
+                                       enum transpose_pf_hint pf_hint,
+                                       int by_row,
+                                       void *(*start_routine)(void *))
+{
+    size_t r_min, r_max, c_min, c_max, thr_num, rows_per_thr, cols_per_thr;
+    struct tr_thread_arg *args = transpose_pool_begin(num_thr, sizeof(*args));
+
+    for (thr_num = 0; thr_num < num_thr; thr_num++) {
+        if (by_row) {
+            rows_per_thr = A_rows / num_thr;
+            r_min = thr_num * rows_per_thr;
+            // the last thread also takes the remainder rows
+            r_max = thr_num + 1 < num_thr ? r_min + rows_per_thr : A_rows;
+
+            c_min = 0;
+            c_max = A_cols;
+        } else {
+            r_min = 0;
+            r_max = A_rows;
+
+            cols_per_thr = A_cols / num_thr;
+            c_min = thr_num * cols_per_thr;
+            c_max = thr_num + 1 < num_thr ? c_min + cols_per_thr : A_cols;
         }
+
+        tt_arg_init(&args[thr_num], A, lda, B, ldb, A_rows, A_cols, alpha,
+                    r_min, r_max, c_min, c_max, blk_rows, blk_cols, thr_num);
+        args[thr_num].sub_rows = sub_rows;
+        args[thr_num].sub_cols = sub_cols;
+        args[thr_num].pf_dist = pf_dist;
+        args[thr_num].pf_hint = pf_hint;
     }
 
-    // wait for the other threads
+    transpose_pool_run(start_routine);
+}
+
+// single-level blocking is two-level blocking with one inner tile per block
+static void transpose_threads_blocked(const void* restrict A, size_t lda,
+                                      void* restrict B, size_t ldb,
+                                      size_t A_rows, size_t A_cols,
+                                      const void *alpha, size_t num_thr,
+                                      size_t blk_rows, size_t blk_cols,
+                                      int by_row,
+                                      void *(*start_routine)(void *))
+{
+    transpose_threads_blocked2(A, lda, B, ldb, A_rows, A_cols, alpha, num_thr,
+                               blk_rows, blk_cols, blk_rows, blk_cols,
+                               0, TRANSPOSE_PF_T0, by_row, start_routine);
+}
+
+/*
+ * Tile row i of the upper triangle holds nb - i tiles and tile column j holds
+ * j + 1, so equal row or column counts would leave the threads unbalanced.
+ * Instead, hand each thread a contiguous range of tile rows (or columns)
+ * holding about the same number of tiles.
+ */
+static void transpose_threads_blocked_inplace(void *A, size_t n,
+                                              size_t num_thr, size_t blk,
+                                              int by_row,
+                                              void *(*start_routine)(void *))
+{
+    size_t thr_num, nb, tiles, tiles_done, blk_min, blk_num;
+    size_t r_min, r_max, c_min, c_max;
+    struct tr_thread_arg *args = transpose_pool_begin(num_thr, sizeof(*args));
+
+    nb = (n + blk - 1) / blk;
+    tiles = nb * (nb + 1) / 2;
+    tiles_done = 0;
+    blk_num = 0;
     for (thr_num = 0; thr_num < num_thr; thr_num++) {
-        errno = pthread_join(threads[thr_num], NULL);
-        if (errno) {
-            perror("pthread_join");
-            exit(errno);
+        blk_min = blk_num;
+        while (blk_num < nb && tiles_done < tiles * (thr_num + 1) / num_thr) {
+            tiles_done += by_row ? nb - blk_num : blk_num + 1;
+            blk_num++;
         }
+        if (by_row) {
+            r_min = blk_min * blk;
+            r_max = blk_num * blk < n ? blk_num * blk : n;
+            c_min = 0;
+            c_max = n;
+        } else {
+            r_min = 0;
+            r_max = n;
+            c_min = blk_min * blk;
+            c_max = blk_num * blk < n ? blk_num * blk : n;
+        }
+        tt_arg_init(&args[thr_num], NULL, n, A, n, n, n, NULL,
+                    r_min, r_max, c_min, c_max, blk, blk, thr_num);
+    }
+
+    transpose_pool_run(start_routine);
+}
+
+static void transpose_threads_cycles_inplace(void *A,
+                                             size_t A_rows, size_t A_cols,
+                                             size_t num_thr,
+                                             void *(*start_routine)(void *))
+{
+    size_t thr_num;
+    struct tr_thread_arg *args = transpose_pool_begin(num_thr, sizeof(*args));
+
+    for (thr_num = 0; thr_num < num_thr; thr_num++) {
+        tt_arg_init(&args[thr_num], NULL, A_cols, A, A_rows, A_rows, A_cols,
+                    NULL, 0, A_rows, 0, A_cols, 0, 0, thr_num);
+        args[thr_num].num_thr = num_thr;
     }
 
-    free(args);
-    free(threads);
+    transpose_pool_run(start_routine);
 }
 
 void transpose_flt_threads_row(const float* restrict A, float* restrict B,
                                size_t A_rows, size_t A_cols,
                                size_t num_thr)
 {
-    transpose_threads_row(A, B, A_rows, A_cols, num_thr, &transpose_thread_flt);
+    transpose_threads_row(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                          &transpose_thread_flt);
 }
 
 void transpose_dbl_threads_row(const double* restrict A, double* restrict B,
                                size_t A_rows, size_t A_cols,
                                size_t num_thr)
 {
-    transpose_threads_row(A, B, A_rows, A_cols, num_thr, &transpose_thread_dbl);
+    transpose_threads_row(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                          &transpose_thread_dbl);
 }
 
 void transpose_flt_threads_col(const float* restrict A, float* restrict B,
                                size_t A_rows, size_t A_cols,
                                size_t num_thr)
 {
-    transpose_threads_col(A, B, A_rows, A_cols, num_thr, &transpose_thread_flt);
+    transpose_threads_col(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                          &transpose_thread_flt);
 }
 
 void transpose_dbl_threads_col(const double* restrict A, double* restrict B,
                                size_t A_rows, size_t A_cols,
                                size_t num_thr)
 {
-    transpose_threads_col(A, B, A_rows, A_cols, num_thr, &transpose_thread_dbl);
+    transpose_threads_col(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                          &transpose_thread_dbl);
 }
 
 void transpose_flt_threads_row_blocked(const float* restrict A,
@@ -258,188 +585,567 @@ void transpose_flt_threads_row_blocked(const float* restrict A,
                                        size_t num_thr,
                                        size_t blk_rows, size_t blk_cols)
 {
-    pthread_attr_t attr;
-    size_t r_min, r_max, c_min, c_max, thr_num, rows_per_thr;
+    transpose_threads_blocked(A, A_cols, B, A_rows, A_rows, A_cols, NULL,
+                              num_thr, blk_rows, blk_cols, 1,
+                              &transpose_thread_blocked_flt);
+}
+
+void transpose_dbl_threads_row_blocked(const double* restrict A,
+                                       double* restrict B,
+                                       size_t A_rows, size_t A_cols,
+                                       size_t num_thr,
+                                       size_t blk_rows, size_t blk_cols)
+{
+    transpose_threads_blocked(A, A_cols, B, A_rows, A_rows, A_cols, NULL,
+                              num_thr, blk_rows, blk_cols, 1,
+                              &transpose_thread_blocked_dbl);
+}
 
-    pthread_t *threads = assert_malloc(num_thr * sizeof(pthread_t));
-    struct tr_thread_arg *args = assert_malloc(num_thr * sizeof(struct tr_thread_arg));
+void transpose_flt_threads_col_blocked(const float* restrict A,
+                                       float* restrict B,
+                                       size_t A_rows, size_t A_cols,
+                                       size_t num_thr,
+                                       size_t blk_rows, size_t blk_cols)
+{
+    transpose_threads_blocked(A, A_cols, B, A_rows, A_rows, A_cols, NULL,
+                              num_thr, blk_rows, blk_cols, 0,
+                              &transpose_thread_blocked_flt);
+}
 
-    // initialize and set thread detached attribute
-    pthread_attr_init(&attr);
-    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+void transpose_dbl_threads_col_blocked(const double* restrict A,
+                                       double* restrict B,
+                                       size_t A_rows, size_t A_cols,
+                                       size_t num_thr,
+                                       size_t blk_rows, size_t blk_cols)
+{
+    transpose_threads_blocked(A, A_cols, B, A_rows, A_rows, A_cols, NULL,
+                              num_thr, blk_rows, blk_cols, 0,
+                              &transpose_thread_blocked_dbl);
+}
 
-    for (thr_num = 0; thr_num < num_thr; thr_num++) {
-        rows_per_thr = A_rows / num_thr;
-        r_min = thr_num * rows_per_thr;
-        r_max = r_min + rows_per_thr;
+void transpose_flt_cmplx_threads_row(const float complex* restrict A,
+                                     float complex* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t num_thr)
+{
+    transpose_threads_row(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                          &transpose_thread_flt_cmplx);
+}
 
-        c_min = 0;
-        c_max = A_cols;
+void transpose_flt_cmplx_threads_col(const float complex* restrict A,
+                                     float complex* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t num_thr)
+{
+    transpose_threads_col(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                          &transpose_thread_flt_cmplx);
+}
 
-        tt_arg_init(&args[thr_num], A, B, A_rows, A_cols,
-                    r_min, r_max, c_min, c_max, blk_rows, blk_cols, thr_num);
-        errno = pthread_create(&threads[thr_num], &attr, &transpose_thread_blocked_flt,
-                               &args[thr_num]);
+void transpose_dbl_cmplx_threads_row(const double complex* restrict A,
+                                     double complex* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t num_thr)
+{
+    transpose_threads_row(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                          &transpose_thread_dbl_cmplx);
+}
 
-        if (errno) {
-                perror("pthread_create");
-                exit(errno);
-        }
-    }
+void transpose_dbl_cmplx_threads_col(const double complex* restrict A,
+                                     double complex* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t num_thr)
+{
+    transpose_threads_col(A, A_cols, B, A_rows, A_rows, A_cols, NULL, num_thr,
+                          &transpose_thread_dbl_cmplx);
+}
 
-    // free attribute and wait for the other threads
-    pthread_attr_destroy(&attr);
-    for(thr_num = 0; thr_num < num_thr; thr_num++) {
-        errno = pthread_join(threads[thr_num], NULL);
-        if (errno) {
-            perror("pthread_join");
-            exit(errno);
-        }
-    }
+void transpose_flt_cmplx_threads_row_blocked(const float complex* restrict A,
+                                             float complex* restrict B,
+                                             size_t A_rows, size_t A_cols,
+                                             size_t num_thr,
+                                             size_t blk_rows, size_t blk_cols)
+{
+    transpose_threads_blocked(A, A_cols, B, A_rows, A_rows, A_cols, NULL,
+                              num_thr, blk_rows, blk_cols, 1,
+                              &transpose_thread_blocked_flt_cmplx);
+}
 
-    free(args);
-    free(threads);
+void transpose_flt_cmplx_threads_col_blocked(const float complex* restrict A,
+                                             float complex* restrict B,
+                                             size_t A_rows, size_t A_cols,
+                                             size_t num_thr,
+                                             size_t blk_rows, size_t blk_cols)
+{
+    transpose_threads_blocked(A, A_cols, B, A_rows, A_rows, A_cols, NULL,
+                              num_thr, blk_rows, blk_cols, 0,
+                              &transpose_thread_blocked_flt_cmplx);
 }
 
-void transpose_dbl_threads_row_blocked(const double* restrict A,
-                                       double* restrict B,
-                                       size_t A_rows, size_t A_cols,
-                                       size_t num_thr,
-                                       size_t blk_rows, size_t blk_cols)
+void transpose_dbl_cmplx_threads_row_blocked(const double complex* restrict A,
+                                             double complex* restrict B,
+                                             size_t A_rows, size_t A_cols,
+                                             size_t num_thr,
+                                             size_t blk_rows, size_t blk_cols)
 {
-    pthread_attr_t attr;
-    size_t r_min, r_max, c_min, c_max, thr_num, rows_per_thr;
-    pthread_t *threads = assert_malloc(num_thr * sizeof(pthread_t));
-    struct tr_thread_arg *args = assert_malloc(num_thr * sizeof(struct tr_thread_arg));
+    transpose_threads_blocked(A, A_cols, B, A_rows, A_rows, A_cols, NULL,
+                              num_thr, blk_rows, blk_cols, 1,
+                              &transpose_thread_blocked_dbl_cmplx);
+}
 
-    // initialize and set thread detached attribute
-    pthread_attr_init(&attr);
-    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+void transpose_dbl_cmplx_threads_col_blocked(const double complex* restrict A,
+                                             double complex* restrict B,
+                                             size_t A_rows, size_t A_cols,
+                                             size_t num_thr,
+                                             size_t blk_rows, size_t blk_cols)
+{
+    transpose_threads_blocked(A, A_cols, B, A_rows, A_rows, A_cols, NULL,
+                              num_thr, blk_rows, blk_cols, 0,
+                              &transpose_thread_blocked_dbl_cmplx);
+}
 
-    for (thr_num = 0; thr_num < num_thr; thr_num++) {
-        rows_per_thr = A_rows / num_thr;
-        r_min = thr_num * rows_per_thr;
-        r_max = r_min + rows_per_thr;
+void transpose_flt_threads_row_blocked2(const float* restrict A,
+                                        float* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t num_thr,
+                                        size_t blk_rows, size_t blk_cols,
+                                        size_t sub_rows, size_t sub_cols)
+{
+    transpose_threads_blocked2(A, A_cols, B, A_rows, A_rows, A_cols, NULL,
+                               num_thr, blk_rows, blk_cols, sub_rows, sub_cols,
+                               0, TRANSPOSE_PF_T0,
+                               1, &transpose_thread_blocked2_flt);
+}
 
-        c_min = 0;
-        c_max = A_cols;
+void transpose_flt_threads_col_blocked2(const float* restrict A,
+                                        float* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t num_thr,
+                                        size_t blk_rows, size_t blk_cols,
+                                        size_t sub_rows, size_t sub_cols)
+{
+    transpose_threads_blocked2(A, A_cols, B, A_rows, A_rows, A_cols, NULL,
+                               num_thr, blk_rows, blk_cols, sub_rows, sub_cols,
+                               0, TRANSPOSE_PF_T0,
+                               0, &transpose_thread_blocked2_flt);
+}
 
-        tt_arg_init(&args[thr_num], A, B, A_rows, A_cols,
-                    r_min, r_max, c_min, c_max, blk_rows, blk_cols, thr_num);
-        errno = pthread_create(&threads[thr_num], &attr, &transpose_thread_blocked_dbl,
-                               &args[thr_num]);
-        if (errno) {
-                perror("pthread_create");
-                exit(errno);
-        }
-    }
+void transpose_dbl_threads_row_blocked2(const double* restrict A,
+                                        double* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t num_thr,
+                                        size_t blk_rows, size_t blk_cols,
+                                        size_t sub_rows, size_t sub_cols)
+{
+    transpose_threads_blocked2(A, A_cols, B, A_rows, A_rows, A_cols, NULL,
+                               num_thr, blk_rows, blk_cols, sub_rows, sub_cols,
+                               0, TRANSPOSE_PF_T0,
+                               1, &transpose_thread_blocked2_dbl);
+}
 
-    // free attribute and wait for the other threads
-    pthread_attr_destroy(&attr);
-    for(thr_num = 0; thr_num < num_thr; thr_num++) {
-        errno = pthread_join(threads[thr_num], NULL);
-        if (errno) {
-            perror("pthread_join");
-            exit(errno);
-        }
-    }
+void transpose_dbl_threads_col_blocked2(const double* restrict A,
+                                        double* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t num_thr,
+                                        size_t blk_rows, size_t blk_cols,
+                                        size_t sub_rows, size_t sub_cols)
+{
+    transpose_threads_blocked2(A, A_cols, B, A_rows, A_rows, A_cols, NULL,
+                               num_thr, blk_rows, blk_cols, sub_rows, sub_cols,
+                               0, TRANSPOSE_PF_T0,
+                               0, &transpose_thread_blocked2_dbl);
+}
 
-    free(args);
-    free(threads);
+void transpose_flt_threads_row_blocked_pf(const float* restrict A,
+                                          float* restrict B,
+                                          size_t A_rows, size_t A_cols,
+                                          size_t num_thr,
+                                          size_t blk_rows, size_t blk_cols,
+                                          size_t pf_dist,
+                                          enum transpose_pf_hint pf_hint)
+{
+    transpose_threads_blocked2(A, A_cols, B, A_rows, A_rows, A_cols, NULL,
+                               num_thr, blk_rows, blk_cols, blk_rows, blk_cols,
+                               pf_dist, pf_hint, 1,
+                               &transpose_thread_blocked_pf_flt);
 }
 
-void transpose_flt_threads_col_blocked(const float* restrict A,
-                                       float* restrict B,
-                                       size_t A_rows, size_t A_cols,
-                                       size_t num_thr,
-                                       size_t blk_rows, size_t blk_cols)
+void transpose_flt_threads_col_blocked_pf(const float* restrict A,
+                                          float* restrict B,
+                                          size_t A_rows, size_t A_cols,
+                                          size_t num_thr,
+                                          size_t blk_rows, size_t blk_cols,
+                                          size_t pf_dist,
+                                          enum transpose_pf_hint pf_hint)
 {
-    pthread_attr_t attr;
-    size_t r_min, r_max, c_min, c_max, thr_num, cols_per_thr;
-    pthread_t *threads = assert_malloc(num_thr * sizeof(pthread_t));
-    struct tr_thread_arg *args = assert_malloc(num_thr * sizeof(struct tr_thread_arg));
+    transpose_threads_blocked2(A, A_cols, B, A_rows, A_rows, A_cols, NULL,
+                               num_thr, blk_rows, blk_cols, blk_rows, blk_cols,
+                               pf_dist, pf_hint, 0,
+                               &transpose_thread_blocked_pf_flt);
+}
 
-    // initialize and set thread detached attribute
-    pthread_attr_init(&attr);
-    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+void transpose_dbl_threads_row_blocked_pf(const double* restrict A,
+                                          double* restrict B,
+                                          size_t A_rows, size_t A_cols,
+                                          size_t num_thr,
+                                          size_t blk_rows, size_t blk_cols,
+                                          size_t pf_dist,
+                                          enum transpose_pf_hint pf_hint)
+{
+    transpose_threads_blocked2(A, A_cols, B, A_rows, A_rows, A_cols, NULL,
+                               num_thr, blk_rows, blk_cols, blk_rows, blk_cols,
+                               pf_dist, pf_hint, 1,
+                               &transpose_thread_blocked_pf_dbl);
+}
 
-    for (thr_num = 0; thr_num < num_thr; thr_num++) {
-        r_min = 0;
-        r_max = A_rows;
+void transpose_dbl_threads_col_blocked_pf(const double* restrict A,
+                                          double* restrict B,
+                                          size_t A_rows, size_t A_cols,
+                                          size_t num_thr,
+                                          size_t blk_rows, size_t blk_cols,
+                                          size_t pf_dist,
+                                          enum transpose_pf_hint pf_hint)
+{
+    transpose_threads_blocked2(A, A_cols, B, A_rows, A_rows, A_cols, NULL,
+                               num_thr, blk_rows, blk_cols, blk_rows, blk_cols,
+                               pf_dist, pf_hint, 0,
+                               &transpose_thread_blocked_pf_dbl);
+}
 
-        cols_per_thr = A_cols / num_thr;
-        c_min = thr_num * cols_per_thr;
-        c_max = c_min + cols_per_thr;
+void transpose_flt_threads_row_ld(const float* restrict A, size_t lda,
+                                  float* restrict B, size_t ldb,
+                                  size_t A_rows, size_t A_cols, float alpha,
+                                  size_t num_thr)
+{
+    transpose_threads_row(A, lda, B, ldb, A_rows, A_cols,
+                          alpha == 1 ? NULL : &alpha, num_thr,
+                          &transpose_thread_flt);
+}
 
-        tt_arg_init(&args[thr_num], A, B, A_rows, A_cols,
-                    r_min, r_max, c_min, c_max, blk_rows, blk_cols, thr_num);
-        errno = pthread_create(&threads[thr_num], &attr, &transpose_thread_blocked_flt,
-                               &args[thr_num]);
+void transpose_dbl_threads_row_ld(const double* restrict A, size_t lda,
+                                  double* restrict B, size_t ldb,
+                                  size_t A_rows, size_t A_cols, double alpha,
+                                  size_t num_thr)
+{
+    transpose_threads_row(A, lda, B, ldb, A_rows, A_cols,
+                          alpha == 1 ? NULL : &alpha, num_thr,
+                          &transpose_thread_dbl);
+}
 
-        if (errno) {
-                perror("pthread_create");
-                exit(errno);
-        }
-    }
+void transpose_flt_threads_col_ld(const float* restrict A, size_t lda,
+                                  float* restrict B, size_t ldb,
+                                  size_t A_rows, size_t A_cols, float alpha,
+                                  size_t num_thr)
+{
+    transpose_threads_col(A, lda, B, ldb, A_rows, A_cols,
+                          alpha == 1 ? NULL : &alpha, num_thr,
+                          &transpose_thread_flt);
+}
 
-    // free attribute and wait for the other threads
-    pthread_attr_destroy(&attr);
-    for(thr_num = 0; thr_num < num_thr; thr_num++) {
-        errno = pthread_join(threads[thr_num], NULL);
-        if (errno) {
-            perror("pthread_join");
-            exit(errno);
-        }
-    }
+void transpose_dbl_threads_col_ld(const double* restrict A, size_t lda,
+                                  double* restrict B, size_t ldb,
+                                  size_t A_rows, size_t A_cols, double alpha,
+                                  size_t num_thr)
+{
+    transpose_threads_col(A, lda, B, ldb, A_rows, A_cols,
+                          alpha == 1 ? NULL : &alpha, num_thr,
+                          &transpose_thread_dbl);
+}
 
-    free(args);
-    free(threads);
+void transpose_flt_threads_row_blocked_ld(const float* restrict A, size_t lda,
+                                          float* restrict B, size_t ldb,
+                                          size_t A_rows, size_t A_cols,
+                                          float alpha, size_t num_thr,
+                                          size_t blk_rows, size_t blk_cols)
+{
+    transpose_threads_blocked(A, lda, B, ldb, A_rows, A_cols,
+                              alpha == 1 ? NULL : &alpha,
+                              num_thr, blk_rows, blk_cols, 1,
+                              &transpose_thread_blocked_flt);
 }
 
-void transpose_dbl_threads_col_blocked(const double* restrict A,
-                                       double* restrict B,
-                                       size_t A_rows, size_t A_cols,
-                                       size_t num_thr,
-                                       size_t blk_rows, size_t blk_cols)
+void transpose_dbl_threads_row_blocked_ld(const double* restrict A, size_t lda,
+                                          double* restrict B, size_t ldb,
+                                          size_t A_rows, size_t A_cols,
+                                          double alpha, size_t num_thr,
+                                          size_t blk_rows, size_t blk_cols)
 {
-    pthread_attr_t attr;
-    size_t r_min, r_max, c_min, c_max, thr_num, cols_per_thr;
-    pthread_t *threads = assert_malloc(num_thr * sizeof(pthread_t));
-    struct tr_thread_arg *args = assert_malloc(num_thr * sizeof(struct tr_thread_arg));
+    transpose_threads_blocked(A, lda, B, ldb, A_rows, A_cols,
+                              alpha == 1 ? NULL : &alpha,
+                              num_thr, blk_rows, blk_cols, 1,
+                              &transpose_thread_blocked_dbl);
+}
 
-    // initialize and set thread detached attribute
-    pthread_attr_init(&attr);
-    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+void transpose_flt_threads_col_blocked_ld(const float* restrict A, size_t lda,
+                                          float* restrict B, size_t ldb,
+                                          size_t A_rows, size_t A_cols,
+                                          float alpha, size_t num_thr,
+                                          size_t blk_rows, size_t blk_cols)
+{
+    transpose_threads_blocked(A, lda, B, ldb, A_rows, A_cols,
+                              alpha == 1 ? NULL : &alpha,
+                              num_thr, blk_rows, blk_cols, 0,
+                              &transpose_thread_blocked_flt);
+}
 
-    for (thr_num = 0; thr_num < num_thr; thr_num++) {
-        r_min = 0;
-        r_max = A_rows;
+void transpose_dbl_threads_col_blocked_ld(const double* restrict A, size_t lda,
+                                          double* restrict B, size_t ldb,
+                                          size_t A_rows, size_t A_cols,
+                                          double alpha, size_t num_thr,
+                                          size_t blk_rows, size_t blk_cols)
+{
+    transpose_threads_blocked(A, lda, B, ldb, A_rows, A_cols,
+                              alpha == 1 ? NULL : &alpha,
+                              num_thr, blk_rows, blk_cols, 0,
+                              &transpose_thread_blocked_dbl);
+}
 
-        cols_per_thr = A_cols / num_thr;
-        c_min = thr_num * cols_per_thr;
-        c_max = c_min + cols_per_thr;
+void transpose_flt_cmplx_threads_row_ld(const float complex* restrict A,
+                                        size_t lda,
+                                        float complex* restrict B, size_t ldb,
+                                        size_t A_rows, size_t A_cols,
+                                        float complex alpha, size_t num_thr)
+{
+    transpose_threads_row(A, lda, B, ldb, A_rows, A_cols,
+                          alpha == 1 ? NULL : &alpha, num_thr,
+                          &transpose_thread_flt_cmplx);
+}
 
-        tt_arg_init(&args[thr_num], A, B, A_rows, A_cols,
-                    r_min, r_max, c_min, c_max, blk_rows, blk_cols, thr_num);
-        errno = pthread_create(&threads[thr_num], &attr, &transpose_thread_blocked_dbl,
-                               &args[thr_num]);
+void transpose_flt_cmplx_threads_col_ld(const float complex* restrict A,
+                                        size_t lda,
+                                        float complex* restrict B, size_t ldb,
+                                        size_t A_rows, size_t A_cols,
+                                        float complex alpha, size_t num_thr)
+{
+    transpose_threads_col(A, lda, B, ldb, A_rows, A_cols,
+                          alpha == 1 ? NULL : &alpha, num_thr,
+                          &transpose_thread_flt_cmplx);
+}
 
-        if (errno) {
-                perror("pthread_create");
-                exit(errno);
-        }
+void transpose_dbl_cmplx_threads_row_ld(const double complex* restrict A,
+                                        size_t lda,
+                                        double complex* restrict B, size_t ldb,
+                                        size_t A_rows, size_t A_cols,
+                                        double complex alpha, size_t num_thr)
+{
+    transpose_threads_row(A, lda, B, ldb, A_rows, A_cols,
+                          alpha == 1 ? NULL : &alpha, num_thr,
+                          &transpose_thread_dbl_cmplx);
+}
+
+void transpose_dbl_cmplx_threads_col_ld(const double complex* restrict A,
+                                        size_t lda,
+                                        double complex* restrict B, size_t ldb,
+                                        size_t A_rows, size_t A_cols,
+                                        double complex alpha, size_t num_thr)
+{
+    transpose_threads_col(A, lda, B, ldb, A_rows, A_cols,
+                          alpha == 1 ? NULL : &alpha, num_thr,
+                          &transpose_thread_dbl_cmplx);
+}
+
+void transpose_flt_cmplx_threads_row_blocked_ld(const float complex* restrict A,
+                                                size_t lda,
+                                                float complex* restrict B,
+                                                size_t ldb,
+                                                size_t A_rows, size_t A_cols,
+                                                float complex alpha,
+                                                size_t num_thr,
+                                                size_t blk_rows,
+                                                size_t blk_cols)
+{
+    transpose_threads_blocked(A, lda, B, ldb, A_rows, A_cols,
+                              alpha == 1 ? NULL : &alpha,
+                              num_thr, blk_rows, blk_cols, 1,
+                              &transpose_thread_blocked_flt_cmplx);
+}
+
+void transpose_flt_cmplx_threads_col_blocked_ld(const float complex* restrict A,
+                                                size_t lda,
+                                                float complex* restrict B,
+                                                size_t ldb,
+                                                size_t A_rows, size_t A_cols,
+                                                float complex alpha,
+                                                size_t num_thr,
+                                                size_t blk_rows,
+                                                size_t blk_cols)
+{
+    transpose_threads_blocked(A, lda, B, ldb, A_rows, A_cols,
+                              alpha == 1 ? NULL : &alpha,
+                              num_thr, blk_rows, blk_cols, 0,
+                              &transpose_thread_blocked_flt_cmplx);
+}
+
+void transpose_dbl_cmplx_threads_row_blocked_ld(const double complex* restrict A,
+                                                size_t lda,
+                                                double complex* restrict B,
+                                                size_t ldb,
+                                                size_t A_rows, size_t A_cols,
+                                                double complex alpha,
+                                                size_t num_thr,
+                                                size_t blk_rows,
+                                                size_t blk_cols)
+{
+    transpose_threads_blocked(A, lda, B, ldb, A_rows, A_cols,
+                              alpha == 1 ? NULL : &alpha,
+                              num_thr, blk_rows, blk_cols, 1,
+                              &transpose_thread_blocked_dbl_cmplx);
+}
+
+void transpose_dbl_cmplx_threads_col_blocked_ld(const double complex* restrict A,
+                                                size_t lda,
+                                                double complex* restrict B,
+                                                size_t ldb,
+                                                size_t A_rows, size_t A_cols,
+                                                double complex alpha,
+                                                size_t num_thr,
+                                                size_t blk_rows,
+                                                size_t blk_cols)
+{
+    transpose_threads_blocked(A, lda, B, ldb, A_rows, A_cols,
+                              alpha == 1 ? NULL : &alpha,
+                              num_thr, blk_rows, blk_cols, 0,
+                              &transpose_thread_blocked_dbl_cmplx);
+}
+
+void transpose_flt_threads_row_blocked_inplace(float *A, size_t n,
+                                               size_t num_thr, size_t blk)
+{
+    transpose_threads_blocked_inplace(A, n, num_thr, blk, 1,
+                                      &transpose_thread_inplace_flt);
+}
+
+void transpose_dbl_threads_row_blocked_inplace(double *A, size_t n,
+                                               size_t num_thr, size_t blk)
+{
+    transpose_threads_blocked_inplace(A, n, num_thr, blk, 1,
+                                      &transpose_thread_inplace_dbl);
+}
+
+void transpose_flt_threads_col_blocked_inplace(float *A, size_t n,
+                                               size_t num_thr, size_t blk)
+{
+    transpose_threads_blocked_inplace(A, n, num_thr, blk, 0,
+                                      &transpose_thread_inplace_flt);
+}
+
+void transpose_dbl_threads_col_blocked_inplace(double *A, size_t n,
+                                               size_t num_thr, size_t blk)
+{
+    transpose_threads_blocked_inplace(A, n, num_thr, blk, 0,
+                                      &transpose_thread_inplace_dbl);
+}
+
+void transpose_flt_threads_cycles_inplace(float *A,
+                                          size_t A_rows, size_t A_cols,
+                                          size_t num_thr)
+{
+    if (A_rows == A_cols) {
+        transpose_threads_blocked_inplace(A, A_rows, num_thr,
+                                          TRANSPOSE_INPLACE_BLK, 1,
+                                          &transpose_thread_inplace_flt);
+        return;
     }
+    transpose_threads_cycles_inplace(A, A_rows, A_cols, num_thr,
+                                     &transpose_thread_cycles_flt);
+}
 
-    // free attribute and wait for the other threads
-    pthread_attr_destroy(&attr);
-    for(thr_num = 0; thr_num < num_thr; thr_num++) {
-        errno = pthread_join(threads[thr_num], NULL);
-        if (errno) {
-            perror("pthread_join");
-            exit(errno);
-        }
+void transpose_dbl_threads_cycles_inplace(double *A,
+                                          size_t A_rows, size_t A_cols,
+                                          size_t num_thr)
+{
+    if (A_rows == A_cols) {
+        transpose_threads_blocked_inplace(A, A_rows, num_thr,
+                                          TRANSPOSE_INPLACE_BLK, 1,
+                                          &transpose_thread_inplace_dbl);
+        return;
+    }
+    transpose_threads_cycles_inplace(A, A_rows, A_cols, num_thr,
+                                     &transpose_thread_cycles_dbl);
+}
+
+void transpose_flt_cmplx_threads_cycles_inplace(float complex *A,
+                                                size_t A_rows, size_t A_cols,
+                                                size_t num_thr)
+{
+    if (A_rows == A_cols) {
+        transpose_threads_blocked_inplace(A, A_rows, num_thr,
+                                          TRANSPOSE_INPLACE_BLK, 1,
+                                          &transpose_thread_inplace_flt_cmplx);
+        return;
+    }
+    transpose_threads_cycles_inplace(A, A_rows, A_cols, num_thr,
+                                     &transpose_thread_cycles_flt_cmplx);
+}
+
+void transpose_dbl_cmplx_threads_cycles_inplace(double complex *A,
+                                                size_t A_rows, size_t A_cols,
+                                                size_t num_thr)
+{
+    if (A_rows == A_cols) {
+        transpose_threads_blocked_inplace(A, A_rows, num_thr,
+                                          TRANSPOSE_INPLACE_BLK, 1,
+                                          &transpose_thread_inplace_dbl_cmplx);
+        return;
     }
+    transpose_threads_cycles_inplace(A, A_rows, A_cols, num_thr,
+                                     &transpose_thread_cycles_dbl_cmplx);
+}
 
-    free(args);
-    free(threads);
+void transpose_flt_threads_recursive(const float* restrict A, float* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t num_thr)
+{
+    struct tr_thread_arg tt_arg;
+    tt_arg_init(&tt_arg, A, A_cols, B, A_rows, A_rows, A_cols, NULL,
+                0, A_rows, 0, A_cols, TRANSPOSE_TILE_FLT, TRANSPOSE_TILE_FLT, 0);
+    tt_arg.num_thr = num_thr;
+    transpose_recursive_split(&tt_arg,
+                              transpose_pool_begin(num_thr, sizeof(tt_arg)));
+    transpose_pool_run(&transpose_thread_recursive_flt);
+}
+
+void transpose_dbl_threads_recursive(const double* restrict A,
+                                     double* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t num_thr)
+{
+    struct tr_thread_arg tt_arg;
+    tt_arg_init(&tt_arg, A, A_cols, B, A_rows, A_rows, A_cols, NULL,
+                0, A_rows, 0, A_cols, TRANSPOSE_TILE_DBL, TRANSPOSE_TILE_DBL, 0);
+    tt_arg.num_thr = num_thr;
+    transpose_recursive_split(&tt_arg,
+                              transpose_pool_begin(num_thr, sizeof(tt_arg)));
+    transpose_pool_run(&transpose_thread_recursive_dbl);
+}
+
+void transpose_flt_threads_row_wc(const float* restrict A, float* restrict B,
+                                  size_t A_rows, size_t A_cols, size_t num_thr)
+{
+    transpose_threads_blocked(A, A_cols, B, A_rows, A_rows, A_cols, NULL,
+                              num_thr, TRANSPOSE_TILE_FLT, TRANSPOSE_TILE_FLT,
+                              1, &transpose_thread_wc_flt);
+}
+
+void transpose_flt_threads_col_wc(const float* restrict A, float* restrict B,
+                                  size_t A_rows, size_t A_cols, size_t num_thr)
+{
+    transpose_threads_blocked(A, A_cols, B, A_rows, A_rows, A_cols, NULL,
+                              num_thr, TRANSPOSE_TILE_FLT, TRANSPOSE_TILE_FLT,
+                              0, &transpose_thread_wc_flt);
+}
+
+void transpose_dbl_threads_row_wc(const double* restrict A, double* restrict B,
+                                  size_t A_rows, size_t A_cols, size_t num_thr)
+{
+    transpose_threads_blocked(A, A_cols, B, A_rows, A_rows, A_cols, NULL,
+                              num_thr, TRANSPOSE_TILE_DBL, TRANSPOSE_TILE_DBL,
+                              1, &transpose_thread_wc_dbl);
+}
+
+void transpose_dbl_threads_col_wc(const double* restrict A, double* restrict B,
+                                  size_t A_rows, size_t A_cols, size_t num_thr)
+{
+    transpose_threads_blocked(A, A_cols, B, A_rows, A_rows, A_cols, NULL,
+                              num_thr, TRANSPOSE_TILE_DBL, TRANSPOSE_TILE_DBL,
+                              0, &transpose_thread_wc_dbl);
 }
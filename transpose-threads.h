@@ -7,8 +7,11 @@
 #ifndef TRANSPOSE_THREADS_H
 #define TRANSPOSE_THREADS_H
 
+#include <complex.h>
 #include <stdlib.h>
 
+#include "transpose-prefetch.h"
+
 void transpose_flt_threads_row(const float* restrict A, float* restrict B,
                                size_t A_rows, size_t A_cols,
                                size_t num_thr);
@@ -50,4 +53,297 @@ void transpose_dbl_threads_col_blocked(const double* restrict A,
                                        size_t num_thr,
                                        size_t blk_rows, size_t blk_cols);
 
+void transpose_flt_cmplx_threads_row(const float complex* restrict A,
+                                     float complex* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t num_thr);
+
+void transpose_flt_cmplx_threads_col(const float complex* restrict A,
+                                     float complex* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t num_thr);
+
+void transpose_dbl_cmplx_threads_row(const double complex* restrict A,
+                                     double complex* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t num_thr);
+
+void transpose_dbl_cmplx_threads_col(const double complex* restrict A,
+                                     double complex* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t num_thr);
+
+void transpose_flt_cmplx_threads_row_blocked(const float complex* restrict A,
+                                             float complex* restrict B,
+                                             size_t A_rows, size_t A_cols,
+                                             size_t num_thr,
+                                             size_t blk_rows, size_t blk_cols);
+
+void transpose_flt_cmplx_threads_col_blocked(const float complex* restrict A,
+                                             float complex* restrict B,
+                                             size_t A_rows, size_t A_cols,
+                                             size_t num_thr,
+                                             size_t blk_rows, size_t blk_cols);
+
+void transpose_dbl_cmplx_threads_row_blocked(const double complex* restrict A,
+                                             double complex* restrict B,
+                                             size_t A_rows, size_t A_cols,
+                                             size_t num_thr,
+                                             size_t blk_rows, size_t blk_cols);
+
+void transpose_dbl_cmplx_threads_col_blocked(const double complex* restrict A,
+                                             double complex* restrict B,
+                                             size_t A_rows, size_t A_cols,
+                                             size_t num_thr,
+                                             size_t blk_rows, size_t blk_cols);
+
+/*
+ * Prefetching variants; see transpose.h.
+ */
+void transpose_flt_threads_row_blocked_pf(const float* restrict A,
+                                          float* restrict B,
+                                          size_t A_rows, size_t A_cols,
+                                          size_t num_thr,
+                                          size_t blk_rows, size_t blk_cols,
+                                          size_t pf_dist,
+                                          enum transpose_pf_hint pf_hint);
+
+void transpose_flt_threads_col_blocked_pf(const float* restrict A,
+                                          float* restrict B,
+                                          size_t A_rows, size_t A_cols,
+                                          size_t num_thr,
+                                          size_t blk_rows, size_t blk_cols,
+                                          size_t pf_dist,
+                                          enum transpose_pf_hint pf_hint);
+
+void transpose_dbl_threads_row_blocked_pf(const double* restrict A,
+                                          double* restrict B,
+                                          size_t A_rows, size_t A_cols,
+                                          size_t num_thr,
+                                          size_t blk_rows, size_t blk_cols,
+                                          size_t pf_dist,
+                                          enum transpose_pf_hint pf_hint);
+
+void transpose_dbl_threads_col_blocked_pf(const double* restrict A,
+                                          double* restrict B,
+                                          size_t A_rows, size_t A_cols,
+                                          size_t num_thr,
+                                          size_t blk_rows, size_t blk_cols,
+                                          size_t pf_dist,
+                                          enum transpose_pf_hint pf_hint);
+
+/*
+ * Two-level blocked variants; see transpose.h.
+ */
+void transpose_flt_threads_row_blocked2(const float* restrict A,
+                                        float* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t num_thr,
+                                        size_t blk_rows, size_t blk_cols,
+                                        size_t sub_rows, size_t sub_cols);
+
+void transpose_flt_threads_col_blocked2(const float* restrict A,
+                                        float* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t num_thr,
+                                        size_t blk_rows, size_t blk_cols,
+                                        size_t sub_rows, size_t sub_cols);
+
+void transpose_dbl_threads_row_blocked2(const double* restrict A,
+                                        double* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t num_thr,
+                                        size_t blk_rows, size_t blk_cols,
+                                        size_t sub_rows, size_t sub_cols);
+
+void transpose_dbl_threads_col_blocked2(const double* restrict A,
+                                        double* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t num_thr,
+                                        size_t blk_rows, size_t blk_cols,
+                                        size_t sub_rows, size_t sub_cols);
+
+/*
+ * Strided variants: A has row stride lda and B has row stride ldb, and each
+ * output element is scaled by alpha.  See transpose.h.
+ */
+void transpose_flt_threads_row_ld(const float* restrict A, size_t lda,
+                                  float* restrict B, size_t ldb,
+                                  size_t A_rows, size_t A_cols, float alpha,
+                                  size_t num_thr);
+
+void transpose_dbl_threads_row_ld(const double* restrict A, size_t lda,
+                                  double* restrict B, size_t ldb,
+                                  size_t A_rows, size_t A_cols, double alpha,
+                                  size_t num_thr);
+
+void transpose_flt_threads_col_ld(const float* restrict A, size_t lda,
+                                  float* restrict B, size_t ldb,
+                                  size_t A_rows, size_t A_cols, float alpha,
+                                  size_t num_thr);
+
+void transpose_dbl_threads_col_ld(const double* restrict A, size_t lda,
+                                  double* restrict B, size_t ldb,
+                                  size_t A_rows, size_t A_cols, double alpha,
+                                  size_t num_thr);
+
+
+void transpose_flt_threads_row_blocked_ld(const float* restrict A, size_t lda,
+                                          float* restrict B, size_t ldb,
+                                          size_t A_rows, size_t A_cols,
+                                          float alpha, size_t num_thr,
+                                          size_t blk_rows, size_t blk_cols);
+
+void transpose_dbl_threads_row_blocked_ld(const double* restrict A, size_t lda,
+                                          double* restrict B, size_t ldb,
+                                          size_t A_rows, size_t A_cols,
+                                          double alpha, size_t num_thr,
+                                          size_t blk_rows, size_t blk_cols);
+
+void transpose_flt_threads_col_blocked_ld(const float* restrict A, size_t lda,
+                                          float* restrict B, size_t ldb,
+                                          size_t A_rows, size_t A_cols,
+                                          float alpha, size_t num_thr,
+                                          size_t blk_rows, size_t blk_cols);
+
+void transpose_dbl_threads_col_blocked_ld(const double* restrict A, size_t lda,
+                                          double* restrict B, size_t ldb,
+                                          size_t A_rows, size_t A_cols,
+                                          double alpha, size_t num_thr,
+                                          size_t blk_rows, size_t blk_cols);
+
+void transpose_flt_cmplx_threads_row_ld(const float complex* restrict A,
+                                        size_t lda,
+                                        float complex* restrict B, size_t ldb,
+                                        size_t A_rows, size_t A_cols,
+                                        float complex alpha, size_t num_thr);
+
+void transpose_flt_cmplx_threads_col_ld(const float complex* restrict A,
+                                        size_t lda,
+                                        float complex* restrict B, size_t ldb,
+                                        size_t A_rows, size_t A_cols,
+                                        float complex alpha, size_t num_thr);
+
+void transpose_dbl_cmplx_threads_row_ld(const double complex* restrict A,
+                                        size_t lda,
+                                        double complex* restrict B, size_t ldb,
+                                        size_t A_rows, size_t A_cols,
+                                        double complex alpha, size_t num_thr);
+
+void transpose_dbl_cmplx_threads_col_ld(const double complex* restrict A,
+                                        size_t lda,
+                                        double complex* restrict B, size_t ldb,
+                                        size_t A_rows, size_t A_cols,
+                                        double complex alpha, size_t num_thr);
+
+void transpose_flt_cmplx_threads_row_blocked_ld(const float complex* restrict A,
+                                                size_t lda,
+                                                float complex* restrict B,
+                                                size_t ldb,
+                                                size_t A_rows, size_t A_cols,
+                                                float complex alpha,
+                                                size_t num_thr,
+                                                size_t blk_rows,
+                                                size_t blk_cols);
+
+void transpose_flt_cmplx_threads_col_blocked_ld(const float complex* restrict A,
+                                                size_t lda,
+                                                float complex* restrict B,
+                                                size_t ldb,
+                                                size_t A_rows, size_t A_cols,
+                                                float complex alpha,
+                                                size_t num_thr,
+                                                size_t blk_rows,
+                                                size_t blk_cols);
+
+void transpose_dbl_cmplx_threads_row_blocked_ld(const double complex* restrict A,
+                                                size_t lda,
+                                                double complex* restrict B,
+                                                size_t ldb,
+                                                size_t A_rows, size_t A_cols,
+                                                double complex alpha,
+                                                size_t num_thr,
+                                                size_t blk_rows,
+                                                size_t blk_cols);
+
+void transpose_dbl_cmplx_threads_col_blocked_ld(const double complex* restrict A,
+                                                size_t lda,
+                                                double complex* restrict B,
+                                                size_t ldb,
+                                                size_t A_rows, size_t A_cols,
+                                                double complex alpha,
+                                                size_t num_thr,
+                                                size_t blk_rows,
+                                                size_t blk_cols);
+
+/*
+ * In-place blocked transposes of a square n x n matrix with blk x blk tiles.
+ * Threads split the tile rows (or columns) of the upper triangle so that each
+ * gets about the same number of tile pairs to swap.  See transpose.h.
+ */
+void transpose_flt_threads_row_blocked_inplace(float *A, size_t n,
+                                               size_t num_thr, size_t blk);
+
+void transpose_dbl_threads_row_blocked_inplace(double *A, size_t n,
+                                               size_t num_thr, size_t blk);
+
+void transpose_flt_threads_col_blocked_inplace(float *A, size_t n,
+                                               size_t num_thr, size_t blk);
+
+void transpose_dbl_threads_col_blocked_inplace(double *A, size_t n,
+                                               size_t num_thr, size_t blk);
+
+/*
+ * In-place transposes of a rectangular A_rows x A_cols matrix by cycle
+ * following.  Each cycle is rotated by the thread that owns its smallest index,
+ * so no bitmap is needed.  Square matrices use the blocked tile swap by row.
+ * See transpose.h.
+ */
+void transpose_flt_threads_cycles_inplace(float *A,
+                                          size_t A_rows, size_t A_cols,
+                                          size_t num_thr);
+
+void transpose_dbl_threads_cycles_inplace(double *A,
+                                          size_t A_rows, size_t A_cols,
+                                          size_t num_thr);
+
+void transpose_flt_cmplx_threads_cycles_inplace(float complex *A,
+                                                size_t A_rows, size_t A_cols,
+                                                size_t num_thr);
+
+void transpose_dbl_cmplx_threads_cycles_inplace(double complex *A,
+                                                size_t A_rows, size_t A_cols,
+                                                size_t num_thr);
+
+/*
+ * Cache-oblivious transposes: the top levels of the recursion split the matrix
+ * between the threads, each of which then recurses down to small base tiles.
+ * See transpose.h.
+ */
+void transpose_flt_threads_recursive(const float* restrict A, float* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t num_thr);
+
+void transpose_dbl_threads_recursive(const double* restrict A,
+                                     double* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t num_thr);
+
+/*
+ * Write-combining transposes: each thread stages its tiles in a buffer of its
+ * own and writes whole cache lines of B with streaming stores.  See
+ * transpose.h.
+ */
+void transpose_flt_threads_row_wc(const float* restrict A, float* restrict B,
+                                  size_t A_rows, size_t A_cols, size_t num_thr);
+
+void transpose_flt_threads_col_wc(const float* restrict A, float* restrict B,
+                                  size_t A_rows, size_t A_cols, size_t num_thr);
+
+void transpose_dbl_threads_row_wc(const double* restrict A, double* restrict B,
+                                  size_t A_rows, size_t A_cols, size_t num_thr);
+
+void transpose_dbl_threads_col_wc(const double* restrict A, double* restrict B,
+                                  size_t A_rows, size_t A_cols, size_t num_thr);
+
 #endif /* TRANSPOSE_THREADS_H */
@@ -0,0 +1,49 @@
+/**
+ * Write-combining transposes.
+ *
+ * Writing a tile straight into B touches a few bytes of many cache lines, and
+ * each of those lines is first read for ownership.  Here every tile is
+ * transposed into a small staging buffer that stays in L1 instead, and the
+ * buffer rows are then written to B as whole cache lines with streaming
+ * stores, which need no read for ownership.
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_WC_H
+#define TRANSPOSE_WC_H
+
+#include <stdlib.h>
+
+#include "transpose-nt.h"
+#include "transpose-order.h"
+
+/*
+ * Transpose rows [r_min, r_max) and columns [c_min, c_max) of A (row stride
+ * lda) into B (row stride ldb) in tile x tile pieces staged on the stack, so
+ * every thread has a buffer of its own.  A tile's rows of B start on a cache
+ * line when B's rows do and r_min is a multiple of tile.
+ */
+#define TRANSPOSE_WC_TILES(datatype, A, lda, B, ldb, r_min, r_max, c_min, \
+                           c_max, tile) { \
+    _Alignas(64) datatype _buf[(tile) * (tile)]; \
+    size_t _i, _j, _r, _c, _m, _n; \
+    for (_i = (r_min); _i < (r_max); _i += (tile)) { \
+        _m = (r_max) - _i < (tile) ? (r_max) - _i : (tile); \
+        for (_j = (c_min); _j < (c_max); _j += (tile)) { \
+            _n = (c_max) - _j < (tile) ? (c_max) - _j : (tile); \
+            for (_r = 0; _r < _m; _r++) { \
+                for (_c = 0; _c < _n; _c++) { \
+                    _buf[_c * (tile) + _r] = (A)[(_i + _r) * (lda) + _j + _c]; \
+                } \
+            } \
+            for (_c = 0; _c < _n; _c++) { \
+                transpose_nt_copy(&(B)[(_j + _c) * (ldb) + _i], \
+                                  &_buf[_c * (tile)], _m * sizeof(datatype)); \
+            } \
+        } \
+    } \
+    transpose_nt_fence(); \
+}
+
+#endif /* TRANSPOSE_WC_H */
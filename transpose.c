@@ -7,143 +7,372 @@
  */
 #include <complex.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "transpose.h"
+#include "transpose-blk.h"
+#include "transpose-cvt.h"
+#include "transpose-epi.h"
+#include "transpose-iq.h"
+#include "transpose-nt.h"
+#include "transpose-order.h"
+#include "transpose-perm.h"
+#include "transpose-prefetch.h"
+#include "transpose-wc.h"
+#include "util.h"
 
-#define TRANSPOSE_BLK(A, B, A_rows, A_cols, r_min, c_min, r_max, c_max) { \
-    size_t r, c; \
-    for (r = (r_min); r < (r_max); r++) { \
-        for (c = (c_min); c < (c_max); c++) { \
-            (B)[(c) * (A_rows) + (r)] = (A)[(r) * (A_cols) + (c)]; \
+/*
+ * Blocked transpose scaled by alpha (see TRANSPOSE_BLK_LD) in blk_rows x
+ * blk_cols blocks, ragged ones at the bottom and right edges.  Streams the
+ * output through fn_store when it would not stay in the LLC anyway.
+ */
+#define TRANSPOSE_BLOCKED_LD(datatype, fn_store, A, lda, B, ldb, A_rows, \
+                             A_cols, alpha, blk_rows, blk_cols) { \
+    const int _nt = transpose_nt_use((A_cols) * (ldb) * sizeof(datatype)); \
+    size_t _r, _c, _r_max, _c_max; \
+    for (_r = 0; _r < (A_rows); _r += (blk_rows)) { \
+        _r_max = (A_rows) - _r < (blk_rows) ? (A_rows) : _r + (blk_rows); \
+        for (_c = 0; _c < (A_cols); _c += (blk_cols)) { \
+            _c_max = (A_cols) - _c < (blk_cols) ? (A_cols) : _c + (blk_cols); \
+            if (_nt) { \
+                TRANSPOSE_BLK_LD_NT(A, lda, B, ldb, alpha, _r, _c, _r_max, \
+                                    _c_max, fn_store); \
+            } else { \
+                TRANSPOSE_BLK_LD(A, lda, B, ldb, alpha, _r, _c, _r_max, \
+                                 _c_max); \
+            } \
         } \
     } \
+    if (_nt) { \
+        transpose_nt_fence(); \
+    } \
 }
 
-typedef void (fn_transpose_blk)(const void* restrict A, void* restrict B,
-                                size_t A_rows, size_t A_cols,
-                                size_t r_min, size_t c_min,
-                                size_t r_max, size_t c_max);
+/*
+ * Blocked ingest transpose of the I/Q samples in A, converted by fn_cvt (see
+ * transpose-iq.h); streams, and fences, like TRANSPOSE_BLOCKED_LD.
+ */
+#define TRANSPOSE_IQ_BLOCKED(A, B, A_rows, A_cols, scale, blk_rows, blk_cols, \
+                             fn_cvt) { \
+    const int _nt = transpose_nt_use((A_cols) * (A_rows) * sizeof(*(B))); \
+    size_t _r, _c, _r_max, _c_max; \
+    for (_r = 0; _r < (A_rows); _r += (blk_rows)) { \
+        _r_max = (A_rows) - _r < (blk_rows) ? (A_rows) : _r + (blk_rows); \
+        for (_c = 0; _c < (A_cols); _c += (blk_cols)) { \
+            _c_max = (A_cols) - _c < (blk_cols) ? (A_cols) : _c + (blk_cols); \
+            if (_nt) { \
+                TRANSPOSE_IQ_BLK_NT(A, A_cols, B, A_rows, scale, _r, _c, \
+                                    _r_max, _c_max, fn_cvt, \
+                                    transpose_nt_store_flt_cmplx); \
+            } else { \
+                TRANSPOSE_IQ_BLK(A, A_cols, B, A_rows, scale, _r, _c, \
+                                 _r_max, _c_max, fn_cvt); \
+            } \
+        } \
+    } \
+    if (_nt) { \
+        transpose_nt_fence(); \
+    } \
+}
 
 void transpose_flt_naive(const float* restrict A, float* restrict B,
                          size_t A_rows, size_t A_cols)
 {
-    TRANSPOSE_BLK(A, B, A_rows, A_cols, 0, 0, A_rows, A_cols);
+    transpose_blk_w4(A, A_cols, B, A_rows, 0, 0, A_rows, A_cols);
 }
 
 void transpose_dbl_naive(const double* restrict A, double* restrict B,
                          size_t A_rows, size_t A_cols)
 {
-    TRANSPOSE_BLK(A, B, A_rows, A_cols, 0, 0, A_rows, A_cols);
+    transpose_blk_w8(A, A_cols, B, A_rows, 0, 0, A_rows, A_cols);
 }
 
 void transpose_flt_cmplx_naive(const float complex* restrict A,
                                float complex* restrict B,
                                size_t A_rows, size_t A_cols)
 {
-    TRANSPOSE_BLK(A, B, A_rows, A_cols, 0, 0, A_rows, A_cols);
+    transpose_blk_w8(A, A_cols, B, A_rows, 0, 0, A_rows, A_cols);
 }
 
 void transpose_dbl_cmplx_naive(const double complex* restrict A,
                                double complex* restrict B,
                                size_t A_rows, size_t A_cols)
 {
-    TRANSPOSE_BLK(A, B, A_rows, A_cols, 0, 0, A_rows, A_cols);
+    transpose_blk_w16(A, A_cols, B, A_rows, 0, 0, A_rows, A_cols);
+}
+
+void transpose_u8_naive(const uint8_t* restrict A, uint8_t* restrict B,
+                        size_t A_rows, size_t A_cols)
+{
+    transpose_blk_w1(A, A_cols, B, A_rows, 0, 0, A_rows, A_cols);
+}
+
+void transpose_i16_naive(const int16_t* restrict A, int16_t* restrict B,
+                         size_t A_rows, size_t A_cols)
+{
+    transpose_blk_w2(A, A_cols, B, A_rows, 0, 0, A_rows, A_cols);
+}
+
+void transpose_iq16_flt_cmplx_naive(const transpose_iq16_t* restrict A,
+                                    float complex* restrict B,
+                                    size_t A_rows, size_t A_cols, float scale)
+{
+    TRANSPOSE_IQ_BLK(A, A_cols, B, A_rows, scale, 0, 0, A_rows, A_cols,
+                     transpose_iq16_to_flt_cmplx);
+}
+
+void transpose_iq12_flt_cmplx_naive(const transpose_iq12_t* restrict A,
+                                    float complex* restrict B,
+                                    size_t A_rows, size_t A_cols, float scale)
+{
+    TRANSPOSE_IQ_BLK(A, A_cols, B, A_rows, scale, 0, 0, A_rows, A_cols,
+                     transpose_iq12_to_flt_cmplx);
+}
+
+void transpose_dbl_flt_naive(const double* restrict A,
+                             float* restrict B,
+                             size_t A_rows, size_t A_cols)
+{
+    TRANSPOSE_CVT_BLK(A, A_cols, B, A_rows, 0, 0, A_rows, A_cols,
+                      transpose_dbl_to_flt);
+}
+
+void transpose_dbl_cmplx_flt_cmplx_naive(const double complex* restrict A,
+                                         float complex* restrict B,
+                                         size_t A_rows, size_t A_cols)
+{
+    TRANSPOSE_CVT_BLK(A, A_cols, B, A_rows, 0, 0, A_rows, A_cols,
+                      transpose_dbl_cmplx_to_flt_cmplx);
+}
+
+void transpose_flt_fp16_naive(const float* restrict A,
+                              transpose_fp16_t* restrict B,
+                              size_t A_rows, size_t A_cols)
+{
+    TRANSPOSE_CVT_BLK(A, A_cols, B, A_rows, 0, 0, A_rows, A_cols,
+                      transpose_flt_to_fp16);
+}
+
+void transpose_flt_bf16_naive(const float* restrict A,
+                              transpose_bf16_t* restrict B,
+                              size_t A_rows, size_t A_cols)
+{
+    TRANSPOSE_CVT_BLK(A, A_cols, B, A_rows, 0, 0, A_rows, A_cols,
+                      transpose_flt_to_bf16);
+}
+
+void transpose_flt_cmplx_fp16_cmplx_naive(const float complex* restrict A,
+                                          transpose_fp16_cmplx_t* restrict B,
+                                          size_t A_rows, size_t A_cols)
+{
+    TRANSPOSE_CVT_BLK(A, A_cols, B, A_rows, 0, 0, A_rows, A_cols,
+                      transpose_flt_cmplx_to_fp16_cmplx);
+}
+
+void transpose_flt_cmplx_bf16_cmplx_naive(const float complex* restrict A,
+                                          transpose_bf16_cmplx_t* restrict B,
+                                          size_t A_rows, size_t A_cols)
+{
+    TRANSPOSE_CVT_BLK(A, A_cols, B, A_rows, 0, 0, A_rows, A_cols,
+                      transpose_flt_cmplx_to_bf16_cmplx);
+}
+
+void transpose_flt_cmplx_split_naive(const float complex* restrict A,
+                                     float* restrict B_re,
+                                     float* restrict B_im,
+                                     size_t A_rows, size_t A_cols)
+{
+    TRANSPOSE_TO_SPLIT_BLK(A, A_cols, B_re, B_im, A_rows, 0, 0, A_rows, A_cols,
+                           crealf, cimagf);
+}
+
+void transpose_dbl_cmplx_split_naive(const double complex* restrict A,
+                                     double* restrict B_re,
+                                     double* restrict B_im,
+                                     size_t A_rows, size_t A_cols)
+{
+    TRANSPOSE_TO_SPLIT_BLK(A, A_cols, B_re, B_im, A_rows, 0, 0, A_rows, A_cols,
+                           creal, cimag);
+}
+
+void transpose_flt_split_cmplx_naive(const float* restrict A_re,
+                                     const float* restrict A_im,
+                                     float complex* restrict B,
+                                     size_t A_rows, size_t A_cols)
+{
+    TRANSPOSE_FROM_SPLIT_BLK(A_re, A_im, A_cols, B, A_rows, 0, 0, A_rows, A_cols,
+                             CMPLXF);
 }
 
-static void transpose_blk_flt(const void* restrict A, void* restrict B,
+void transpose_dbl_split_cmplx_naive(const double* restrict A_re,
+                                     const double* restrict A_im,
+                                     double complex* restrict B,
+                                     size_t A_rows, size_t A_cols)
+{
+    TRANSPOSE_FROM_SPLIT_BLK(A_re, A_im, A_cols, B, A_rows, 0, 0, A_rows, A_cols,
+                             CMPLX);
+}
+
+void transpose_flt_cmplx_naive_epi(const float complex* restrict A,
+                                   float complex* restrict B,
+                                   size_t A_rows, size_t A_cols,
+                                   const struct transpose_epi_flt_cmplx *epi)
+{
+    size_t r, c;
+    for (r = 0; r < A_rows; r++) {
+        for (c = 0; c < A_cols; c++) {
+            B[c * A_rows + r] =
+                transpose_epi_flt_cmplx_apply(epi, A[r * A_cols + c], r, c,
+                                              A_cols);
+        }
+    }
+}
+
+void transpose_dbl_cmplx_naive_epi(const double complex* restrict A,
+                                   double complex* restrict B,
+                                   size_t A_rows, size_t A_cols,
+                                   const struct transpose_epi_dbl_cmplx *epi)
+{
+    size_t r, c;
+    for (r = 0; r < A_rows; r++) {
+        for (c = 0; c < A_cols; c++) {
+            B[c * A_rows + r] =
+                transpose_epi_dbl_cmplx_apply(epi, A[r * A_cols + c], r, c,
+                                              A_cols);
+        }
+    }
+}
+
+void transpose_flt_naive_perm(const float* restrict A, float* restrict B,
                               size_t A_rows, size_t A_cols,
-                              size_t r_min, size_t c_min,
-                              size_t r_max, size_t c_max)
+                              const struct transpose_perm *perm)
 {
-    TRANSPOSE_BLK((const float* restrict)A, (float* restrict)B, A_rows, A_cols,
-                  r_min, c_min, r_max, c_max);
+    transpose_blk_w4_perm(A, A_cols, B, A_rows, 0, 0, A_rows, A_cols, perm);
 }
 
-static void transpose_blk_dbl(const void* restrict A, void* restrict B,
+void transpose_dbl_naive_perm(const double* restrict A, double* restrict B,
                               size_t A_rows, size_t A_cols,
-                              size_t r_min, size_t c_min,
-                              size_t r_max, size_t c_max)
+                              const struct transpose_perm *perm)
 {
-    TRANSPOSE_BLK((const double* restrict)A, (double* restrict)B, A_rows, A_cols,
-                  r_min, c_min, r_max, c_max);
+    transpose_blk_w8_perm(A, A_cols, B, A_rows, 0, 0, A_rows, A_cols, perm);
 }
 
-static void transpose_blk_flt_cmplx(const void* restrict A, void* restrict B,
+void transpose_flt_cmplx_naive_perm(const float complex* restrict A,
+                                    float complex* restrict B,
                                     size_t A_rows, size_t A_cols,
-                                    size_t r_min, size_t c_min,
-                                    size_t r_max, size_t c_max)
+                                    const struct transpose_perm *perm)
 {
-    TRANSPOSE_BLK((const float complex* restrict)A, (float complex* restrict)B,
-                  A_rows, A_cols, r_min, c_min, r_max, c_max);
+    transpose_blk_w8_perm(A, A_cols, B, A_rows, 0, 0, A_rows, A_cols, perm);
 }
 
-static void transpose_blk_dbl_cmplx(const void* restrict A, void* restrict B,
+void transpose_dbl_cmplx_naive_perm(const double complex* restrict A,
+                                    double complex* restrict B,
                                     size_t A_rows, size_t A_cols,
-                                    size_t r_min, size_t c_min,
-                                    size_t r_max, size_t c_max)
+                                    const struct transpose_perm *perm)
 {
-    TRANSPOSE_BLK((const double complex* restrict)A, (double complex* restrict)B,
-                  A_rows, A_cols, r_min, c_min, r_max, c_max);
+    transpose_blk_w16_perm(A, A_cols, B, A_rows, 0, 0, A_rows, A_cols, perm);
 }
 
-static void transpose_blocked(const void* restrict A, void* restrict B,
-                              size_t A_rows, size_t A_cols,
-                              size_t blk_rows, size_t blk_cols,
-                              fn_transpose_blk *fn_transp_blk)
+void transpose_flt_blocked_perm(const float* restrict A, float* restrict B,
+                                size_t A_rows, size_t A_cols,
+                                const struct transpose_perm *perm,
+                                size_t blk_rows, size_t blk_cols)
 {
-    size_t n_rblks, n_cblks;
-    size_t n_full_rblks, n_full_cblks;
-    size_t rblk_remainder, cblk_remainder;
-    size_t rblk_num, cblk_num;
-    size_t r_min, c_min, r_max, c_max;
+    transpose_blocked_w4_perm(A, A_cols, B, A_rows, A_rows, A_cols,
+                              blk_rows, blk_cols, perm);
+}
+
+void transpose_dbl_blocked_perm(const double* restrict A, double* restrict B,
+                                size_t A_rows, size_t A_cols,
+                                const struct transpose_perm *perm,
+                                size_t blk_rows, size_t blk_cols)
+{
+    transpose_blocked_w8_perm(A, A_cols, B, A_rows, A_rows, A_cols,
+                              blk_rows, blk_cols, perm);
+}
 
-    // take the ceiling of (A_rows / blk_rows)
-    n_rblks = (A_rows + blk_rows - 1) / blk_rows;
-    // take the ceiling of (A_cols / blk_cols)
-    n_cblks = (A_cols + blk_cols - 1) / blk_cols;
+void transpose_flt_cmplx_blocked_perm(const float complex* restrict A,
+                                      float complex* restrict B,
+                                      size_t A_rows, size_t A_cols,
+                                      const struct transpose_perm *perm,
+                                      size_t blk_rows, size_t blk_cols)
+{
+    transpose_blocked_w8_perm(A, A_cols, B, A_rows, A_rows, A_cols,
+                              blk_rows, blk_cols, perm);
+}
 
-    n_full_rblks = A_rows / blk_rows;
-    n_full_cblks = A_cols / blk_cols;
+void transpose_dbl_cmplx_blocked_perm(const double complex* restrict A,
+                                      double complex* restrict B,
+                                      size_t A_rows, size_t A_cols,
+                                      const struct transpose_perm *perm,
+                                      size_t blk_rows, size_t blk_cols)
+{
+    transpose_blocked_w16_perm(A, A_cols, B, A_rows, A_rows, A_cols,
+                               blk_rows, blk_cols, perm);
+}
 
-    rblk_remainder = A_rows % blk_rows;
-    cblk_remainder = A_cols % blk_cols;
+void transpose_flt_naive_ld(const float* restrict A, size_t lda,
+                            float* restrict B, size_t ldb,
+                            size_t A_rows, size_t A_cols, float alpha)
+{
+    if (alpha == 1) {
+        transpose_blk_w4(A, lda, B, ldb, 0, 0, A_rows, A_cols);
+    } else {
+        TRANSPOSE_BLK_LD(A, lda, B, ldb, alpha, 0, 0, A_rows, A_cols);
+    }
+}
 
-    // perform transpose over all blocks (both full and partial)
-    for (rblk_num = 0; rblk_num < n_rblks; rblk_num++) {
-        r_min = rblk_num * blk_rows;
-        if (rblk_num < n_full_rblks) {
-            r_max = r_min + blk_rows;
-        } else {
-            r_max = r_min + rblk_remainder;
-        }
-        for (cblk_num = 0; cblk_num < n_cblks; cblk_num++) {
-            c_min = cblk_num * blk_cols;
-            if (cblk_num < n_full_cblks) {
-                c_max = c_min + blk_cols;
-            } else {
-                c_max = c_min + cblk_remainder;
-            }
-            // perform actual transpose over current block
-            fn_transp_blk(A, B, A_rows, A_cols, r_min, c_min, r_max, c_max);
-        }
+void transpose_dbl_naive_ld(const double* restrict A, size_t lda,
+                            double* restrict B, size_t ldb,
+                            size_t A_rows, size_t A_cols, double alpha)
+{
+    if (alpha == 1) {
+        transpose_blk_w8(A, lda, B, ldb, 0, 0, A_rows, A_cols);
+    } else {
+        TRANSPOSE_BLK_LD(A, lda, B, ldb, alpha, 0, 0, A_rows, A_cols);
     }
 }
 
+void transpose_flt_cmplx_naive_ld(const float complex* restrict A, size_t lda,
+                                  float complex* restrict B, size_t ldb,
+                                  size_t A_rows, size_t A_cols,
+                                  float complex alpha)
+{
+    if (alpha == 1) {
+        transpose_blk_w8(A, lda, B, ldb, 0, 0, A_rows, A_cols);
+    } else {
+        TRANSPOSE_BLK_LD(A, lda, B, ldb, alpha, 0, 0, A_rows, A_cols);
+    }
+}
+
+void transpose_dbl_cmplx_naive_ld(const double complex* restrict A, size_t lda,
+                                  double complex* restrict B, size_t ldb,
+                                  size_t A_rows, size_t A_cols,
+                                  double complex alpha)
+{
+    if (alpha == 1) {
+        transpose_blk_w16(A, lda, B, ldb, 0, 0, A_rows, A_cols);
+    } else {
+        TRANSPOSE_BLK_LD(A, lda, B, ldb, alpha, 0, 0, A_rows, A_cols);
+    }
+}
 
 void transpose_flt_blocked(const float* restrict A, float* restrict B,
                            size_t A_rows, size_t A_cols,
                            size_t blk_rows, size_t blk_cols)
 {
-    transpose_blocked(A, B, A_rows, A_cols,
-                      blk_rows, blk_cols, transpose_blk_flt);
+    transpose_blocked_w4(A, A_cols, B, A_rows, A_rows, A_cols,
+                         blk_rows, blk_cols,
+                         transpose_nt_use(A_cols * A_rows * sizeof(*B)));
 }
 
 void transpose_dbl_blocked(const double* restrict A, double* restrict B,
                            size_t A_rows, size_t A_cols,
                            size_t blk_rows, size_t blk_cols)
 {
-    transpose_blocked(A, B, A_rows, A_cols,
-                      blk_rows, blk_cols, transpose_blk_dbl);
+    transpose_blocked_w8(A, A_cols, B, A_rows, A_rows, A_cols,
+                         blk_rows, blk_cols,
+                         transpose_nt_use(A_cols * A_rows * sizeof(*B)));
 }
 
 void transpose_flt_cmplx_blocked(const float complex* restrict A,
@@ -151,8 +380,9 @@ void transpose_flt_cmplx_blocked(const float complex* restrict A,
                                  size_t A_rows, size_t A_cols,
                                  size_t blk_rows, size_t blk_cols)
 {
-    transpose_blocked(A, B, A_rows, A_cols,
-                      blk_rows, blk_cols, transpose_blk_flt_cmplx);
+    transpose_blocked_w8(A, A_cols, B, A_rows, A_rows, A_cols,
+                         blk_rows, blk_cols,
+                         transpose_nt_use(A_cols * A_rows * sizeof(*B)));
 }
 
 void transpose_dbl_cmplx_blocked(const double complex* restrict A,
@@ -160,6 +390,465 @@ void transpose_dbl_cmplx_blocked(const double complex* restrict A,
                                  size_t A_rows, size_t A_cols,
                                  size_t blk_rows, size_t blk_cols)
 {
-    transpose_blocked(A, B, A_rows, A_cols,
-                      blk_rows, blk_cols, transpose_blk_dbl_cmplx);
+    transpose_blocked_w16(A, A_cols, B, A_rows, A_rows, A_cols,
+                          blk_rows, blk_cols,
+                          transpose_nt_use(A_cols * A_rows * sizeof(*B)));
+}
+
+void transpose_u8_blocked(const uint8_t* restrict A, uint8_t* restrict B,
+                          size_t A_rows, size_t A_cols,
+                          size_t blk_rows, size_t blk_cols)
+{
+    transpose_blocked_w1(A, A_cols, B, A_rows, A_rows, A_cols,
+                         blk_rows, blk_cols,
+                         transpose_nt_use(A_cols * A_rows * sizeof(*B)));
+}
+
+void transpose_i16_blocked(const int16_t* restrict A, int16_t* restrict B,
+                           size_t A_rows, size_t A_cols,
+                           size_t blk_rows, size_t blk_cols)
+{
+    transpose_blocked_w2(A, A_cols, B, A_rows, A_rows, A_cols,
+                         blk_rows, blk_cols,
+                         transpose_nt_use(A_cols * A_rows * sizeof(*B)));
+}
+
+void transpose_iq16_flt_cmplx_blocked(const transpose_iq16_t* restrict A,
+                                      float complex* restrict B,
+                                      size_t A_rows, size_t A_cols,
+                                      float scale,
+                                      size_t blk_rows, size_t blk_cols)
+{
+    TRANSPOSE_IQ_BLOCKED(A, B, A_rows, A_cols, scale, blk_rows, blk_cols,
+                         transpose_iq16_to_flt_cmplx);
+}
+
+void transpose_iq12_flt_cmplx_blocked(const transpose_iq12_t* restrict A,
+                                      float complex* restrict B,
+                                      size_t A_rows, size_t A_cols,
+                                      float scale,
+                                      size_t blk_rows, size_t blk_cols)
+{
+    TRANSPOSE_IQ_BLOCKED(A, B, A_rows, A_cols, scale, blk_rows, blk_cols,
+                         transpose_iq12_to_flt_cmplx);
+}
+
+void transpose_flt_blocked_ld(const float* restrict A, size_t lda,
+                              float* restrict B, size_t ldb,
+                              size_t A_rows, size_t A_cols, float alpha,
+                              size_t blk_rows, size_t blk_cols)
+{
+    if (alpha == 1) {
+        transpose_blocked_w4(A, lda, B, ldb, A_rows, A_cols,
+                             blk_rows, blk_cols,
+                             transpose_nt_use(A_cols * ldb * sizeof(*B)));
+    } else {
+        TRANSPOSE_BLOCKED_LD(float, transpose_nt_store_flt, A, lda, B, ldb,
+                             A_rows, A_cols, alpha, blk_rows, blk_cols);
+    }
+}
+
+void transpose_dbl_blocked_ld(const double* restrict A, size_t lda,
+                              double* restrict B, size_t ldb,
+                              size_t A_rows, size_t A_cols, double alpha,
+                              size_t blk_rows, size_t blk_cols)
+{
+    if (alpha == 1) {
+        transpose_blocked_w8(A, lda, B, ldb, A_rows, A_cols,
+                             blk_rows, blk_cols,
+                             transpose_nt_use(A_cols * ldb * sizeof(*B)));
+    } else {
+        TRANSPOSE_BLOCKED_LD(double, transpose_nt_store_dbl, A, lda, B, ldb,
+                             A_rows, A_cols, alpha, blk_rows, blk_cols);
+    }
+}
+
+void transpose_flt_cmplx_blocked_ld(const float complex* restrict A, size_t lda,
+                                    float complex* restrict B, size_t ldb,
+                                    size_t A_rows, size_t A_cols,
+                                    float complex alpha,
+                                    size_t blk_rows, size_t blk_cols)
+{
+    if (alpha == 1) {
+        transpose_blocked_w8(A, lda, B, ldb, A_rows, A_cols,
+                             blk_rows, blk_cols,
+                             transpose_nt_use(A_cols * ldb * sizeof(*B)));
+    } else {
+        TRANSPOSE_BLOCKED_LD(float complex, transpose_nt_store_flt_cmplx,
+                             A, lda, B, ldb, A_rows, A_cols, alpha,
+                             blk_rows, blk_cols);
+    }
+}
+
+void transpose_dbl_cmplx_blocked_ld(const double complex* restrict A,
+                                    size_t lda,
+                                    double complex* restrict B, size_t ldb,
+                                    size_t A_rows, size_t A_cols,
+                                    double complex alpha,
+                                    size_t blk_rows, size_t blk_cols)
+{
+    if (alpha == 1) {
+        transpose_blocked_w16(A, lda, B, ldb, A_rows, A_cols,
+                              blk_rows, blk_cols,
+                              transpose_nt_use(A_cols * ldb * sizeof(*B)));
+    } else {
+        TRANSPOSE_BLOCKED_LD(double complex, transpose_nt_store_dbl_cmplx,
+                             A, lda, B, ldb, A_rows, A_cols, alpha,
+                             blk_rows, blk_cols);
+    }
+}
+
+void transpose_flt_recursive(const float* restrict A, float* restrict B,
+                             size_t A_rows, size_t A_cols)
+{
+    transpose_recursive_tiles(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                              TRANSPOSE_TILE_FLT, transpose_tile_w4);
+}
+
+void transpose_dbl_recursive(const double* restrict A, double* restrict B,
+                             size_t A_rows, size_t A_cols)
+{
+    transpose_recursive_tiles(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                              TRANSPOSE_TILE_DBL, transpose_tile_w8);
+}
+
+void transpose_flt_cmplx_recursive(const float complex* restrict A,
+                                   float complex* restrict B,
+                                   size_t A_rows, size_t A_cols)
+{
+    transpose_recursive_tiles(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                              TRANSPOSE_TILE_FLT_CMPLX,
+                              transpose_tile_w8);
+}
+
+void transpose_dbl_cmplx_recursive(const double complex* restrict A,
+                                   double complex* restrict B,
+                                   size_t A_rows, size_t A_cols)
+{
+    transpose_recursive_tiles(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                              TRANSPOSE_TILE_DBL_CMPLX,
+                              transpose_tile_w16);
+}
+
+void transpose_flt_morton(const float* restrict A, float* restrict B,
+                          size_t A_rows, size_t A_cols)
+{
+    transpose_morton_tiles(A, A_cols, B, A_rows, A_rows, A_cols,
+                           TRANSPOSE_TILE_FLT, transpose_tile_w4);
+}
+
+void transpose_dbl_morton(const double* restrict A, double* restrict B,
+                          size_t A_rows, size_t A_cols)
+{
+    transpose_morton_tiles(A, A_cols, B, A_rows, A_rows, A_cols,
+                           TRANSPOSE_TILE_DBL, transpose_tile_w8);
+}
+
+void transpose_flt_cmplx_morton(const float complex* restrict A,
+                                float complex* restrict B,
+                                size_t A_rows, size_t A_cols)
+{
+    transpose_morton_tiles(A, A_cols, B, A_rows, A_rows, A_cols,
+                           TRANSPOSE_TILE_FLT_CMPLX, transpose_tile_w8);
+}
+
+void transpose_dbl_cmplx_morton(const double complex* restrict A,
+                                double complex* restrict B,
+                                size_t A_rows, size_t A_cols)
+{
+    transpose_morton_tiles(A, A_cols, B, A_rows, A_rows, A_cols,
+                           TRANSPOSE_TILE_DBL_CMPLX, transpose_tile_w16);
+}
+
+void transpose_flt_wc(const float* restrict A, float* restrict B,
+                      size_t A_rows, size_t A_cols)
+{
+    TRANSPOSE_WC_TILES(float, A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                       TRANSPOSE_TILE_FLT);
+}
+
+void transpose_dbl_wc(const double* restrict A, double* restrict B,
+                      size_t A_rows, size_t A_cols)
+{
+    TRANSPOSE_WC_TILES(double, A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                       TRANSPOSE_TILE_DBL);
+}
+
+void transpose_flt_cmplx_wc(const float complex* restrict A,
+                            float complex* restrict B,
+                            size_t A_rows, size_t A_cols)
+{
+    TRANSPOSE_WC_TILES(float complex, A, A_cols, B, A_rows,
+                       0, A_rows, 0, A_cols, TRANSPOSE_TILE_FLT_CMPLX);
+}
+
+void transpose_dbl_cmplx_wc(const double complex* restrict A,
+                            double complex* restrict B,
+                            size_t A_rows, size_t A_cols)
+{
+    TRANSPOSE_WC_TILES(double complex, A, A_cols, B, A_rows,
+                       0, A_rows, 0, A_cols, TRANSPOSE_TILE_DBL_CMPLX);
+}
+
+void transpose_flt_blocked2(const float* restrict A, float* restrict B,
+                            size_t A_rows, size_t A_cols,
+                            size_t blk_rows, size_t blk_cols,
+                            size_t sub_rows, size_t sub_cols)
+{
+    transpose_blocked2_tiles(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                             blk_rows, blk_cols, sub_rows, sub_cols,
+                             transpose_tile_w4);
+}
+
+void transpose_dbl_blocked2(const double* restrict A, double* restrict B,
+                            size_t A_rows, size_t A_cols,
+                            size_t blk_rows, size_t blk_cols,
+                            size_t sub_rows, size_t sub_cols)
+{
+    transpose_blocked2_tiles(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                             blk_rows, blk_cols, sub_rows, sub_cols,
+                             transpose_tile_w8);
+}
+
+void transpose_flt_cmplx_blocked2(const float complex* restrict A,
+                                  float complex* restrict B,
+                                  size_t A_rows, size_t A_cols,
+                                  size_t blk_rows, size_t blk_cols,
+                                  size_t sub_rows, size_t sub_cols)
+{
+    transpose_blocked2_tiles(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                             blk_rows, blk_cols, sub_rows, sub_cols,
+                             transpose_tile_w8);
+}
+
+void transpose_dbl_cmplx_blocked2(const double complex* restrict A,
+                                  double complex* restrict B,
+                                  size_t A_rows, size_t A_cols,
+                                  size_t blk_rows, size_t blk_cols,
+                                  size_t sub_rows, size_t sub_cols)
+{
+    transpose_blocked2_tiles(A, A_cols, B, A_rows, 0, A_rows, 0, A_cols,
+                             blk_rows, blk_cols, sub_rows, sub_cols,
+                             transpose_tile_w16);
+}
+
+void transpose_flt_blocked_pf(const float* restrict A, float* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              size_t blk_rows, size_t blk_cols,
+                              size_t pf_dist, enum transpose_pf_hint pf_hint)
+{
+    transpose_blocked_pf_tiles(A, A_cols, B, A_rows, sizeof(*A),
+                               0, A_rows, 0, A_cols, blk_rows, blk_cols,
+                               pf_dist, pf_hint, transpose_tile_w4);
+}
+
+void transpose_dbl_blocked_pf(const double* restrict A, double* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              size_t blk_rows, size_t blk_cols,
+                              size_t pf_dist, enum transpose_pf_hint pf_hint)
+{
+    transpose_blocked_pf_tiles(A, A_cols, B, A_rows, sizeof(*A),
+                               0, A_rows, 0, A_cols, blk_rows, blk_cols,
+                               pf_dist, pf_hint, transpose_tile_w8);
+}
+
+void transpose_flt_cmplx_blocked_pf(const float complex* restrict A,
+                                    float complex* restrict B,
+                                    size_t A_rows, size_t A_cols,
+                                    size_t blk_rows, size_t blk_cols,
+                                    size_t pf_dist, enum transpose_pf_hint pf_hint)
+{
+    transpose_blocked_pf_tiles(A, A_cols, B, A_rows, sizeof(*A),
+                               0, A_rows, 0, A_cols, blk_rows, blk_cols,
+                               pf_dist, pf_hint, transpose_tile_w8);
+}
+
+void transpose_dbl_cmplx_blocked_pf(const double complex* restrict A,
+                                    double complex* restrict B,
+                                    size_t A_rows, size_t A_cols,
+                                    size_t blk_rows, size_t blk_cols,
+                                    size_t pf_dist, enum transpose_pf_hint pf_hint)
+{
+    transpose_blocked_pf_tiles(A, A_cols, B, A_rows, sizeof(*A),
+                               0, A_rows, 0, A_cols, blk_rows, blk_cols,
+                               pf_dist, pf_hint, transpose_tile_w16);
+}
+
+typedef void (fn_transpose_swap_blk)(void *A, size_t n,
+                                     size_t r_min, size_t c_min,
+                                     size_t r_max, size_t c_max);
+
+void transpose_flt_naive_inplace(float *A, size_t n)
+{
+    TRANSPOSE_SWAP_BLK(float, A, n, 0, 0, n, n);
+}
+
+void transpose_dbl_naive_inplace(double *A, size_t n)
+{
+    TRANSPOSE_SWAP_BLK(double, A, n, 0, 0, n, n);
+}
+
+void transpose_flt_cmplx_naive_inplace(float complex *A, size_t n)
+{
+    TRANSPOSE_SWAP_BLK(float complex, A, n, 0, 0, n, n);
+}
+
+void transpose_dbl_cmplx_naive_inplace(double complex *A, size_t n)
+{
+    TRANSPOSE_SWAP_BLK(double complex, A, n, 0, 0, n, n);
+}
+
+static void transpose_swap_blk_flt(void *A, size_t n,
+                                   size_t r_min, size_t c_min,
+                                   size_t r_max, size_t c_max)
+{
+    TRANSPOSE_SWAP_BLK(float, (float *)A, n, r_min, c_min, r_max, c_max);
+}
+
+static void transpose_swap_blk_dbl(void *A, size_t n,
+                                   size_t r_min, size_t c_min,
+                                   size_t r_max, size_t c_max)
+{
+    TRANSPOSE_SWAP_BLK(double, (double *)A, n, r_min, c_min, r_max, c_max);
+}
+
+static void transpose_swap_blk_flt_cmplx(void *A, size_t n,
+                                         size_t r_min, size_t c_min,
+                                         size_t r_max, size_t c_max)
+{
+    TRANSPOSE_SWAP_BLK(float complex, (float complex *)A, n,
+                       r_min, c_min, r_max, c_max);
+}
+
+static void transpose_swap_blk_dbl_cmplx(void *A, size_t n,
+                                         size_t r_min, size_t c_min,
+                                         size_t r_max, size_t c_max)
+{
+    TRANSPOSE_SWAP_BLK(double complex, (double complex *)A, n,
+                       r_min, c_min, r_max, c_max);
+}
+
+static void transpose_blocked_inplace(void *A, size_t n, size_t blk,
+                                      fn_transpose_swap_blk *fn_swap_blk)
+{
+    size_t r_min, c_min, r_max, c_max;
+
+    // walk the tiles on and above the diagonal; the last tile row and column
+    // may be partial
+    for (r_min = 0; r_min < n; r_min += blk) {
+        r_max = n - r_min < blk ? n : r_min + blk;
+        for (c_min = r_min; c_min < n; c_min += blk) {
+            c_max = n - c_min < blk ? n : c_min + blk;
+            fn_swap_blk(A, n, r_min, c_min, r_max, c_max);
+        }
+    }
+}
+
+void transpose_flt_blocked_inplace(float *A, size_t n, size_t blk)
+{
+    transpose_blocked_inplace(A, n, blk, transpose_swap_blk_flt);
+}
+
+void transpose_dbl_blocked_inplace(double *A, size_t n, size_t blk)
+{
+    transpose_blocked_inplace(A, n, blk, transpose_swap_blk_dbl);
+}
+
+void transpose_flt_cmplx_blocked_inplace(float complex *A, size_t n,
+                                         size_t blk)
+{
+    transpose_blocked_inplace(A, n, blk, transpose_swap_blk_flt_cmplx);
+}
+
+void transpose_dbl_cmplx_blocked_inplace(double complex *A, size_t n,
+                                         size_t blk)
+{
+    transpose_blocked_inplace(A, n, blk, transpose_swap_blk_dbl_cmplx);
+}
+
+/*
+ * Rectangular in-place transpose by cycle following.  Seen as a flat array of
+ * N = A_rows * A_cols elements, the transpose moves the element at index k to
+ * k * A_rows mod (N - 1), so output index k is read from index
+ * k * A_cols mod (N - 1); the first and last elements never move.  This
+ * permutation splits into disjoint cycles, each of which is rotated once
+ * through a single temporary.
+ * A bitmap of N bits marks the indices already written, so every cycle is
+ * started exactly once.
+ */
+#define TRANSPOSE_CYCLES(datatype, A, A_rows, A_cols, visited) { \
+    const size_t _m = (A_rows) * (A_cols) - 1; \
+    size_t _s, _k, _j; \
+    datatype tmp; \
+    for (_s = 1; _s < _m; _s++) { \
+        if ((visited)[_s / 8] & (1u << (_s % 8))) { \
+            continue; \
+        } \
+        tmp = (A)[_s]; \
+        _k = _s; \
+        for (_j = _k * (A_cols) % _m; _j != _s; _j = _k * (A_cols) % _m) { \
+            (A)[_k] = (A)[_j]; \
+            (visited)[_k / 8] |= 1u << (_k % 8); \
+            _k = _j; \
+        } \
+        (A)[_k] = tmp; \
+        (visited)[_k / 8] |= 1u << (_k % 8); \
+    } \
+}
+
+static unsigned char *cycles_bitmap_alloc(size_t n)
+{
+    unsigned char *visited = assert_malloc((n + 7) / 8);
+    memset(visited, 0, (n + 7) / 8);
+    return visited;
+}
+
+void transpose_flt_cycles_inplace(float *A, size_t A_rows, size_t A_cols)
+{
+    unsigned char *visited;
+    if (A_rows == A_cols) {
+        transpose_flt_blocked_inplace(A, A_rows, TRANSPOSE_INPLACE_BLK);
+        return;
+    }
+    visited = cycles_bitmap_alloc(A_rows * A_cols);
+    TRANSPOSE_CYCLES(float, A, A_rows, A_cols, visited);
+    free(visited);
+}
+
+void transpose_dbl_cycles_inplace(double *A, size_t A_rows, size_t A_cols)
+{
+    unsigned char *visited;
+    if (A_rows == A_cols) {
+        transpose_dbl_blocked_inplace(A, A_rows, TRANSPOSE_INPLACE_BLK);
+        return;
+    }
+    visited = cycles_bitmap_alloc(A_rows * A_cols);
+    TRANSPOSE_CYCLES(double, A, A_rows, A_cols, visited);
+    free(visited);
+}
+
+void transpose_flt_cmplx_cycles_inplace(float complex *A,
+                                        size_t A_rows, size_t A_cols)
+{
+    unsigned char *visited;
+    if (A_rows == A_cols) {
+        transpose_flt_cmplx_blocked_inplace(A, A_rows, TRANSPOSE_INPLACE_BLK);
+        return;
+    }
+    visited = cycles_bitmap_alloc(A_rows * A_cols);
+    TRANSPOSE_CYCLES(float complex, A, A_rows, A_cols, visited);
+    free(visited);
+}
+
+void transpose_dbl_cmplx_cycles_inplace(double complex *A,
+                                        size_t A_rows, size_t A_cols)
+{
+    unsigned char *visited;
+    if (A_rows == A_cols) {
+        transpose_dbl_cmplx_blocked_inplace(A, A_rows, TRANSPOSE_INPLACE_BLK);
+        return;
+    }
+    visited = cycles_bitmap_alloc(A_rows * A_cols);
+    TRANSPOSE_CYCLES(double complex, A, A_rows, A_cols, visited);
+    free(visited);
 }
@@ -9,8 +9,15 @@
 #define TRANSPOSE_H
 
 #include <complex.h>
+#include <stdint.h>
 #include <stdlib.h>
 
+#include "transpose-cvt.h"
+#include "transpose-epi.h"
+#include "transpose-iq.h"
+#include "transpose-perm.h"
+#include "transpose-prefetch.h"
+
 void transpose_flt_naive(const float* restrict A, float* restrict B,
                          size_t A_rows, size_t A_cols);
 void transpose_dbl_naive(const double* restrict A, double* restrict B,
@@ -37,4 +44,305 @@ void transpose_dbl_cmplx_blocked(const double complex* restrict A,
                                  size_t A_rows, size_t A_cols,
                                  size_t blk_rows, size_t blk_cols);
 
+/*
+ * Transposes of 8- and 16-bit integer samples, e.g., raw ADC output.  Only the
+ * element width matters, so int8_t and uint16_t data can use these as well.
+ */
+void transpose_u8_naive(const uint8_t* restrict A, uint8_t* restrict B,
+                        size_t A_rows, size_t A_cols);
+void transpose_i16_naive(const int16_t* restrict A, int16_t* restrict B,
+                         size_t A_rows, size_t A_cols);
+
+void transpose_u8_blocked(const uint8_t* restrict A, uint8_t* restrict B,
+                          size_t A_rows, size_t A_cols,
+                          size_t blk_rows, size_t blk_cols);
+void transpose_i16_blocked(const int16_t* restrict A, int16_t* restrict B,
+                           size_t A_rows, size_t A_cols,
+                           size_t blk_rows, size_t blk_cols);
+
+/*
+ * Ingest transposes for interleaved I/Q ADC samples (see transpose-iq.h): each
+ * sample is converted to float complex, scaled by scale, and written to the
+ * transposed position in B, so no separate conversion pass is needed.
+ */
+void transpose_iq16_flt_cmplx_naive(const transpose_iq16_t* restrict A,
+                                    float complex* restrict B,
+                                    size_t A_rows, size_t A_cols, float scale);
+void transpose_iq12_flt_cmplx_naive(const transpose_iq12_t* restrict A,
+                                    float complex* restrict B,
+                                    size_t A_rows, size_t A_cols, float scale);
+
+void transpose_iq16_flt_cmplx_blocked(const transpose_iq16_t* restrict A,
+                                      float complex* restrict B,
+                                      size_t A_rows, size_t A_cols,
+                                      float scale,
+                                      size_t blk_rows, size_t blk_cols);
+void transpose_iq12_flt_cmplx_blocked(const transpose_iq12_t* restrict A,
+                                      float complex* restrict B,
+                                      size_t A_rows, size_t A_cols,
+                                      float scale,
+                                      size_t blk_rows, size_t blk_cols);
+
+/*
+ * Precision-converting transposes (see transpose-cvt.h): each element is
+ * rounded to the narrower output type as it is written to B, so no separate
+ * conversion pass over either matrix is needed.  Complex inputs give complex
+ * outputs.
+ */
+void transpose_dbl_flt_naive(const double* restrict A, float* restrict B,
+                             size_t A_rows, size_t A_cols);
+void transpose_dbl_cmplx_flt_cmplx_naive(const double complex* restrict A,
+                                         float complex* restrict B,
+                                         size_t A_rows, size_t A_cols);
+void transpose_flt_fp16_naive(const float* restrict A,
+                              transpose_fp16_t* restrict B,
+                              size_t A_rows, size_t A_cols);
+void transpose_flt_bf16_naive(const float* restrict A,
+                              transpose_bf16_t* restrict B,
+                              size_t A_rows, size_t A_cols);
+void transpose_flt_cmplx_fp16_cmplx_naive(const float complex* restrict A,
+                                          transpose_fp16_cmplx_t* restrict B,
+                                          size_t A_rows, size_t A_cols);
+void transpose_flt_cmplx_bf16_cmplx_naive(const float complex* restrict A,
+                                          transpose_bf16_cmplx_t* restrict B,
+                                          size_t A_rows, size_t A_cols);
+
+/*
+ * Split-complex transposes: *_cmplx_split_* write the real and imaginary parts
+ * of the interleaved complex A to separate planes B_re and B_im, each A_cols x
+ * A_rows, and *_split_cmplx_* interleave the planes A_re and A_im into B.
+ */
+void transpose_flt_cmplx_split_naive(const float complex* restrict A,
+                                     float* restrict B_re,
+                                     float* restrict B_im,
+                                     size_t A_rows, size_t A_cols);
+void transpose_dbl_cmplx_split_naive(const double complex* restrict A,
+                                     double* restrict B_re,
+                                     double* restrict B_im,
+                                     size_t A_rows, size_t A_cols);
+void transpose_flt_split_cmplx_naive(const float* restrict A_re,
+                                     const float* restrict A_im,
+                                     float complex* restrict B,
+                                     size_t A_rows, size_t A_cols);
+void transpose_dbl_split_cmplx_naive(const double* restrict A_re,
+                                     const double* restrict A_im,
+                                     double complex* restrict B,
+                                     size_t A_rows, size_t A_cols);
+
+/*
+ * Epilogue variants that scale, conjugate, window and/or twiddle each element
+ * as described by epi while transposing.  See transpose-epi.h.
+ */
+void transpose_flt_cmplx_naive_epi(const float complex* restrict A,
+                                   float complex* restrict B,
+                                   size_t A_rows, size_t A_cols,
+                                   const struct transpose_epi_flt_cmplx *epi);
+void transpose_dbl_cmplx_naive_epi(const double complex* restrict A,
+                                   double complex* restrict B,
+                                   size_t A_rows, size_t A_cols,
+                                   const struct transpose_epi_dbl_cmplx *epi);
+
+/*
+ * Permuting variants that write element (r, c) of A to B[rows[c]][cols[r]],
+ * e.g., to fftshift or bit-reverse the output.  See transpose-perm.h.
+ */
+void transpose_flt_naive_perm(const float* restrict A, float* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              const struct transpose_perm *perm);
+void transpose_dbl_naive_perm(const double* restrict A, double* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              const struct transpose_perm *perm);
+void transpose_flt_cmplx_naive_perm(const float complex* restrict A,
+                                    float complex* restrict B,
+                                    size_t A_rows, size_t A_cols,
+                                    const struct transpose_perm *perm);
+void transpose_dbl_cmplx_naive_perm(const double complex* restrict A,
+                                    double complex* restrict B,
+                                    size_t A_rows, size_t A_cols,
+                                    const struct transpose_perm *perm);
+
+void transpose_flt_blocked_perm(const float* restrict A, float* restrict B,
+                                size_t A_rows, size_t A_cols,
+                                const struct transpose_perm *perm,
+                                size_t blk_rows, size_t blk_cols);
+void transpose_dbl_blocked_perm(const double* restrict A, double* restrict B,
+                                size_t A_rows, size_t A_cols,
+                                const struct transpose_perm *perm,
+                                size_t blk_rows, size_t blk_cols);
+void transpose_flt_cmplx_blocked_perm(const float complex* restrict A,
+                                      float complex* restrict B,
+                                      size_t A_rows, size_t A_cols,
+                                      const struct transpose_perm *perm,
+                                      size_t blk_rows, size_t blk_cols);
+void transpose_dbl_cmplx_blocked_perm(const double complex* restrict A,
+                                      double complex* restrict B,
+                                      size_t A_rows, size_t A_cols,
+                                      const struct transpose_perm *perm,
+                                      size_t blk_rows, size_t blk_cols);
+
+/*
+ * Strided variants, like mkl_?omatcopy('r', 't', ...): A has row stride lda
+ * (at least A_cols) and B has row stride ldb (at least A_rows), so sub-views
+ * and padded buffers can be transposed in place of a copy.  Each output
+ * element is scaled by alpha.
+ */
+void transpose_flt_naive_ld(const float* restrict A, size_t lda,
+                            float* restrict B, size_t ldb,
+                            size_t A_rows, size_t A_cols, float alpha);
+void transpose_dbl_naive_ld(const double* restrict A, size_t lda,
+                            double* restrict B, size_t ldb,
+                            size_t A_rows, size_t A_cols, double alpha);
+void transpose_flt_cmplx_naive_ld(const float complex* restrict A, size_t lda,
+                                  float complex* restrict B, size_t ldb,
+                                  size_t A_rows, size_t A_cols,
+                                  float complex alpha);
+void transpose_dbl_cmplx_naive_ld(const double complex* restrict A, size_t lda,
+                                  double complex* restrict B, size_t ldb,
+                                  size_t A_rows, size_t A_cols,
+                                  double complex alpha);
+
+void transpose_flt_blocked_ld(const float* restrict A, size_t lda,
+                              float* restrict B, size_t ldb,
+                              size_t A_rows, size_t A_cols, float alpha,
+                              size_t blk_rows, size_t blk_cols);
+void transpose_dbl_blocked_ld(const double* restrict A, size_t lda,
+                              double* restrict B, size_t ldb,
+                              size_t A_rows, size_t A_cols, double alpha,
+                              size_t blk_rows, size_t blk_cols);
+void transpose_flt_cmplx_blocked_ld(const float complex* restrict A, size_t lda,
+                                    float complex* restrict B, size_t ldb,
+                                    size_t A_rows, size_t A_cols,
+                                    float complex alpha,
+                                    size_t blk_rows, size_t blk_cols);
+void transpose_dbl_cmplx_blocked_ld(const double complex* restrict A,
+                                    size_t lda,
+                                    double complex* restrict B, size_t ldb,
+                                    size_t A_rows, size_t A_cols,
+                                    double complex alpha,
+                                    size_t blk_rows, size_t blk_cols);
+
+/*
+ * Blocked transposes that prefetch the source rows and destination lines of
+ * the tile pf_dist tiles ahead (0 disables prefetching).  See
+ * transpose-prefetch.h for the hints.
+ */
+void transpose_flt_blocked_pf(const float* restrict A, float* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              size_t blk_rows, size_t blk_cols,
+                              size_t pf_dist, enum transpose_pf_hint pf_hint);
+void transpose_dbl_blocked_pf(const double* restrict A, double* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              size_t blk_rows, size_t blk_cols,
+                              size_t pf_dist, enum transpose_pf_hint pf_hint);
+void transpose_flt_cmplx_blocked_pf(const float complex* restrict A,
+                                    float complex* restrict B,
+                                    size_t A_rows, size_t A_cols,
+                                    size_t blk_rows, size_t blk_cols,
+                                    size_t pf_dist, enum transpose_pf_hint pf_hint);
+void transpose_dbl_cmplx_blocked_pf(const double complex* restrict A,
+                                    double complex* restrict B,
+                                    size_t A_rows, size_t A_cols,
+                                    size_t blk_rows, size_t blk_cols,
+                                    size_t pf_dist, enum transpose_pf_hint pf_hint);
+
+/*
+ * Two-level blocked transposes: blk_rows x blk_cols outer tiles keep the pages
+ * in use within the DTLB, and sub_rows x sub_cols inner tiles keep the working
+ * set in registers/L1.  Neither size needs to divide the matrix dimensions.
+ */
+void transpose_flt_blocked2(const float* restrict A, float* restrict B,
+                            size_t A_rows, size_t A_cols,
+                            size_t blk_rows, size_t blk_cols,
+                            size_t sub_rows, size_t sub_cols);
+void transpose_dbl_blocked2(const double* restrict A, double* restrict B,
+                            size_t A_rows, size_t A_cols,
+                            size_t blk_rows, size_t blk_cols,
+                            size_t sub_rows, size_t sub_cols);
+void transpose_flt_cmplx_blocked2(const float complex* restrict A,
+                                  float complex* restrict B,
+                                  size_t A_rows, size_t A_cols,
+                                  size_t blk_rows, size_t blk_cols,
+                                  size_t sub_rows, size_t sub_cols);
+void transpose_dbl_cmplx_blocked2(const double complex* restrict A,
+                                  double complex* restrict B,
+                                  size_t A_rows, size_t A_cols,
+                                  size_t blk_rows, size_t blk_cols,
+                                  size_t sub_rows, size_t sub_cols);
+
+/*
+ * Cache-oblivious transposes that need no block size.  *_recursive halves the
+ * larger dimension until a small base tile remains; *_morton visits the same
+ * base tiles in Z order.
+ */
+void transpose_flt_recursive(const float* restrict A, float* restrict B,
+                             size_t A_rows, size_t A_cols);
+void transpose_dbl_recursive(const double* restrict A, double* restrict B,
+                             size_t A_rows, size_t A_cols);
+void transpose_flt_cmplx_recursive(const float complex* restrict A,
+                                   float complex* restrict B,
+                                   size_t A_rows, size_t A_cols);
+void transpose_dbl_cmplx_recursive(const double complex* restrict A,
+                                   double complex* restrict B,
+                                   size_t A_rows, size_t A_cols);
+
+void transpose_flt_morton(const float* restrict A, float* restrict B,
+                          size_t A_rows, size_t A_cols);
+void transpose_dbl_morton(const double* restrict A, double* restrict B,
+                          size_t A_rows, size_t A_cols);
+void transpose_flt_cmplx_morton(const float complex* restrict A,
+                                float complex* restrict B,
+                                size_t A_rows, size_t A_cols);
+void transpose_dbl_cmplx_morton(const double complex* restrict A,
+                                double complex* restrict B,
+                                size_t A_rows, size_t A_cols);
+
+/*
+ * Write-combining transposes: each tile is transposed into an L1-resident
+ * staging buffer whose rows are then written to B as whole cache lines with
+ * streaming stores.  See transpose-wc.h.
+ */
+void transpose_flt_wc(const float* restrict A, float* restrict B,
+                      size_t A_rows, size_t A_cols);
+void transpose_dbl_wc(const double* restrict A, double* restrict B,
+                      size_t A_rows, size_t A_cols);
+void transpose_flt_cmplx_wc(const float complex* restrict A,
+                            float complex* restrict B,
+                            size_t A_rows, size_t A_cols);
+void transpose_dbl_cmplx_wc(const double complex* restrict A,
+                            double complex* restrict B,
+                            size_t A_rows, size_t A_cols);
+
+/*
+ * In-place transposes of a square n x n matrix.  Tiles above the diagonal are
+ * swapped pairwise with their mirror tiles below it, so no second buffer is
+ * needed.  blk is the tile edge length and need not divide n.
+ */
+void transpose_flt_naive_inplace(float *A, size_t n);
+void transpose_dbl_naive_inplace(double *A, size_t n);
+void transpose_flt_cmplx_naive_inplace(float complex *A, size_t n);
+void transpose_dbl_cmplx_naive_inplace(double complex *A, size_t n);
+
+void transpose_flt_blocked_inplace(float *A, size_t n, size_t blk);
+void transpose_dbl_blocked_inplace(double *A, size_t n, size_t blk);
+void transpose_flt_cmplx_blocked_inplace(float complex *A, size_t n,
+                                         size_t blk);
+void transpose_dbl_cmplx_blocked_inplace(double complex *A, size_t n,
+                                         size_t blk);
+
+/*
+ * In-place transposes of a rectangular A_rows x A_cols matrix; afterwards A
+ * holds the A_cols x A_rows result.  Elements are moved along the cycles of the
+ * transpose permutation, with a bitmap of one bit per element as the only
+ * extra memory.  Square matrices use the blocked tile swap instead, with
+ * TRANSPOSE_INPLACE_BLK x TRANSPOSE_INPLACE_BLK tiles.
+ */
+#define TRANSPOSE_INPLACE_BLK 32
+
+void transpose_flt_cycles_inplace(float *A, size_t A_rows, size_t A_cols);
+void transpose_dbl_cycles_inplace(double *A, size_t A_rows, size_t A_cols);
+void transpose_flt_cmplx_cycles_inplace(float complex *A,
+                                        size_t A_rows, size_t A_cols);
+void transpose_dbl_cmplx_cycles_inplace(double complex *A,
+                                        size_t A_rows, size_t A_cols);
+
 #endif /* TRANSPOSE_H */
@@ -7,8 +7,10 @@
 #include <complex.h>
 #include <errno.h>
 #include <float.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "util.h"
 
@@ -36,6 +38,17 @@ double complex rand_dbl_cmplx(void)
     return CMPLX(rand_dbl(), rand_dbl());
 }
 
+uint8_t rand_u8(void)
+{
+    // random sample over the full range, like the output of an 8-bit ADC
+    return (uint8_t) (rand() & 0xff);
+}
+
+int16_t rand_i16(void)
+{
+    return (int16_t) ((rand() & 0xffff) - 0x8000);
+}
+
 #define FILL_RAND(a, len, fn_rand) \
 { \
     size_t i; \
@@ -48,6 +61,39 @@ void fill_rand_flt(float *a, size_t len)
     FILL_RAND(a, len, rand_flt);
 }
 
+/*
+ * Bit patterns of the floats whose fp16 and bf16 conversions take the special
+ * cases: NaNs (quiet, signaling, with payload bits above the fp16 mantissa),
+ * infinities, the values around the fp16 overflow threshold 65520, fp16
+ * subnormals and their rounding ties, float subnormals and signed zeros.
+ */
+static const uint32_t flt_edge[] = {
+    0x7fc00000, 0xffc00000, 0x7f800001, 0xff800001, 0x7fa00000, 0x7fffffff,
+    0x7f800000, 0xff800000, 0x7f7fffff, 0xff7fffff,
+    0x477fe000, 0x477fefff, 0x477ff000, 0xc77ff000,
+    0x387fc000, 0x38800000, 0x33800000, 0xb3800000, 0x33000000, 0x33000001,
+    0x34400000, 0x00000001, 0x007fffff, 0x807fffff, 0x00000000, 0x80000000,
+};
+
+// every 3rd element, so that whole vectors and their remainders see them
+#define FILL_EDGE_STRIDE 3
+
+void fill_edge_flt(float *a, size_t len)
+{
+    size_t i;
+    fill_rand_flt(a, len);
+    for (i = 0; i < len; i += FILL_EDGE_STRIDE) {
+        memcpy(&a[i], &flt_edge[i / FILL_EDGE_STRIDE %
+                                (sizeof(flt_edge) / sizeof(*flt_edge))],
+               sizeof(*a));
+    }
+}
+
+void fill_edge_flt_cmplx(float complex *a, size_t len)
+{
+    fill_edge_flt((float *)a, 2 * len);
+}
+
 void fill_rand_dbl(double *a, size_t len)
 {
     FILL_RAND(a, len, rand_dbl);
@@ -63,6 +109,27 @@ void fill_rand_dbl_cmplx(double complex *a, size_t len)
     FILL_RAND(a, len, rand_dbl_cmplx);
 }
 
+void fill_rand_u8(uint8_t *a, size_t len)
+{
+    FILL_RAND(a, len, rand_u8);
+}
+
+void fill_rand_i16(int16_t *a, size_t len)
+{
+    FILL_RAND(a, len, rand_i16);
+}
+
+void fill_rand_iq16(transpose_iq16_t *a, size_t len)
+{
+    fill_rand_i16((int16_t *)a, 2 * len);
+}
+
+void fill_rand_iq12(transpose_iq12_t *a, size_t len)
+{
+    // every bit pattern is a valid packed sample
+    fill_rand_u8((uint8_t *)a, len * sizeof(*a));
+}
+
 #define MATRIX_PRINT(A, nrows, ncols) \
 { \
     size_t r, c; \
@@ -87,6 +154,41 @@ void fill_rand_dbl_cmplx(double complex *a, size_t len)
     } \
 }
 
+#define MATRIX_PRINT_CVT(A, nrows, ncols, fn_cvt) \
+{ \
+    size_t r, c; \
+    for (r = 0; r < nrows; r++) { \
+        for (c = 0; c < ncols; c++) { \
+            printf("%s%f", (c > 0 ? ", " : ""), fn_cvt(A[r * ncols + c])); \
+        } \
+        printf("\n"); \
+    } \
+}
+
+#define MATRIX_PRINT_CMPLX_CVT(A, nrows, ncols, fn_cvt) \
+{ \
+    size_t r, c; \
+    float complex v; \
+    for (r = 0; r < nrows; r++) { \
+        for (c = 0; c < ncols; c++) { \
+            v = fn_cvt(A[r * ncols + c]); \
+            printf("%s(%f, %f)", (c > 0 ? ", " : ""), crealf(v), cimagf(v)); \
+        } \
+        printf("\n"); \
+    } \
+}
+
+#define MATRIX_PRINT_INT(A, nrows, ncols) \
+{ \
+    size_t r, c; \
+    for (r = 0; r < nrows; r++) { \
+        for (c = 0; c < ncols; c++) { \
+            printf("%s%d", (c > 0 ? ", " : ""), (int) A[r * ncols + c]); \
+        } \
+        printf("\n"); \
+    } \
+}
+
 void matrix_print_flt(const float *A, size_t nrows, size_t ncols)
 {
     MATRIX_PRINT(A, nrows, ncols);
@@ -107,6 +209,63 @@ void matrix_print_dbl_cmplx(const double complex *A, size_t nrows, size_t ncols)
     MATRIX_PRINT_CMPLX(A, nrows, ncols);
 }
 
+void matrix_print_u8(const uint8_t *A, size_t nrows, size_t ncols)
+{
+    MATRIX_PRINT_INT(A, nrows, ncols);
+}
+
+void matrix_print_i16(const int16_t *A, size_t nrows, size_t ncols)
+{
+    MATRIX_PRINT_INT(A, nrows, ncols);
+}
+
+#define MATRIX_PRINT_IQ(A, nrows, ncols, fn_i, fn_q) \
+{ \
+    size_t r, c, i; \
+    for (r = 0; r < nrows; r++) { \
+        for (c = 0; c < ncols; c++) { \
+            i = r * ncols + c; \
+            printf("%s(%d, %d)", (c > 0 ? ", " : ""), fn_i(A[i]), fn_q(A[i])); \
+        } \
+        printf("\n"); \
+    } \
+}
+
+#define IQ16_I(v) ((v).i)
+#define IQ16_Q(v) ((v).q)
+
+void matrix_print_iq16(const transpose_iq16_t *A, size_t nrows, size_t ncols)
+{
+    MATRIX_PRINT_IQ(A, nrows, ncols, IQ16_I, IQ16_Q);
+}
+
+void matrix_print_iq12(const transpose_iq12_t *A, size_t nrows, size_t ncols)
+{
+    MATRIX_PRINT_IQ(A, nrows, ncols, transpose_iq12_i, transpose_iq12_q);
+}
+
+void matrix_print_fp16(const transpose_fp16_t *A, size_t nrows, size_t ncols)
+{
+    MATRIX_PRINT_CVT(A, nrows, ncols, transpose_fp16_to_flt);
+}
+
+void matrix_print_bf16(const transpose_bf16_t *A, size_t nrows, size_t ncols)
+{
+    MATRIX_PRINT_CVT(A, nrows, ncols, transpose_bf16_to_flt);
+}
+
+void matrix_print_fp16_cmplx(const transpose_fp16_cmplx_t *A,
+                             size_t nrows, size_t ncols)
+{
+    MATRIX_PRINT_CMPLX_CVT(A, nrows, ncols, transpose_fp16_cmplx_to_flt_cmplx);
+}
+
+void matrix_print_bf16_cmplx(const transpose_bf16_cmplx_t *A,
+                             size_t nrows, size_t ncols)
+{
+    MATRIX_PRINT_CMPLX_CVT(A, nrows, ncols, transpose_bf16_cmplx_to_flt_cmplx);
+}
+
 int is_eq_flt(float a, float b)
 {
     float v = a - b;
@@ -129,6 +288,81 @@ int is_eq_dbl_cmplx(double complex a, double complex b)
     return is_eq_dbl(creal(a), creal(b)) && is_eq_dbl(cimag(a), cimag(b));
 }
 
+int is_eq_u8(uint8_t a, uint8_t b)
+{
+    return a == b;
+}
+
+int is_eq_i16(int16_t a, int16_t b)
+{
+    return a == b;
+}
+
+int is_eq_fp16(transpose_fp16_t a, transpose_fp16_t b)
+{
+    return a == b;
+}
+
+int is_eq_fp16_cmplx(transpose_fp16_cmplx_t a, transpose_fp16_cmplx_t b)
+{
+    return a.re == b.re && a.im == b.im;
+}
+
+int is_eq_bf16(transpose_bf16_t a, transpose_bf16_t b)
+{
+    return a == b;
+}
+
+int is_eq_bf16_cmplx(transpose_bf16_cmplx_t a, transpose_bf16_cmplx_t b)
+{
+    return a.re == b.re && a.im == b.im;
+}
+
+/*
+ * Whether back, the value a was rounded to, is within half an ulp of a: rel is
+ * half an ulp relative to the magnitude of a normal number, and abs_min half
+ * the smallest subnormal ulp, which bounds the error of tiny values.
+ */
+static int is_rt(double a, double back, double rel, double abs_min)
+{
+    double err = a > back ? a - back : back - a;
+    double mag = a < 0 ? -a : a;
+    return err <= mag * rel || err <= abs_min;
+}
+
+int is_rt_dbl_flt(double a, float b)
+{
+    return is_rt(a, b, 0x1p-24, 0x1p-150);
+}
+
+int is_rt_dbl_cmplx_flt_cmplx(double complex a, float complex b)
+{
+    return is_rt_dbl_flt(creal(a), crealf(b)) &&
+           is_rt_dbl_flt(cimag(a), cimagf(b));
+}
+
+int is_rt_flt_fp16(float a, transpose_fp16_t b)
+{
+    return is_rt(a, transpose_fp16_to_flt(b), 0x1p-11, 0x1p-25);
+}
+
+// bf16 flushes float subnormals, so those may come back as zero
+int is_rt_flt_bf16(float a, transpose_bf16_t b)
+{
+    return is_rt(a, transpose_bf16_to_flt(b), 0x1p-8, 0x1p-134) ||
+           (a > -FLT_MIN && a < FLT_MIN && !(b & 0x7fff));
+}
+
+int is_rt_flt_cmplx_fp16_cmplx(float complex a, transpose_fp16_cmplx_t b)
+{
+    return is_rt_flt_fp16(crealf(a), b.re) && is_rt_flt_fp16(cimagf(a), b.im);
+}
+
+int is_rt_flt_cmplx_bf16_cmplx(float complex a, transpose_bf16_cmplx_t b)
+{
+    return is_rt_flt_bf16(crealf(a), b.re) && is_rt_flt_bf16(cimagf(a), b.im);
+}
+
 void *assert_malloc(size_t sz)
 {
     void *ptr = malloc(sz);
@@ -141,16 +375,10 @@ void *assert_malloc(size_t sz)
 
 void *assert_malloc_al(size_t sz)
 {
-    size_t align;
+    // aligned_alloc requires sz to be a multiple of the alignment
+    const size_t align = 64;
     void *ptr;
-    if (sz % 64 == 0) {
-        align = 64;
-    } else if (sz % 32 == 0) {
-        align = 32;
-    } else {
-        fprintf(stderr, "assert_malloc: sz must be a multiple of 64 or 32\n");
-        exit(EINVAL);
-    }
+    sz = (sz + align - 1) / align * align;
 #if defined(HAVE_ALIGNED_ALLOC)
     ptr = aligned_alloc(align, sz);
     if (!ptr) {
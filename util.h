@@ -8,27 +8,70 @@
 #define UTIL_H
 
 #include <complex.h>
+#include <stdint.h>
 #include <stdlib.h>
 
+#include "transpose-cvt.h"
+#include "transpose-iq.h"
+
 float rand_flt(void);
 double rand_dbl(void);
 float complex rand_flt_cmplx(void);
 double complex rand_dbl_cmplx(void);
+uint8_t rand_u8(void);
+int16_t rand_i16(void);
 
 void fill_rand_flt(float *a, size_t len);
 void fill_rand_dbl(double *a, size_t len);
 void fill_rand_flt_cmplx(float complex *a, size_t len);
 void fill_rand_dbl_cmplx(double complex *a, size_t len);
+void fill_rand_u8(uint8_t *a, size_t len);
+void fill_rand_i16(int16_t *a, size_t len);
+void fill_rand_iq16(transpose_iq16_t *a, size_t len);
+void fill_rand_iq12(transpose_iq12_t *a, size_t len);
+/*
+ * Random values with NaNs, infinities, values that overflow fp16 and fp16 and
+ * float subnormals mixed in, for the bit-exact fp16 conversion checks.
+ */
+void fill_edge_flt(float *a, size_t len);
+void fill_edge_flt_cmplx(float complex *a, size_t len);
 
 void matrix_print_flt(const float *A, size_t nrows, size_t ncols);
 void matrix_print_dbl(const double *A, size_t nrows, size_t ncols);
 void matrix_print_flt_cmplx(const float complex *A, size_t nrows, size_t ncols);
 void matrix_print_dbl_cmplx(const double complex *A, size_t nrows, size_t ncols);
+void matrix_print_u8(const uint8_t *A, size_t nrows, size_t ncols);
+void matrix_print_i16(const int16_t *A, size_t nrows, size_t ncols);
+void matrix_print_iq16(const transpose_iq16_t *A, size_t nrows, size_t ncols);
+void matrix_print_iq12(const transpose_iq12_t *A, size_t nrows, size_t ncols);
+void matrix_print_fp16(const transpose_fp16_t *A, size_t nrows, size_t ncols);
+void matrix_print_bf16(const transpose_bf16_t *A, size_t nrows, size_t ncols);
+void matrix_print_fp16_cmplx(const transpose_fp16_cmplx_t *A,
+                             size_t nrows, size_t ncols);
+void matrix_print_bf16_cmplx(const transpose_bf16_cmplx_t *A,
+                             size_t nrows, size_t ncols);
 
 int is_eq_flt(float a, float b);
 int is_eq_dbl(double a, double b);
 int is_eq_flt_cmplx(float complex a, float complex b);
 int is_eq_dbl_cmplx(double complex a, double complex b);
+int is_eq_u8(uint8_t a, uint8_t b);
+int is_eq_i16(int16_t a, int16_t b);
+int is_eq_fp16(transpose_fp16_t a, transpose_fp16_t b);
+int is_eq_fp16_cmplx(transpose_fp16_cmplx_t a, transpose_fp16_cmplx_t b);
+int is_eq_bf16(transpose_bf16_t a, transpose_bf16_t b);
+int is_eq_bf16_cmplx(transpose_bf16_cmplx_t a, transpose_bf16_cmplx_t b);
+
+/*
+ * Round-trip checks for the precision-converting transposes: b, converted back
+ * to the type of a, must be within half an ulp of the narrower format of a.
+ */
+int is_rt_dbl_flt(double a, float b);
+int is_rt_dbl_cmplx_flt_cmplx(double complex a, float complex b);
+int is_rt_flt_fp16(float a, transpose_fp16_t b);
+int is_rt_flt_bf16(float a, transpose_bf16_t b);
+int is_rt_flt_cmplx_fp16_cmplx(float complex a, transpose_fp16_cmplx_t b);
+int is_rt_flt_cmplx_bf16_cmplx(float complex a, transpose_bf16_cmplx_t b);
 
 void *assert_malloc(size_t sz);
 void *assert_malloc_al(size_t sz);